@@ -0,0 +1,21 @@
+// Decoding of compressed vertices (Gem::Graphics::VertexCompression).
+// Include it after #version:  #include "GemVertexCompression.glsl"
+//
+// Compressed vertices use the usual locations:
+//   location = 0: position in [-1, 1] across the mesh's bounds -> gem_decode_position()
+//   location = 1: UV, half floats, usable as is
+//   location = 2: octahedral normal in [-1, 1]                 -> gem_decode_normal()
+
+// Position from its quantized value and the mesh's PositionBounds (center, half extent)
+vec3 gem_decode_position(vec3 quantized, vec3 center, vec3 extent) {
+    return center + quantized * extent;
+}
+
+// Unit normal from its octahedral encoding
+vec3 gem_decode_normal(vec2 encoded) {
+    vec3 normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float fold = max(-normal.z, 0.0);
+    normal.x += normal.x >= 0.0 ? -fold : fold;
+    normal.y += normal.y >= 0.0 ? -fold : fold;
+    return normalize(normal);
+}
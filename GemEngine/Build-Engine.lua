@@ -60,19 +60,26 @@ filter "system:windows"
     systemversion "latest"
     defines { }
 
+filter "system:linux"
+    if GemUseEGL then
+        links { "EGL" } -- Headless contexts (GemEngine::Config::headless)
+    else
+        defines { "GEM_HAS_EGL=0" } -- EGL_Manager reports headless contexts as unavailable
+    end
+
 filter "configurations:Debug"
-    defines { "DEBUG" }
+    defines { "DEBUG", "GEMENGINE_GL_POLICY=Checking" } -- GL wrapper instrumentation (GLPolicy.h)
     runtime "Debug"
     symbols "On"
 
 filter "configurations:Release"
-    defines { "RELEASE" }
+    defines { "RELEASE", _OPTIONS["gl-tracing"] and "GEMENGINE_GL_POLICY=Tracing" or "GEMENGINE_GL_POLICY=Release" }
     runtime "Release"
     optimize "On"
     symbols "On"
 
 filter "configurations:Dist"
-    defines { "DIST" }
+    defines { "DIST", "GEMENGINE_GL_POLICY=Counting" }
     runtime "Release"
     optimize "On"
     symbols "Off"
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <mutex>
+
+namespace Gem {
+
+    /**
+     * @class EGLManager
+     * @brief A singleton manager that owns the headless EGL context and its offscreen framebuffer.
+     *
+     *        Used by GemEngine in headless mode instead of GLFW: the context is created on a
+     *        surfaceless display (EGL_MESA_platform_surfaceless / EGL_KHR_surfaceless_context),
+     *        or with a 1x1 pbuffer when surfaceless contexts are not supported, so no X11 or
+     *        Wayland server is needed. Rendering goes to a framebuffer object that stands in
+     *        for the window's default framebuffer.
+     *
+     *        Only available where the EGL headers are found (Linux with Mesa or a vendor driver).
+     */
+    class EGLManager
+    {
+    public:
+        /**
+         * @brief A second context sharing objects with the headless one, for another thread.
+         */
+        struct SharedContext {
+            void* context = nullptr;    ///< EGLContext
+            void* surface = nullptr;    ///< EGLSurface, only for the pbuffer fallback
+        };
+
+        /**
+         * @brief Gets the singleton instance of EGLManager.
+         *
+         * @return Reference to the EGLManager instance.
+         */
+        static EGLManager& getInstance();
+
+        // Delete copy/move operations to enforce singleton usage.
+        EGLManager(const EGLManager&) = delete;
+        EGLManager(EGLManager&&) = delete;
+        EGLManager& operator=(const EGLManager&) = delete;
+        EGLManager& operator=(EGLManager&&) = delete;
+
+        /**
+         * @brief Creates an OpenGL core context and makes it current on the calling thread.
+         *
+         * Falls back to lower versions (down to 3.3) if the requested one is not available.
+         *
+         * @return true if a context is current, false otherwise.
+         */
+        bool initEGL(int major, int minor);
+
+        /**
+         * @brief Creates the offscreen framebuffer (RGBA8 + depth/stencil) and binds it.
+         *
+         * Must be called after GLAD has been loaded.
+         *
+         * @return true if the framebuffer is complete, false otherwise.
+         */
+        bool createFramebuffer(int width, int height);
+
+        /**
+         * @brief Creates a context that shares buffers, textures and sync objects with the headless one.
+         * Same config and version; not made current.
+         * @return true if @p shared holds a context, false otherwise.
+         */
+        bool createSharedContext(SharedContext& shared);
+
+        /**
+         * @brief The headless context itself, to make it current again with makeCurrent().
+         */
+        SharedContext getContext() const;
+
+        /**
+         * @brief Makes @p shared current on the calling thread, or releases the calling thread's
+         * context when @p shared is empty.
+         */
+        bool makeCurrent(const SharedContext& shared);
+
+        /**
+         * @brief Destroys a context made by createSharedContext(). It must not be current on any thread.
+         * Call before terminateEGL().
+         */
+        void destroySharedContext(SharedContext& shared);
+
+        /**
+         * @brief Deletes the offscreen framebuffer and destroys the context, if initialized.
+         */
+        void terminateEGL();
+
+        /**
+         * @brief Checks if a headless context exists.
+         */
+        bool isInitialized() const;
+
+        /**
+         * @brief Name of the offscreen framebuffer object.
+         */
+        unsigned int getFramebuffer() const;
+
+        int getWidth() const;
+        int getHeight() const;
+
+        /**
+         * @brief Loader passed to GLAD (wraps eglGetProcAddress).
+         */
+        static void* getProcAddress(const char* name);
+
+    private:
+        EGLManager() = default;  ///< Private constructor to ensure singleton usage.
+        ~EGLManager() = default; ///< Private destructor.
+
+    private:
+        std::mutex mutex_;      ///< Mutex to guard init/terminate operations.
+        bool initialized_ = false;
+
+        void* display_ = nullptr;   ///< EGLDisplay
+        void* context_ = nullptr;   ///< EGLContext
+        void* surface_ = nullptr;   ///< EGLSurface, only for the pbuffer fallback
+        void* config_ = nullptr;    ///< EGLConfig, reused for shared contexts
+        int major_ = 0;             ///< Version of the created context
+        int minor_ = 0;
+        bool surfaceless_ = false;
+
+        unsigned int framebuffer_ = 0;
+        unsigned int color_buffer_ = 0;
+        unsigned int depth_buffer_ = 0;
+        int width_ = 0;
+        int height_ = 0;
+    };
+
+} // namespace Gem
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Gem/Core/GLCapture.h>
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Gem {
+
+    /**
+     * @class GLCaptureRecord
+     * @brief Builds one GLCapture record and appends it when destroyed.
+     *
+     * Usage (in the GL wrappers, after the driver call):
+     *     if (GLCapture::isCapturing()) {
+     *         GLCaptureRecord(GLCaptureFormat::Call::BufferData) << target << GLCaptureRecord::i64(size) << GLCaptureRecord::Blob{ data, size } << usage;
+     *     }
+     *
+     * The payload is built in a per-thread scratch buffer, so only the append locks.
+     */
+    class GLCaptureRecord {
+    public:
+        /**
+         * @brief Memory read by the call: stored as a u64 size and the bytes (NULL_BLOB if null).
+         */
+        struct Blob {
+            const void* data;
+            std::size_t size;
+        };
+
+        explicit GLCaptureRecord(GLCaptureFormat::Call call) noexcept
+            : call_(call), payload_(scratch()) {
+            payload_.clear();
+        }
+
+        ~GLCaptureRecord() {
+            GLCapture::append(call_, payload_.data(), payload_.size());
+        }
+
+        GLCaptureRecord(const GLCaptureRecord&) = delete;
+        GLCaptureRecord& operator=(const GLCaptureRecord&) = delete;
+
+        template <typename T>
+        GLCaptureRecord& operator<<(T value) {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Store pointers as offsets or blobs");
+            put(&value, sizeof(value));
+            return *this;
+        }
+
+        GLCaptureRecord& operator<<(const Blob& blob) {
+            std::uint64_t size = blob.data ? static_cast<std::uint64_t>(blob.size) : GLCaptureFormat::NULL_BLOB;
+            put(&size, sizeof(size));
+            if (blob.data) {
+                put(blob.data, blob.size);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Pointer-sized values (GLsizeiptr, GLintptr, offsets passed as pointers) are stored as 8 bytes.
+         */
+        [[nodiscard]] static std::int64_t i64(std::ptrdiff_t value) noexcept {
+            return static_cast<std::int64_t>(value);
+        }
+
+        [[nodiscard]] static std::uint64_t offset(const void* pointer) noexcept {
+            return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(pointer));
+        }
+
+    private:
+        void put(const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            payload_.insert(payload_.end(), bytes, bytes + size);
+        }
+
+        static std::vector<std::byte>& scratch() noexcept {
+            thread_local std::vector<std::byte> buffer;
+            return buffer;
+        }
+
+        GLCaptureFormat::Call call_;
+        std::vector<std::byte>& payload_;
+    };
+
+} // namespace Gem
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Profiler.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Instrumentation compiled into every Gem::GL wrapper: one of the GLPolicy structs below.
+ * If GEMENGINE_GL_POLICY is not defined by the build system (Build-Engine.lua sets it per
+ * configuration), Debug checks errors, Dist counts calls and other builds make plain calls.
+ * Tracing is opt-in (premake --gl-tracing for Release).
+ */
+#ifndef GEMENGINE_GL_POLICY
+
+    #if defined(DEBUG)
+        #define GEMENGINE_GL_POLICY Checking
+
+    #elif defined(DIST)
+        #define GEMENGINE_GL_POLICY Counting
+
+    #else
+        #define GEMENGINE_GL_POLICY Release
+
+    #endif
+#endif
+
+/**
+ * @brief Runs the driver call (the last argument, an expression) through the active policy.
+ *
+ * @p name is the wrapper's name (a string literal), @p bytes the amount of data the call
+ * reads from client memory (0 if none), only evaluated by policies that use it. Evaluates
+ * to the call's result.
+ */
+#define GEM_GL_CALL(name, bytes, ...)                                                                   \
+    [&]() -> decltype(auto) {                                                                           \
+        static constinit ::Gem::GLPolicy::Site gem_gl_site_{ { name, __FILE__, __LINE__ } };            \
+        return ::Gem::GLPolicy::Active::invoke(gem_gl_site_,                                          \
+            [&]() -> std::size_t { return static_cast<std::size_t>(bytes); },                          \
+            [&]() -> decltype(auto) { return __VA_ARGS__; });                                         \
+    }()
+
+namespace Gem {
+
+    namespace GLPolicy {
+
+        /**
+         * @brief Per-wrapper state. Constant-initialized, so policies that ignore it cost nothing.
+         */
+        struct Site {
+            Profiler::ZoneDesc zone;
+            std::atomic<std::uint64_t> calls{ 0 };
+            std::atomic<std::uint64_t> bytes{ 0 };
+            std::atomic<bool> registered{ false };
+            Site* next = nullptr;
+        };
+
+        /**
+         * @brief Adds @p site to the list read by GL::get_call_stats(). Once per site.
+         */
+        void registerSite(Site& site) noexcept;
+
+        /**
+         * @brief Plain driver call.
+         */
+        struct Release {
+            static constexpr const char* NAME = "Release";
+
+            template <typename Bytes, typename Call>
+            static decltype(auto) invoke(Site&, Bytes&&, Call&& call) {
+                return call();
+            }
+        };
+
+        /**
+         * @brief Counts calls and bytes per wrapper (GL::get_call_stats()). Two relaxed atomic adds per call.
+         */
+        struct Counting {
+            static constexpr const char* NAME = "Counting";
+
+            template <typename Bytes, typename Call>
+            static decltype(auto) invoke(Site& site, Bytes&& bytes, Call&& call) {
+                if (!site.registered.load(std::memory_order_relaxed)) {
+                    registerSite(site);
+                }
+                site.calls.fetch_add(1, std::memory_order_relaxed);
+                if (std::size_t size = bytes(); size != 0) {
+                    site.bytes.fetch_add(size, std::memory_order_relaxed);
+                }
+                return call();
+            }
+        };
+
+        /**
+         * @brief Calls glGetError after the call and logs every error with the wrapper's name.
+         */
+        struct Checking {
+            static constexpr const char* NAME = "Checking";
+
+            template <typename Bytes, typename Call>
+            static decltype(auto) invoke(Site& site, Bytes&&, Call&& call) {
+                if constexpr (std::is_void_v<decltype(call())>) {
+                    call();
+                    check(site);
+                }
+                else {
+                    decltype(auto) result = call();
+                    check(site);
+                    return result;
+                }
+            }
+
+        private:
+            static void check(const Site& site) noexcept {
+                for (GLenum error = glGetError(); error != GL_NO_ERROR; error = glGetError()) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "GL::{}: {} ({})", site.zone.name, errorString(error), error);
+                }
+            }
+
+            static const char* errorString(GLenum error) noexcept {
+                switch (error) {
+                case GL_INVALID_ENUM:                   return "GL_INVALID_ENUM";
+                case GL_INVALID_VALUE:                  return "GL_INVALID_VALUE";
+                case GL_INVALID_OPERATION:              return "GL_INVALID_OPERATION";
+                case GL_INVALID_FRAMEBUFFER_OPERATION:  return "GL_INVALID_FRAMEBUFFER_OPERATION";
+                case GL_OUT_OF_MEMORY:                  return "GL_OUT_OF_MEMORY";
+                case GL_STACK_UNDERFLOW:                return "GL_STACK_UNDERFLOW";
+                case GL_STACK_OVERFLOW:                 return "GL_STACK_OVERFLOW";
+                default:                                return "unknown error";
+                }
+            }
+        };
+
+        /**
+         * @brief Opens a profiler zone named after the wrapper around the call.
+         */
+        struct Tracing {
+            static constexpr const char* NAME = "Tracing";
+
+            template <typename Bytes, typename Call>
+            static decltype(auto) invoke(Site& site, Bytes&&, Call&& call) {
+                Profiler::Zone zone(site.zone);
+                return call();
+            }
+        };
+
+        using Active = GEMENGINE_GL_POLICY;
+
+    } // namespace GLPolicy
+
+} // namespace Gem
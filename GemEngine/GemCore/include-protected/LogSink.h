@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Gem/Core/Logger.h>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace Gem {
+
+    namespace LogFormat {
+
+        /**
+         * @brief Returns the short tag printed for a level (e.g. "WARN").
+         */
+        [[nodiscard]] const char* level_string(Logger::LogLevel level) noexcept;
+
+        /**
+         * @brief Returns the ANSI color escape used for a level on the console.
+         */
+        [[nodiscard]] const char* level_color(Logger::LogLevel level) noexcept;
+
+        inline constexpr const char* RESET_COLOR = "\033[0m";
+
+    } // namespace LogFormat
+
+    /**
+     * @class LogSink
+     * @brief Destination for log lines written by the asynchronous logger.
+     *
+     * Sinks are only ever touched by the logger's drain thread. write() appends to an
+     * internal batch; nothing reaches the OS until flush() is called.
+     */
+    class LogSink {
+    public:
+        virtual ~LogSink() = default;
+
+        /**
+         * @brief Appends one formatted record to the pending batch.
+         *
+         * @param level The record level.
+         * @param timestamp Pre-formatted "YYYY-MM-DD HH:MM:SS" string.
+         * @param message The already formatted message text.
+         */
+        virtual void write(Logger::LogLevel level, std::string_view timestamp, std::string_view message) = 0;
+
+        /**
+         * @brief Writes the pending batch and flushes the underlying stream.
+         */
+        virtual void flush() = 0;
+    };
+
+    /**
+     * @class ConsoleSink
+     * @brief Writes ANSI-colored lines to stdout, matching the synchronous logger output.
+     */
+    class ConsoleSink : public LogSink {
+    public:
+        void write(Logger::LogLevel level, std::string_view timestamp, std::string_view message) override;
+        void flush() override;
+
+    private:
+        std::string batch_;
+    };
+
+    /**
+     * @class RotatingFileSink
+     * @brief Writes plain lines to a file, rotating it once it grows past a size limit.
+     *
+     * On rotation "log.txt" becomes "log.txt.1", "log.txt.1" becomes "log.txt.2", and so on,
+     * keeping at most @p max_files old files.
+     */
+    class RotatingFileSink : public LogSink {
+    public:
+        /**
+         * @brief Opens (appends to) the log file.
+         *
+         * @param path Path of the active log file.
+         * @param max_file_size Size in bytes after which the file is rotated (0 = never).
+         * @param max_files Number of rotated files to keep.
+         */
+        RotatingFileSink(std::string path, std::size_t max_file_size, std::size_t max_files);
+        ~RotatingFileSink() override;
+
+        void write(Logger::LogLevel level, std::string_view timestamp, std::string_view message) override;
+        void flush() override;
+
+        /**
+         * @brief Returns true if the file could be opened.
+         */
+        [[nodiscard]] bool is_open() const noexcept;
+
+        // No copy/move
+        RotatingFileSink(const RotatingFileSink&) = delete;
+        RotatingFileSink& operator=(const RotatingFileSink&) = delete;
+
+    private:
+        void rotate();
+
+        std::string path_;
+        std::size_t max_file_size_;
+        std::size_t max_files_;
+        std::size_t file_size_ = 0;
+        std::FILE* file_ = nullptr;
+        std::string batch_;
+    };
+
+} // namespace Gem
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Gem {
+
+    /**
+     * @class MPSCQueue
+     * @brief A bounded, lock-free multi-producer / single-consumer ring buffer.
+     *
+     * Every slot carries its own sequence number (Vyukov's bounded queue), so producers
+     * only race on the enqueue cursor and never take a lock. A single consumer drains the
+     * queue in FIFO order. The capacity is rounded up to the next power of two.
+     *
+     * Slots are reused in place: produce()/consume() hand out a reference to the slot
+     * value so callers can recycle heap capacity (e.g. std::string) instead of moving it.
+     */
+    template <typename T>
+    class MPSCQueue {
+    public:
+        /**
+         * @brief Constructs the queue.
+         * @param capacity Minimum number of slots (rounded up to a power of two, at least 2).
+         */
+        explicit MPSCQueue(std::size_t capacity) {
+            std::size_t size = 2;
+            while (size < capacity) {
+                size <<= 1;
+            }
+
+            mask_ = size - 1;
+            slots_ = std::make_unique<Slot[]>(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Tries to claim a slot and lets the caller fill it in place.
+         *
+         * @param writer Callable invoked as writer(T&) on the claimed slot.
+         * @return False if the queue is full (the writer is not called).
+         */
+        template <typename Writer>
+        bool try_produce(Writer&& writer) noexcept {
+            std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+            for (;;) {
+                Slot& slot = slots_[pos & mask_];
+                std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0) {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        writer(slot.value);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0) {
+                    return false; // Full
+                }
+                else {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Pushes a value by copy/move.
+         * @return False if the queue is full.
+         */
+        template <typename U>
+        bool try_push(U&& value) noexcept {
+            return try_produce([&](T& slot) { slot = std::forward<U>(value); });
+        }
+
+        /**
+         * @brief Pops the oldest value and lets the caller consume it in place.
+         *
+         * Must only be called from the single consumer thread.
+         *
+         * @param reader Callable invoked as reader(T&) on the oldest slot.
+         * @return False if the queue is empty (the reader is not called).
+         */
+        template <typename Reader>
+        bool try_consume(Reader&& reader) noexcept {
+            Slot& slot = slots_[dequeue_pos_ & mask_];
+            std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+
+            if (seq != dequeue_pos_ + 1) {
+                return false; // Empty, or the producer has not finished writing yet
+            }
+
+            reader(slot.value);
+            slot.sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+            ++dequeue_pos_;
+            return true;
+        }
+
+        /**
+         * @brief Returns the number of slots.
+         */
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return mask_ + 1;
+        }
+
+        // No copy/move
+        MPSCQueue(const MPSCQueue&) = delete;
+        MPSCQueue& operator=(const MPSCQueue&) = delete;
+        MPSCQueue(MPSCQueue&&) = delete;
+        MPSCQueue& operator=(MPSCQueue&&) = delete;
+
+    private:
+        struct Slot {
+            std::atomic<std::size_t> sequence{ 0 };
+            T value{};
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t mask_ = 0;
+
+        alignas(64) std::atomic<std::size_t> enqueue_pos_{ 0 }; ///< Shared producer cursor.
+        alignas(64) std::size_t dequeue_pos_ = 0;               ///< Consumer-only cursor.
+    };
+
+} // namespace Gem
@@ -0,0 +1,110 @@
+#pragma once
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Gem {
+
+    /**
+     * @class NullBackend
+     * @brief A GL driver and window system that do nothing, to measure the engine's own CPU cost.
+     *
+     * Enabled by GemEngine::init() (Config::null_backend, or GEM_NULL_BACKEND=<frames>). The GL
+     * side is a GLAD proc table: the Gem::GL wrappers, their state cache, capture and policy run
+     * unchanged, only the driver call at the bottom is replaced. Draws, uploads and state changes
+     * are discarded, but objects behave like a core context's: generated names are unique and
+     * never reused, deleting or binding a name that is not alive sets GL_INVALID_OPERATION /
+     * GL_INVALID_VALUE (read back with glGetError, per thread), shaders compile and programs link,
+     * uniform locations are stable per program and name, fences are signaled at once, queries
+     * return 0 and mapped buffers are backed by memory. Only the entry points the wrappers call
+     * are provided; GLAD leaves the others null.
+     *
+     * The GLFW side backs the Gem::GLFW wrappers with windows that only exist in memory: one
+     * context each, shared by all, no input. After Config::null_frame_limit swaps a window sets
+     * its close flag, so an unchanged main loop ends by itself.
+     *
+     * Once enabled the backend stays in place for the rest of the process (GLAD keeps pointing
+     * to it), so windows and objects outliving GemEngine::shutdown() are still released cleanly.
+     */
+    class NullBackend {
+    public:
+        /**
+         * @brief State of a window created while the backend is enabled.
+         */
+        struct Window {
+            std::string title;
+            int width = 0;
+            int height = 0;
+            void* user_pointer = nullptr;
+            int should_close = GLFW_FALSE;
+            bool resized = false;               ///< Size callbacks are due at the next poll_events()
+            double cursor_x = 0.0;
+            double cursor_y = 0.0;
+            std::uint32_t frames = 0;           ///< Swaps so far
+            GLFWframebuffersizefun framebuffer_size_callback = nullptr;
+            GLFWwindowsizefun window_size_callback = nullptr;
+            GLFWwindowclosefun window_close_callback = nullptr;
+        };
+
+        /**
+         * @brief Switches the Gem::GLFW wrappers to null windows. Load GLAD with getProcAddress() next.
+         *
+         * @param frame_limit Windows ask to close after this many swaps (0 = never).
+         */
+        static void enable(std::uint32_t frame_limit = 0);
+
+        /**
+         * @brief Checks if the backend is in place. Tested by the Gem::GLFW wrappers.
+         */
+        [[nodiscard]] static bool isEnabled() noexcept {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Loader passed to GLAD: the null implementation of @p name, or nullptr.
+         */
+        static void* getProcAddress(const char* name);
+
+        /**
+         * @brief GL objects (buffers, textures, programs, fences...) generated and not yet deleted.
+         * Compare before and after a benchmark to catch leaks.
+         */
+        [[nodiscard]] static std::size_t getLiveObjectCount();
+
+        static GLFWwindow* createWindow(int width, int height, const char* title);
+        static void destroyWindow(GLFWwindow* window);
+
+        /**
+         * @brief The state behind @p window, or nullptr if it is not a live null window.
+         */
+        [[nodiscard]] static Window* getWindow(GLFWwindow* window);
+
+        /**
+         * @brief Window current on the calling thread (make_context_current / get_current_context).
+         */
+        static void makeContextCurrent(GLFWwindow* window) noexcept;
+        [[nodiscard]] static GLFWwindow* getCurrentContext() noexcept;
+
+        /**
+         * @brief Counts the frame and sets the close flag when the frame limit is reached.
+         */
+        static void swapBuffers(GLFWwindow* window);
+
+        /**
+         * @brief Runs the size and close callbacks due since the last call.
+         */
+        static void pollEvents();
+
+    private:
+        NullBackend() = delete;  // no instances
+        ~NullBackend() = delete;
+
+        static std::atomic<bool> enabled_;
+    };
+
+} // namespace Gem
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Gem {
+
+    /**
+     * @class WorkStealingDeque
+     * @brief A bounded Chase-Lev work-stealing deque of pointers.
+     *
+     * The owner thread pushes and pops at the bottom (LIFO, cache-warm); any other thread
+     * steals from the top (FIFO, oldest and usually largest work first). Only the last
+     * element is contended, and that race is settled with a single CAS on top_.
+     *
+     * Memory orderings follow Lê, Pop, Cohen & Zappa Nardelli, "Correct and Efficient
+     * Work-Stealing for Weak Memory Models" (PPoPP 2013). The buffer does not grow: the
+     * capacity is rounded up to the next power of two and push() fails when it is full.
+     */
+    template <typename T>
+    class WorkStealingDeque {
+    public:
+        /**
+         * @brief Constructs the deque.
+         * @param capacity Minimum number of elements (rounded up to a power of two, at least 2).
+         */
+        explicit WorkStealingDeque(std::size_t capacity) {
+            std::size_t size = 2;
+            while (size < capacity) {
+                size <<= 1;
+            }
+
+            mask_ = static_cast<std::int64_t>(size - 1);
+            buffer_ = std::make_unique<std::atomic<T*>[]>(size);
+        }
+
+        /**
+         * @brief Pushes at the bottom. Owner thread only.
+         * @return False if the deque is full.
+         */
+        bool push(T* item) noexcept {
+            std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+            std::int64_t top = top_.load(std::memory_order_acquire);
+            if (bottom - top > mask_) {
+                return false;
+            }
+
+            buffer_[bottom & mask_].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Pops the most recently pushed element. Owner thread only.
+         * @return nullptr if the deque is empty or a thief took the last element.
+         */
+        T* pop() noexcept {
+            std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+            bottom_.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = top_.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                bottom_.store(bottom + 1, std::memory_order_relaxed);  // Empty
+                return nullptr;
+            }
+
+            T* item = buffer_[bottom & mask_].load(std::memory_order_relaxed);
+            if (top == bottom) {
+                // Last element: race the thieves for it
+                if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+                bottom_.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * @brief Takes the oldest element. Any thread.
+         * @return nullptr if the deque is empty or another thread won the race.
+         */
+        T* steal() noexcept {
+            std::int64_t top = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+            if (top >= bottom) {
+                return nullptr;
+            }
+
+            T* item = buffer_[top & mask_].load(std::memory_order_relaxed);
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return item;
+        }
+
+        /**
+         * @brief Approximate number of elements (exact only when called by the owner with no thieves).
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            std::int64_t count = bottom_.load(std::memory_order_relaxed) - top_.load(std::memory_order_relaxed);
+            return count > 0 ? static_cast<std::size_t>(count) : 0;
+        }
+
+        // No copy/move
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    private:
+        std::unique_ptr<std::atomic<T*>[]> buffer_;
+        std::int64_t mask_ = 0;
+
+        alignas(64) std::atomic<std::int64_t> top_{ 0 };    ///< Thieves' end.
+        alignas(64) std::atomic<std::int64_t> bottom_{ 0 }; ///< Owner's end.
+    };
+
+} // namespace Gem
@@ -5,7 +5,9 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Gem {
 
@@ -21,6 +23,13 @@ namespace Gem {
 		*/
 		int init();
 
+		/**
+		* @brief Initializes GLAD with another loader (e.g. eglGetProcAddress for headless contexts).
+		*
+		* @param loader Function returning the address of an OpenGL function by name.
+		*/
+		int init(GLADloadproc loader);
+
 		/**
 		 * @brief Retrieves the OpenGL version string.
 		 *
@@ -92,6 +101,17 @@ namespace Gem {
 		*/
 		GLFWwindow* create_window(int width, int height, const std::string& title);
 
+		/**
+		* @brief Creates a GLFW window whose context shares objects with another window's context.
+		*
+		* @param width Window width in pixels.
+		* @param height Window height in pixels.
+		* @param title Window title.
+		* @param share Window whose context objects (buffers, textures, sync objects...) are shared.
+		* @return Pointer to the created GLFWwindow, or nullptr on failure.
+		*/
+		GLFWwindow* create_window(int width, int height, const std::string& title, GLFWwindow* share);
+
 		/**
 		* @brief Makes the specified window's context current.
 		*
@@ -99,6 +119,13 @@ namespace Gem {
 		*/
 		void make_context_current(GLFWwindow* window);
 
+		/**
+		* @brief Returns the window whose context is current on the calling thread.
+		*
+		* @return Pointer to the GLFWwindow, or nullptr if no context is current.
+		*/
+		GLFWwindow* get_current_context();
+
 		/**
 		* @brief Sets the swap interval for the current context (enables/disables VSync).
 		*
@@ -301,6 +328,7 @@ namespace Gem {
 		 *
 		 * This function swaps the front and back buffers of the specified window. If the window
 		 * has more than one buffer, this function will also update the display.
+		 * Ends the frame of a running GLCapture.
 		 *
 		 * @param window The window whose buffers to swap.
 		 */
@@ -331,6 +359,24 @@ namespace Gem {
          */
         GLint get_uniform_location(GLuint program, const std::string& name);
 
+        /**
+         * @brief Retrieves the index of a named uniform block within a shader program.
+         *
+         * @param program The shader program object.
+         * @param name The name of the uniform block.
+         * @return The index of the block, or GL_INVALID_INDEX if not found.
+         */
+        GLuint get_uniform_block_index(GLuint program, const std::string& name);
+
+        /**
+         * @brief Assigns a uniform block of a program to a uniform buffer binding point.
+         *
+         * @param program The shader program object.
+         * @param index The index of the block (see get_uniform_block_index()).
+         * @param binding The binding point (see bind_buffer_base() / bind_buffer_range()).
+         */
+        void uniform_block_binding(GLuint program, GLuint index, GLuint binding);
+
 
         /**
          * @brief Sets the value of a mat2 uniform variable in a shader program.
@@ -925,6 +971,94 @@ namespace Gem {
          */
         void buffer_data(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
 
+        /**
+         * @brief Updates a subset of the data store of the buffer bound to a target.
+         *
+         * @param target Specifies the target buffer object.
+         * @param offset Specifies the offset into the data store where replacement starts, in bytes.
+         * @param size Specifies the size in bytes of the data store region being replaced.
+         * @param data Specifies a pointer to the new data.
+         */
+        void buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+
+        /**
+         * @brief Copies a range of one buffer's data store into another, on the GPU.
+         *
+         * Bind the source and destination to GL_COPY_READ_BUFFER and GL_COPY_WRITE_BUFFER first so
+         * no other binding is disturbed. The two ranges may only overlap if both targets hold different buffers.
+         *
+         * @param readTarget Specifies the target the source buffer is bound to.
+         * @param writeTarget Specifies the target the destination buffer is bound to.
+         * @param readOffset Specifies the offset of the range in the source, in bytes.
+         * @param writeOffset Specifies the offset of the range in the destination, in bytes.
+         * @param size Specifies the size of the range, in bytes.
+         */
+        void copy_buffer_sub_data(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+
+        /**
+         * @brief Creates an immutable data store for the buffer bound to a target (GL 4.4 / ARB_buffer_storage).
+         *
+         * @param target Specifies the target buffer object.
+         * @param size Specifies the size in bytes of the data store. It cannot change afterwards.
+         * @param data Specifies a pointer to data copied into the store, or nullptr.
+         * @param flags Specifies what the store allows (GL_MAP_WRITE_BIT, GL_MAP_PERSISTENT_BIT, GL_MAP_COHERENT_BIT, GL_DYNAMIC_STORAGE_BIT...).
+         */
+        void buffer_storage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
+        /**
+         * @brief Maps a range of the data store of the buffer bound to a target into client memory.
+         *
+         * Not recorded by GLCapture: report what is written through persistent mappings with
+         * mark_mapped_write().
+         *
+         * @param target Specifies the target buffer object.
+         * @param offset Specifies the start of the range, in bytes.
+         * @param length Specifies the length of the range, in bytes.
+         * @param access Specifies the access (GL_MAP_WRITE_BIT, GL_MAP_PERSISTENT_BIT, GL_MAP_COHERENT_BIT...).
+         * @return The address of the range, or nullptr on failure.
+         */
+        void* map_buffer_range(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+
+        /**
+         * @brief Releases the mapping of the buffer bound to a target.
+         *
+         * @return GL_FALSE if the data store was corrupted while mapped (its contents are undefined).
+         */
+        GLboolean unmap_buffer(GLenum target);
+
+        /**
+         * @brief Reports bytes written through a persistent mapping, for GLCapture.
+         *
+         * While capturing, the range is read and recorded before the next draw call on this
+         * thread, so the replay sees the data the draw saw. No-op when not capturing.
+         *
+         * @param buffer Specifies the buffer object name.
+         * @param offset Specifies the offset of the written range in the buffer, in bytes.
+         * @param size Specifies the size of the range, in bytes.
+         * @param mapped Specifies the address of the range in the mapping.
+         */
+        void mark_mapped_write(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* mapped);
+
+        /**
+         * @brief Binds a range of a buffer to an indexed binding point (e.g., GL_UNIFORM_BUFFER).
+         *
+         * @param target Specifies the indexed target (GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER...).
+         * @param index Specifies the binding point index.
+         * @param buffer Specifies the buffer object name.
+         * @param offset Specifies the starting offset in bytes (a multiple of the target's offset alignment).
+         * @param size Specifies the size of the range, in bytes.
+         */
+        void bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+        /**
+         * @brief Binds a whole buffer to an indexed binding point (e.g., GL_UNIFORM_BUFFER).
+         *
+         * @param target Specifies the indexed target (GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER...).
+         * @param index Specifies the binding point index.
+         * @param buffer Specifies the buffer object name.
+         */
+        void bind_buffer_base(GLenum target, GLuint index, GLuint buffer);
+
         /**
          * @brief Deletes named buffer objects.
          *
@@ -987,6 +1121,238 @@ namespace Gem {
          */
         void delete_vertex_arrays(GLsizei n, const GLuint* arrays);
 
+        //|========================================================= Direct state access =========================================================================================
+
+        /**
+         * @brief Checks if the context supports direct state access (GL 4.5 or ARB_direct_state_access).
+         *
+         * Objects made with the create_* functions below may be used with either path, but names
+         * from the gen_* functions have no object until first bound: do not pass them to the named
+         * functions. Pick one path per object when it is created.
+         */
+        bool has_direct_state_access() noexcept;
+
+        /**
+         * @brief Creates buffer objects, initialized as if bound once (glCreateBuffers).
+         *
+         * @param n Specifies the number of buffer objects to create.
+         * @param buffers Specifies an array in which the names of the new buffer objects are stored.
+         */
+        void create_buffers(GLsizei n, GLuint* buffers);
+
+        /**
+         * @brief Creates and initializes the data store of a buffer object, without binding it.
+         *
+         * @param buffer Specifies the buffer object name.
+         * @param size Specifies the size in bytes of the data store.
+         * @param data Specifies a pointer to data copied into the store, or nullptr.
+         * @param usage Specifies the expected usage pattern of the data store (e.g., GL_STATIC_DRAW).
+         */
+        void named_buffer_data(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage);
+
+        /**
+         * @brief Creates an immutable data store for a buffer object, without binding it.
+         *
+         * @param buffer Specifies the buffer object name.
+         * @param size Specifies the size in bytes of the data store. It cannot change afterwards.
+         * @param data Specifies a pointer to data copied into the store, or nullptr.
+         * @param flags Specifies what the store allows (GL_DYNAMIC_STORAGE_BIT, GL_MAP_WRITE_BIT... 0 for static data).
+         */
+        void named_buffer_storage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags);
+
+        /**
+         * @brief Updates a subset of the data store of a buffer object, without binding it.
+         *
+         * @param buffer Specifies the buffer object name.
+         * @param offset Specifies the offset into the data store, in bytes.
+         * @param size Specifies the size in bytes of the data being replaced.
+         * @param data Specifies a pointer to the new data.
+         */
+        void named_buffer_sub_data(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data);
+
+        /**
+         * @brief Copies a range of one buffer object's data store into another, without binding them.
+         *
+         * @param readBuffer Specifies the source buffer object name.
+         * @param writeBuffer Specifies the destination buffer object name.
+         * @param readOffset Specifies the offset of the range in the source, in bytes.
+         * @param writeOffset Specifies the offset of the range in the destination, in bytes.
+         * @param size Specifies the size of the range, in bytes.
+         */
+        void copy_named_buffer_sub_data(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+
+        /**
+         * @brief Creates vertex array objects, initialized as if bound once (glCreateVertexArrays).
+         *
+         * @param n Specifies the number of vertex array objects to create.
+         * @param arrays Specifies an array in which the names of the new vertex array objects are stored.
+         */
+        void create_vertex_arrays(GLsizei n, GLuint* arrays);
+
+        /**
+         * @brief Attaches a buffer to a vertex buffer binding point of a vertex array object.
+         *
+         * @param vaobj Specifies the vertex array object name.
+         * @param bindingindex Specifies the vertex buffer binding point.
+         * @param buffer Specifies the buffer object name.
+         * @param offset Specifies the offset of the first vertex in the buffer, in bytes.
+         * @param stride Specifies the distance between vertices, in bytes (0 is not "tightly packed" here).
+         */
+        void vertex_array_vertex_buffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride);
+
+        /**
+         * @brief Attaches a buffer as the element (index) buffer of a vertex array object.
+         *
+         * @param vaobj Specifies the vertex array object name.
+         * @param buffer Specifies the buffer object name.
+         */
+        void vertex_array_element_buffer(GLuint vaobj, GLuint buffer);
+
+        /**
+         * @brief Specifies the data format of a generic vertex attribute of a vertex array object.
+         *
+         * @param vaobj Specifies the vertex array object name.
+         * @param attribindex Specifies the generic vertex attribute index.
+         * @param size Specifies the number of components per attribute.
+         * @param type Specifies the data type of each component.
+         * @param normalized Specifies whether fixed-point data values should be normalized.
+         * @param relativeoffset Specifies the offset of the attribute within a vertex, in bytes.
+         */
+        void vertex_array_attrib_format(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
+
+        /**
+         * @brief Associates a generic vertex attribute with a vertex buffer binding point.
+         *
+         * @param vaobj Specifies the vertex array object name.
+         * @param attribindex Specifies the generic vertex attribute index.
+         * @param bindingindex Specifies the vertex buffer binding point.
+         */
+        void vertex_array_attrib_binding(GLuint vaobj, GLuint attribindex, GLuint bindingindex);
+
+        /**
+         * @brief Enables a generic vertex attribute array of a vertex array object, without binding it.
+         *
+         * @param vaobj Specifies the vertex array object name.
+         * @param index Specifies the index of the generic vertex attribute to be enabled.
+         */
+        void enable_vertex_array_attrib(GLuint vaobj, GLuint index);
+
+        /**
+         * @brief Creates texture objects of a target (glCreateTextures).
+         *
+         * @param target Specifies the texture target (e.g., GL_TEXTURE_2D). It cannot change afterwards.
+         * @param n Specifies the number of texture objects to create.
+         * @param textures Specifies an array in which the names of the new texture objects are stored.
+         */
+        void create_textures(GLenum target, GLsizei n, GLuint* textures);
+
+        /**
+         * @brief Sets a texture parameter, without binding the texture.
+         *
+         * @param texture Specifies the texture object name.
+         * @param pname Specifies the parameter (e.g., GL_TEXTURE_MIN_FILTER).
+         * @param param Specifies the value of pname.
+         */
+        void texture_parameteri(GLuint texture, GLenum pname, GLint param);
+
+        /**
+         * @brief Allocates immutable storage for all levels of a 1D texture.
+         *
+         * @param texture Specifies the texture object name.
+         * @param levels Specifies the number of mipmap levels.
+         * @param internalformat Specifies the sized internal format (e.g., GL_RGBA8).
+         * @param width Specifies the width of the base level.
+         */
+        void texture_storage_1d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width);
+
+        /**
+         * @brief Allocates immutable storage for all levels of a 2D (or 1D array) texture.
+         *
+         * @param texture Specifies the texture object name.
+         * @param levels Specifies the number of mipmap levels.
+         * @param internalformat Specifies the sized internal format (e.g., GL_RGBA8).
+         * @param width Specifies the width of the base level.
+         * @param height Specifies the height of the base level.
+         */
+        void texture_storage_2d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+
+        /**
+         * @brief Allocates immutable storage for all levels of a 3D (or 2D array) texture.
+         *
+         * @param texture Specifies the texture object name.
+         * @param levels Specifies the number of mipmap levels.
+         * @param internalformat Specifies the sized internal format (e.g., GL_RGBA8).
+         * @param width Specifies the width of the base level.
+         * @param height Specifies the height of the base level.
+         * @param depth Specifies the depth of the base level, or the number of layers.
+         */
+        void texture_storage_3d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth);
+
+        /**
+         * @brief Uploads a region of a level of a 1D texture, without binding it.
+         *
+         * @param texture Specifies the texture object name.
+         * @param level Specifies the mipmap level.
+         * @param xoffset Specifies the texel offset of the region.
+         * @param width Specifies the width of the region.
+         * @param format Specifies the format of the pixel data (e.g., GL_RGBA).
+         * @param type Specifies the data type of the pixel data (e.g., GL_UNSIGNED_BYTE).
+         * @param pixels Specifies a pointer to the image data in memory.
+         */
+        void texture_sub_image_1d(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels);
+
+        /**
+         * @brief Uploads a region of a level of a 2D texture, without binding it.
+         *
+         * @param texture Specifies the texture object name.
+         * @param level Specifies the mipmap level.
+         * @param xoffset Specifies the texel offset of the region in x.
+         * @param yoffset Specifies the texel offset of the region in y.
+         * @param width Specifies the width of the region.
+         * @param height Specifies the height of the region.
+         * @param format Specifies the format of the pixel data (e.g., GL_RGBA).
+         * @param type Specifies the data type of the pixel data (e.g., GL_UNSIGNED_BYTE).
+         * @param pixels Specifies a pointer to the image data in memory.
+         */
+        void texture_sub_image_2d(GLuint texture, GLint level, GLint xoffset, GLint yoffset,
+            GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels);
+
+        /**
+         * @brief Uploads a region of a level of a 3D (or 2D array) texture, without binding it.
+         *
+         * @param texture Specifies the texture object name.
+         * @param level Specifies the mipmap level.
+         * @param xoffset Specifies the texel offset of the region in x.
+         * @param yoffset Specifies the texel offset of the region in y.
+         * @param zoffset Specifies the texel offset of the region in z, or the first layer.
+         * @param width Specifies the width of the region.
+         * @param height Specifies the height of the region.
+         * @param depth Specifies the depth of the region, or the number of layers.
+         * @param format Specifies the format of the pixel data (e.g., GL_RGBA).
+         * @param type Specifies the data type of the pixel data (e.g., GL_UNSIGNED_BYTE).
+         * @param pixels Specifies a pointer to the image data in memory.
+         */
+        void texture_sub_image_3d(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+            GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels);
+
+        /**
+         * @brief Generates the mipmaps of a texture, without binding it.
+         *
+         * @param texture Specifies the texture object name.
+         */
+        void generate_texture_mipmap(GLuint texture);
+
+        /**
+         * @brief Binds a texture to a texture unit, without changing the active unit.
+         *
+         * glBindTextureUnit takes no target; @p target is the texture's own, for the state cache.
+         *
+         * @param unit Specifies the texture unit index (0 for GL_TEXTURE0).
+         * @param target Specifies the target the texture was created with (e.g., GL_TEXTURE_2D).
+         * @param texture Specifies the texture object name.
+         */
+        void bind_texture_unit(GLuint unit, GLenum target, GLuint texture);
+
         /**
          * @brief Creates a new program object.
          *
@@ -1174,6 +1540,19 @@ namespace Gem {
          */
         void draw_elements(GLenum mode, GLsizei count, GLenum type, const void* indices);
 
+        /**
+         * @brief Renders indexed primitives, adding a constant to every index (GL 3.2).
+         *
+         * Lets meshes packed in shared buffers keep indices relative to their own first vertex.
+         *
+         * @param mode Specifies what kind of primitives to render (e.g., GL_TRIANGLES).
+         * @param count Specifies the number of elements to be rendered.
+         * @param type Specifies the type of the values in indices (e.g., GL_UNSIGNED_INT).
+         * @param indices Specifies the offset of the first index in the bound element buffer.
+         * @param basevertex Specifies the constant added to each index before fetching the vertex.
+         */
+        void draw_elements_base_vertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex);
+
         /**
          * @brief Enables or disables server-side GL capabilities.
          *
@@ -1192,6 +1571,28 @@ namespace Gem {
          */
         void disable(GLenum cap);
 
+        /**
+         * @brief Specifies which faces are culled when GL_CULL_FACE is enabled.
+         *
+         * @param mode GL_FRONT, GL_BACK or GL_FRONT_AND_BACK.
+         */
+        void cull_face(GLenum mode);
+
+        /**
+         * @brief Defines the winding of front-facing polygons.
+         *
+         * @param mode GL_CW or GL_CCW.
+         */
+        void front_face(GLenum mode);
+
+        /**
+         * @brief Specifies the blending factors used when GL_BLEND is enabled.
+         *
+         * @param sfactor Factor applied to the source color (e.g., GL_SRC_ALPHA).
+         * @param dfactor Factor applied to the destination color (e.g., GL_ONE_MINUS_SRC_ALPHA).
+         */
+        void blend_func(GLenum sfactor, GLenum dfactor);
+
         /**
          * @brief Retrieves error information.
          *
@@ -1201,6 +1602,288 @@ namespace Gem {
          */
         GLenum get_error();
 
+        //|========================================================= Queries =========================================================================================
+
+        /**
+         * @brief Generates query object names.
+         *
+         * @param n Specifies the number of query object names to be generated.
+         * @param ids Specifies an array in which the generated query object names are stored.
+         */
+        void gen_queries(GLsizei n, GLuint* ids);
+
+        /**
+         * @brief Deletes named query objects.
+         *
+         * @param n Specifies the number of query objects to be deleted.
+         * @param ids Specifies an array of query objects to be deleted.
+         */
+        void delete_queries(GLsizei n, const GLuint* ids);
+
+        /**
+         * @brief Delimits the start of a query (e.g., GL_TIME_ELAPSED, GL_SAMPLES_PASSED, pipeline statistics).
+         *
+         * @param target Specifies the target type of query object established between begin_query and end_query.
+         * @param id Specifies the name of a query object.
+         */
+        void begin_query(GLenum target, GLuint id);
+
+        /**
+         * @brief Delimits the end of the active query of @p target.
+         *
+         * @param target Specifies the target type of query object to be concluded.
+         */
+        void end_query(GLenum target);
+
+        /**
+         * @brief Records the GL time into a query object after all previous commands have completed.
+         *
+         * @param id Specifies the name of a query object into which to record the GL time.
+         * @param target Specifies the counter to query. Must be GL_TIMESTAMP.
+         */
+        void query_counter(GLuint id, GLenum target);
+
+        /**
+         * @brief Returns a parameter of a query object (e.g., GL_QUERY_RESULT_AVAILABLE).
+         *
+         * @param id Specifies the name of a query object.
+         * @param pname Specifies the symbolic name of a query object parameter.
+         * @param params Returns the requested data.
+         */
+        void get_query_object_iv(GLuint id, GLenum pname, GLint* params);
+
+        /**
+         * @brief Returns a 64-bit parameter of a query object (e.g., GL_QUERY_RESULT of a timer query, in nanoseconds).
+         *
+         * @param id Specifies the name of a query object.
+         * @param pname Specifies the symbolic name of a query object parameter.
+         * @param params Returns the requested data.
+         */
+        void get_query_object_ui64v(GLuint id, GLenum pname, GLuint64* params);
+
+        /**
+         * @brief Returns the value of a simple state variable.
+         *
+         * @param pname Specifies the parameter value to be returned (e.g., GL_MAJOR_VERSION).
+         * @param data Returns the value or values of the specified parameter.
+         */
+        void get_integerv(GLenum pname, GLint* data);
+
+        /**
+         * @brief Returns the 64-bit value of a simple state variable (e.g., GL_TIMESTAMP).
+         *
+         * @param pname Specifies the parameter value to be returned.
+         * @param data Returns the value or values of the specified parameter.
+         */
+        void get_integer64v(GLenum pname, GLint64* data);
+
+        /**
+         * @brief Checks whether the current context exposes an extension.
+         *
+         * @param name Extension name (e.g., "GL_ARB_pipeline_statistics_query").
+         * @return True if the extension is listed by glGetStringi(GL_EXTENSIONS, i).
+         */
+        bool has_extension(const char* name);
+
+        //|========================================================= Frame buffer objects =========================================================================================
+
+        /**
+         * @brief Generates framebuffer object names.
+         *
+         * @param n Specifies the number of framebuffer object names to generate.
+         * @param framebuffers Specifies an array in which the generated names are stored.
+         */
+        void gen_framebuffers(GLsizei n, GLuint* framebuffers);
+
+        /**
+         * @brief Binds a framebuffer to a framebuffer target.
+         *
+         * @param target Specifies the target (GL_FRAMEBUFFER, GL_READ_FRAMEBUFFER or GL_DRAW_FRAMEBUFFER).
+         * @param framebuffer Specifies the name of the framebuffer object, 0 for the default framebuffer.
+         */
+        void bind_framebuffer(GLenum target, GLuint framebuffer);
+
+        /**
+         * @brief Deletes framebuffer objects.
+         *
+         * @param n Specifies the number of framebuffer objects to be deleted.
+         * @param framebuffers Specifies an array of framebuffer objects to be deleted.
+         */
+        void delete_framebuffers(GLsizei n, const GLuint* framebuffers);
+
+        /**
+         * @brief Checks the completeness status of the framebuffer bound to a target.
+         *
+         * @param target Specifies the target of the framebuffer completeness check.
+         * @return GL_FRAMEBUFFER_COMPLETE if complete, otherwise the reason it is not.
+         */
+        GLenum check_framebuffer_status(GLenum target);
+
+        /**
+         * @brief Attaches a renderbuffer to the framebuffer bound to a target.
+         *
+         * @param target Specifies the framebuffer target.
+         * @param attachment Specifies the attachment point (e.g., GL_COLOR_ATTACHMENT0).
+         * @param renderbuffertarget Must be GL_RENDERBUFFER.
+         * @param renderbuffer Specifies the name of the renderbuffer object to attach.
+         */
+        void framebuffer_renderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+
+        /**
+         * @brief Generates renderbuffer object names.
+         *
+         * @param n Specifies the number of renderbuffer object names to generate.
+         * @param renderbuffers Specifies an array in which the generated names are stored.
+         */
+        void gen_renderbuffers(GLsizei n, GLuint* renderbuffers);
+
+        /**
+         * @brief Binds a renderbuffer to the GL_RENDERBUFFER target.
+         *
+         * @param target Must be GL_RENDERBUFFER.
+         * @param renderbuffer Specifies the name of the renderbuffer object.
+         */
+        void bind_renderbuffer(GLenum target, GLuint renderbuffer);
+
+        /**
+         * @brief Allocates the storage of the bound renderbuffer.
+         *
+         * @param target Must be GL_RENDERBUFFER.
+         * @param internalformat Specifies the internal format (e.g., GL_RGBA8, GL_DEPTH24_STENCIL8).
+         * @param width Specifies the width of the renderbuffer, in pixels.
+         * @param height Specifies the height of the renderbuffer, in pixels.
+         */
+        void renderbuffer_storage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+
+        /**
+         * @brief Deletes renderbuffer objects.
+         *
+         * @param n Specifies the number of renderbuffer objects to be deleted.
+         * @param renderbuffers Specifies an array of renderbuffer objects to be deleted.
+         */
+        void delete_renderbuffers(GLsizei n, const GLuint* renderbuffers);
+
+        /**
+         * @brief Reads a block of pixels from the read framebuffer.
+         *
+         * @param x, y Specify the lower left corner of the block, in pixels.
+         * @param width, height Specify the size of the block, in pixels.
+         * @param format Specifies the format of the pixel data (e.g., GL_RGBA).
+         * @param type Specifies the data type of the pixel data (e.g., GL_UNSIGNED_BYTE).
+         * @param pixels Returns the pixel data.
+         */
+        void read_pixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels);
+
+        //|========================================================= Sync objects =========================================================================================
+
+        /**
+         * @brief Creates a fence sync object and inserts it into the command stream.
+         *
+         * @param condition Must be GL_SYNC_GPU_COMMANDS_COMPLETE.
+         * @param flags Must be 0.
+         * @return The sync object, signaled once every previous command has completed.
+         */
+        GLsync fence_sync(GLenum condition, GLbitfield flags);
+
+        /**
+         * @brief Blocks the calling thread until a sync object is signaled or the timeout expires.
+         *
+         * @param sync Specifies the sync object to wait on.
+         * @param flags 0 or GL_SYNC_FLUSH_COMMANDS_BIT.
+         * @param timeout Timeout in nanoseconds; 0 only polls.
+         * @return GL_ALREADY_SIGNALED, GL_CONDITION_SATISFIED, GL_TIMEOUT_EXPIRED or GL_WAIT_FAILED.
+         */
+        GLenum client_wait_sync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+
+        /**
+         * @brief Deletes a sync object.
+         *
+         * @param sync Specifies the sync object to be deleted.
+         */
+        void delete_sync(GLsync sync);
+
+        /**
+         * @brief Sends the commands queued in the current context to the GPU without waiting for them.
+         */
+        void flush();
+
+        /**
+         * @brief Blocks until every command of the current context has completed.
+         */
+        void finish();
+
+        //|========================================================= State cache =========================================================================================
+
+        /*
+         * bind_buffer, bind_vertex_array, use_program, active_texture and bind_texture keep a
+         * shadow of the current context's bindings and skip calls that would not change them
+         * (counted by the gl.elided_* metrics). Deletions through these wrappers update the shadow.
+         */
+
+        /**
+         * @brief Forgets the shadowed bindings of the calling thread's context.
+         *
+         * Call after GL code that does not go through Gem::GL changes bindings, or after making
+         * another context current without GLFW::make_context_current().
+         */
+        void invalidate_state_cache();
+
+        /**
+         * @brief Enables or disables the skipping of redundant binds (all threads). Enabled by default.
+         *
+         * @param enabled False sends every bind to the driver; the shadow is still kept up to date.
+         */
+        void set_state_cache_enabled(bool enabled);
+
+        /**
+         * @brief Checks if redundant binds are skipped.
+         */
+        bool is_state_cache_enabled();
+
+        //|========================================================= Instrumentation =========================================================================================
+
+        /*
+         * Every driver call goes through the policy selected at compile time by GEMENGINE_GL_POLICY
+         * (see GLPolicy.h): Release (nothing), Counting (calls and bytes per wrapper), Checking
+         * (glGetError after each call, errors logged with the wrapper's name, so get_error() then
+         * reports GL_NO_ERROR) or Tracing (a profiler zone per call).
+         */
+
+        /**
+         * @brief Calls and client-memory bytes of one wrapper, since start or reset_call_stats().
+         */
+        struct CallStats {
+            const char* name;
+            std::uint64_t calls;
+            std::uint64_t bytes;
+        };
+
+        /**
+         * @brief Wrappers called so far, most called first. Empty unless the policy is Counting.
+         */
+        std::vector<CallStats> get_call_stats();
+
+        /**
+         * @brief Zeroes the counts read by get_call_stats().
+         */
+        void reset_call_stats();
+
+        /**
+         * @brief Logs get_call_stats() at info level, one line per wrapper.
+         */
+        void log_call_stats();
+
+        /**
+         * @brief Writes get_call_stats() as CSV: name, calls, bytes. Unlike the log, it is kept in Dist.
+         * @return False if nothing was counted or the file could not be written.
+         */
+        bool export_call_stats(const std::string& path);
+
+        /**
+         * @brief Name of the policy compiled in ("Release", "Counting", "Checking" or "Tracing").
+         */
+        const char* get_instrumentation_policy();
+
     } // namespace GL
 
 
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <Gem/Core/FormatString.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/TscClock.h>
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief Records a binary log entry from this call site.
+ *
+ * Usage: GEM_BINARY_LOG(Gem::Logger::LogLevel::Debug, "Frame {} took {} ms", frame, ms);
+ *
+ * The format string is checked at compile time like Logger's. The level is part of the
+ * call site's definition, so it must be the same every time the line runs.
+ */
+#define GEM_BINARY_LOG(level, ...)                                              \
+    do {                                                                        \
+        static ::Gem::BinaryLog::Site gem_binary_log_site_;                     \
+        ::Gem::BinaryLog::write(gem_binary_log_site_, level, __VA_ARGS__);      \
+    } while (0)
+
+namespace Gem {
+
+    /**
+     * @brief On-disk layout shared by BinaryLog and the offline decoder (GemLogDecoder).
+     *
+     * File   : FileHeader, then records back to back (each padded to 8 bytes).
+     * Record : RecordHeader, then the payload. The size is written when the space is
+     *          reserved and the format id last, so format_id == UNCOMMITTED_ID is a record
+     *          whose writer never finished it (e.g. crashed): skip it. A size of 0 is space
+     *          reserved but not even sized yet; only zeros follow the end of the data.
+     * Timestamps are raw TscClock::ticks(), converted with the FileHeader's sample.
+     * Format definition (format_id == DEFINITION_ID) payload:
+     *          u32 id, u8 level, u8 arg count, u16 format length, arg types, format text.
+     * Message payload: the arguments in order. Fixed-size types are stored raw,
+     *          strings as a u32 length followed by the bytes.
+     */
+    namespace BinaryLogFormat {
+
+        inline constexpr char MAGIC[8] = { 'G', 'E', 'M', 'B', 'L', 'O', 'G', '\0' };
+        inline constexpr std::uint32_t VERSION = 2;
+        inline constexpr std::uint32_t UNCOMMITTED_ID = 0;
+        inline constexpr std::uint32_t DEFINITION_ID = 1;
+        inline constexpr std::size_t MAX_STRING_LENGTH = 0xFFFF;
+
+        /**
+         * @brief How one argument is stored.
+         */
+        enum class ArgType : std::uint8_t {
+            Bool, Char,
+            Int16, Int32, Int64,
+            UInt16, UInt32, UInt64,
+            Float, Double,
+            Pointer,
+            String
+        };
+
+        struct FileHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t header_size;
+            std::int64_t system_time_ns;   ///< Wall clock when the file was opened.
+            std::int64_t steady_time_ns;   ///< Steady clock at the same instant.
+            std::int64_t ticks;            ///< TscClock::ticks() at the same instant.
+            double ticks_per_second;       ///< TscClock::getTicksPerSecond().
+        };
+
+        struct RecordHeader {
+            std::uint32_t size;            ///< Whole record, header included; written when reserved.
+            std::uint32_t format_id;       ///< Written last: UNCOMMITTED_ID until the record is complete.
+            std::int64_t ticks;            ///< TscClock::ticks().
+        };
+
+        /**
+         * @brief Converts a record's ticks to steady_clock nanoseconds.
+         */
+        [[nodiscard]] inline std::int64_t to_steady_ns(const FileHeader& header, std::int64_t ticks) noexcept {
+            return header.steady_time_ns + static_cast<std::int64_t>(static_cast<double>(ticks - header.ticks) * 1e9 / header.ticks_per_second);
+        }
+
+        /**
+         * @brief Rounds a record size up to the 8-byte record alignment.
+         */
+        [[nodiscard]] constexpr std::size_t align_record(std::size_t size) noexcept {
+            return (size + 7) & ~static_cast<std::size_t>(7);
+        }
+
+        template <typename T>
+        inline constexpr bool UNSUPPORTED_ARG = false;
+
+        /**
+         * @brief Maps a C++ argument type to its stored type.
+         */
+        template <typename T>
+        [[nodiscard]] constexpr ArgType arg_type_of() noexcept {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (std::is_same_v<Type, bool>) {
+                return ArgType::Bool;
+            }
+            else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> || std::is_same_v<Type, unsigned char>) {
+                return ArgType::Char;
+            }
+            else if constexpr (std::is_enum_v<Type>) {
+                return arg_type_of<std::underlying_type_t<Type>>();
+            }
+            else if constexpr (std::is_integral_v<Type>) {
+                if constexpr (std::is_signed_v<Type>) {
+                    return sizeof(Type) <= 2 ? ArgType::Int16 : sizeof(Type) == 4 ? ArgType::Int32 : ArgType::Int64;
+                }
+                else {
+                    return sizeof(Type) <= 2 ? ArgType::UInt16 : sizeof(Type) == 4 ? ArgType::UInt32 : ArgType::UInt64;
+                }
+            }
+            else if constexpr (std::is_same_v<Type, float>) {
+                return ArgType::Float;
+            }
+            else if constexpr (std::is_floating_point_v<Type>) {
+                return ArgType::Double;
+            }
+            else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+                return ArgType::String;
+            }
+            else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>) {
+                return ArgType::Pointer;
+            }
+            else {
+                static_assert(UNSUPPORTED_ARG<T>, "BinaryLog only records arithmetic, enum, pointer and string arguments");
+                return ArgType::Pointer;
+            }
+        }
+
+        /**
+         * @brief Size in bytes of a fixed-size stored type (0 for String).
+         */
+        [[nodiscard]] constexpr std::size_t fixed_size(ArgType type) noexcept {
+            switch (type) {
+            case ArgType::Bool:
+            case ArgType::Char:    return 1;
+            case ArgType::Int16:
+            case ArgType::UInt16:  return 2;
+            case ArgType::Int32:
+            case ArgType::UInt32:
+            case ArgType::Float:   return 4;
+            case ArgType::Int64:
+            case ArgType::UInt64:
+            case ArgType::Double:
+            case ArgType::Pointer: return 8;
+            case ArgType::String:  return 0;
+            }
+            return 0;
+        }
+
+        template <typename... Args>
+        inline constexpr std::array<ArgType, sizeof...(Args)> ARG_TYPES{ arg_type_of<Args>()... };
+
+    } // namespace BinaryLogFormat
+
+    /**
+     * @class BinaryLog
+     * @brief Deferred-formatting log: call sites copy raw arguments into a memory-mapped file.
+     *
+     * Each GEM_BINARY_LOG call site gets a format ID the first time it runs; its format
+     * string and argument types are written once as a definition record. Every later call
+     * only reserves space with one atomic add, stamps the raw TSC and memcpy's the
+     * arguments, so there is no formatting, locking or allocation on the calling thread.
+     *
+     * The file is decoded offline by GemLogDecoder into the same lines Logger writes to a
+     * file. Because the mapping is shared, records written before a crash are still on disk;
+     * a record a crashing thread left half written is skipped, not the ones after it.
+     * When the mapping is full, further records are dropped and counted.
+     */
+    class BinaryLog {
+    public:
+        /**
+         * @brief Per-call-site state. Declared as a function-local static by GEM_BINARY_LOG.
+         */
+        struct Site {
+            std::atomic<std::uint32_t> id{ 0 };             ///< 0 until the site is registered.
+            Logger::LogLevel level = Logger::LogLevel::Debug;
+            std::string_view format;
+            const BinaryLogFormat::ArgType* arg_types = nullptr;
+            std::uint8_t arg_count = 0;
+            Site* next = nullptr;
+        };
+
+        /**
+         * @brief Creates (truncates) a log file and maps @p capacity bytes of it.
+         *
+         * Closes the previous file if one is open. Definitions of every call site already
+         * seen are written up front, so each file decodes on its own.
+         * Calibrates TscClock if nothing has yet (~10 ms).
+         *
+         * @return False if the file could not be created or mapped.
+         */
+        static bool open(const std::string& path, std::size_t capacity = 64 * 1024 * 1024) noexcept;
+
+        /**
+         * @brief Unmaps the file and trims it to the bytes actually written.
+         *
+         * Must not race with GEM_BINARY_LOG calls on other threads: call it once those
+         * threads are idle (e.g. at shutdown).
+         */
+        static void close() noexcept;
+
+        [[nodiscard]] static bool isOpen() noexcept;
+
+        /**
+         * @brief Records below this level are skipped. Independent from Logger's level.
+         */
+        static void setMinLogLevel(Logger::LogLevel level) noexcept;
+        [[nodiscard]] static Logger::LogLevel getMinLogLevel() noexcept;
+
+        /**
+         * @brief Records lost because the mapping was full (since the last open()).
+         */
+        [[nodiscard]] static std::uint64_t getDroppedCount() noexcept;
+
+        /**
+         * @brief Writes one record. Use GEM_BINARY_LOG instead of calling this directly.
+         */
+        template <typename... Args>
+        static void write(Site& site, Logger::LogLevel level, FormatString<Args...> format, const Args&... args) noexcept {
+            if (static_cast<int>(level) < min_log_level_.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            std::byte* base = base_.load(std::memory_order_acquire);
+            if (!base) {
+                return;
+            }
+
+            std::uint32_t id = site.id.load(std::memory_order_acquire);
+            if (id == 0) {
+                const auto& arg_types = BinaryLogFormat::ARG_TYPES<std::remove_cvref_t<Args>...>;
+                id = registerSite(site, level, format.get(), arg_types.data(), arg_types.size());
+            }
+
+            std::size_t size = BinaryLogFormat::align_record(sizeof(BinaryLogFormat::RecordHeader) + (std::size_t{ 0 } + ... + encodedSize(args)));
+            std::byte* record = reserve(base, size);
+            if (!record) {
+                return;
+            }
+
+            if constexpr (sizeof...(Args) > 0) {
+                std::byte* cursor = record + sizeof(BinaryLogFormat::RecordHeader);
+                (encode(cursor, args), ...);
+            }
+
+            commit(record, id, TscClock::ticks());
+        }
+
+    private:
+        BinaryLog() = delete;  // no instances
+        ~BinaryLog() = delete;
+
+        [[nodiscard]] static std::uint32_t registerSite(Site& site, Logger::LogLevel level, std::string_view format,
+            const BinaryLogFormat::ArgType* arg_types, std::size_t arg_count) noexcept;
+
+        static void writeDefinition(std::byte* base, const Site& site, std::uint32_t id) noexcept;
+
+        /**
+         * @brief Claims @p size bytes of the mapping and stores the size in the record header,
+         *        or returns nullptr (and counts a drop) if full.
+         *
+         * The size goes in first so a reader can step over the record even if it is never committed.
+         */
+        [[nodiscard]] static std::byte* reserve(std::byte* base, std::size_t size) noexcept {
+            std::size_t offset = offset_.fetch_add(size, std::memory_order_relaxed);
+            if (offset + size > capacity_) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            std::byte* record = base + offset;
+            reinterpret_cast<BinaryLogFormat::RecordHeader*>(record)->size = static_cast<std::uint32_t>(size);
+            return record;
+        }
+
+        /**
+         * @brief Completes the record header; the format id is stored last so readers never see a torn record.
+         */
+        static void commit(std::byte* record, std::uint32_t id, std::int64_t ticks) noexcept {
+            auto* header = reinterpret_cast<BinaryLogFormat::RecordHeader*>(record);
+            header->ticks = ticks;
+            std::atomic_ref<std::uint32_t>(header->format_id).store(id, std::memory_order_release);
+        }
+
+        template <typename T>
+        [[nodiscard]] static std::string_view asString(const T& value) noexcept {
+            using Type = std::remove_cvref_t<T>;
+            if constexpr (std::is_pointer_v<Type>) {
+                if (!value) {
+                    return "(null)";
+                }
+            }
+            std::string_view text(value);
+            return text.substr(0, BinaryLogFormat::MAX_STRING_LENGTH);
+        }
+
+        template <typename T>
+        [[nodiscard]] static std::size_t encodedSize(const T& value) noexcept {
+            constexpr auto type = BinaryLogFormat::arg_type_of<T>();
+            if constexpr (type == BinaryLogFormat::ArgType::String) {
+                return sizeof(std::uint32_t) + asString(value).size();
+            }
+            else {
+                return BinaryLogFormat::fixed_size(type);
+            }
+        }
+
+        template <typename T>
+        static void encode(std::byte*& cursor, const T& value) noexcept {
+            using BinaryLogFormat::ArgType;
+            constexpr auto type = BinaryLogFormat::arg_type_of<T>();
+
+            auto put = [&cursor](const auto& stored) {
+                std::memcpy(cursor, &stored, sizeof(stored));
+                cursor += sizeof(stored);
+            };
+
+            if constexpr (type == ArgType::String) {
+                std::string_view text = asString(value);
+                put(static_cast<std::uint32_t>(text.size()));
+                std::memcpy(cursor, text.data(), text.size());
+                cursor += text.size();
+            }
+            else if constexpr (type == ArgType::Bool) { put(static_cast<std::uint8_t>(value ? 1 : 0)); }
+            else if constexpr (type == ArgType::Char) { put(static_cast<char>(value)); }
+            else if constexpr (type == ArgType::Int16) { put(static_cast<std::int16_t>(value)); }
+            else if constexpr (type == ArgType::Int32) { put(static_cast<std::int32_t>(value)); }
+            else if constexpr (type == ArgType::Int64) { put(static_cast<std::int64_t>(value)); }
+            else if constexpr (type == ArgType::UInt16) { put(static_cast<std::uint16_t>(value)); }
+            else if constexpr (type == ArgType::UInt32) { put(static_cast<std::uint32_t>(value)); }
+            else if constexpr (type == ArgType::UInt64) { put(static_cast<std::uint64_t>(value)); }
+            else if constexpr (type == ArgType::Float) { put(static_cast<float>(value)); }
+            else if constexpr (type == ArgType::Double) { put(static_cast<double>(value)); }
+            else if constexpr (std::is_null_pointer_v<std::remove_cvref_t<T>>) { put(std::uint64_t{ 0 }); }
+            else { put(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value))); }
+        }
+
+        //--------------------------------------------------------------------------
+        // Shared data
+        //--------------------------------------------------------------------------
+        static std::atomic<std::byte*> base_;         ///< Mapped view, nullptr while closed.
+        static std::atomic<std::size_t> offset_;      ///< Next free byte (may run past capacity_).
+        static std::size_t capacity_;
+        static std::atomic<std::uint64_t> dropped_;
+        static std::atomic<int> min_log_level_;
+    };
+
+} // namespace Gem
@@ -1,29 +1,42 @@
 #pragma once
 
+#include <Gem/Core/FrameHistogram.h>
+#include <Gem/Core/FramePacer.h>
+#include <Gem/Core/ThreadPolicy.h>
+#include <Gem/Core/TscClock.h>
+
 #include <chrono>
+#include <cstdint>
+#include <string>
 #include <thread>
-#include <mutex>
 
 namespace Gem {
 
     /**
-     * @class Clock
+     * @class BasicClock
      * @brief A utility class for managing delta time, printing FPS,
      *        and capping FPS in a game loop.
+     *
+     * @tparam Policy      Synchronization, see ThreadPolicy (Locked, AtomicRead, SingleThread).
+     * @tparam ClockSource std::chrono clock used for timestamps (steady_clock or TscClock).
+     *
+     * Instantiated in gemClock.cpp for every policy with steady_clock and TscClock.
      */
-    class Clock {
+    template <typename Policy, typename ClockSource = std::chrono::steady_clock>
+    class BasicClock {
     public:
-        using ClockType = std::chrono::steady_clock;
-        using TimePoint = std::chrono::time_point<ClockType>;
+        using ClockType = ClockSource;
+        using TimePoint = typename ClockType::time_point;
 
         /**
          * @brief Constructs a Clock instance.
          */
-        explicit Clock() noexcept;
+        explicit BasicClock() noexcept;
 
         /**
          * @brief Updates the clock, calculates delta time, caps FPS, logs FPS.
-         * @param max_fps Maximum FPS to cap (0 = no cap).
+         * @param max_fps Maximum FPS to cap (0 = no cap). The cap is paced on absolute
+         *        deadlines by a FramePacer (sleep, then a short spin).
          */
         void update(int max_fps = 0) noexcept;
 
@@ -32,6 +45,45 @@ namespace Gem {
          */
         void logFPS(int interval_seconds) noexcept;
 
+        /**
+         * @brief Enables per-frame telemetry in update(): binary log, flight recorder and
+         *        profiler frame boundary. On by default; turn it off on secondary clocks
+         *        so each frame is only reported once.
+         */
+        void setFrameTelemetry(bool enabled) noexcept;
+
+        /**
+         * @brief Enables the fixed-step accumulator (0 = off).
+         *
+         * Each update() adds the frame time to an accumulator and converts it into whole
+         * steps of @p step_seconds: run getFixedSteps() simulation ticks of getFixedTimestep()
+         * seconds, then render with getInterpolationAlpha(). At most @p max_steps_per_frame
+         * steps are run per frame; the backlog beyond that is dropped so a slow frame cannot
+         * cause an ever-growing catch-up (spiral of death).
+         */
+        void setFixedTimestep(double step_seconds, int max_steps_per_frame = 8) noexcept;
+
+        /**
+         * @brief Duration of one fixed step in seconds (0 if disabled).
+         */
+        [[nodiscard]] double getFixedTimestep() const noexcept;
+
+        /**
+         * @brief Number of fixed steps to simulate this frame (0 when rendering faster than the tick rate).
+         */
+        [[nodiscard]] int getFixedSteps() const noexcept;
+
+        /**
+         * @brief Fraction of a step left in the accumulator, in [0, 1): blend factor between
+         *        the previous and the last simulated state.
+         */
+        [[nodiscard]] double getInterpolationAlpha() const noexcept;
+
+        /**
+         * @brief Total fixed steps dropped by the max_steps_per_frame limit.
+         */
+        [[nodiscard]] std::uint64_t getDroppedFixedSteps() const noexcept;
+
         /**
          * @brief Returns the time elapsed between the previous frame and this frame (in seconds).
          */
@@ -45,26 +97,106 @@ namespace Gem {
         /**
          * @brief Average FPS over the last log interval (if the interval is set).
          *
-         * If the interval isnt set or not reached yet, returns the most recent calculation.
+         * If the interval isn't set or not reached yet, returns the most recent calculation.
          */
         [[nodiscard]] double getAverageFPS() const noexcept;
 
+        /**
+         * @brief Frames longer than @p budget_ms are counted as over budget (0 = not counted).
+         */
+        void setFrameBudget(double budget_ms) noexcept;
+
+        /**
+         * @brief Frame-time percentiles of the last completed FPS log interval (see logFPS()).
+         */
+        [[nodiscard]] FrameHistogram::Summary getFrameStats() const noexcept;
+
+        /**
+         * @brief Frame-time percentiles since construction.
+         *
+         * Reads the whole-run histogram: with the AtomicRead policy call it from the update() thread.
+         */
+        [[nodiscard]] FrameHistogram::Summary getTotalFrameStats() const noexcept;
+
+        /**
+         * @brief Writes the whole-run frame-time histogram as CSV (e.g. at shutdown).
+         *
+         * The histogram is copied under the policy's read and the copy is written, so the file
+         * never mixes two frames. With the AtomicRead policy call it from the update() thread.
+         * @return False if the file could not be written.
+         */
+        bool exportFrameHistogram(const std::string& path) const noexcept;
+
+        /**
+         * @brief Pacing error of the FPS cap since the last FPS log (or since the start).
+         */
+        [[nodiscard]] FramePacer::Stats getPacingStats() const noexcept;
+
         // Delete copy/move
-        Clock(const Clock&) = delete;
-        Clock& operator=(const Clock&) = delete;
-        Clock(Clock&&) = delete;
-        Clock& operator=(Clock&&) = delete;
+        BasicClock(const BasicClock&) = delete;
+        BasicClock& operator=(const BasicClock&) = delete;
+        BasicClock(BasicClock&&) = delete;
+        BasicClock& operator=(BasicClock&&) = delete;
 
     private:
-        mutable std::mutex mutex_;
+        template <typename T>
+        using Field = typename Policy::template Field<T>;
+        using WriteGuard = typename Policy::WriteGuard;
+
+        mutable Policy policy_;
+        FramePacer pacer_;               ///< Used by update() only
         TimePoint previous_time_;
         TimePoint current_time_;
 
-        double delta_time_;       ///< Seconds between frames
-        int frame_count_;         ///< Number of frames in the current interval
-        double fps_timer_;        ///< How many seconds have passed in the current interval
-        double fps_log_interval_; ///< Interval length in seconds
-        double last_average_fps_; ///< Last computed average FPS
+        Field<double> delta_time_;       ///< Seconds between frames
+        int frame_count_;                ///< Number of frames in the current interval
+        double fps_timer_;               ///< How many seconds have passed in the current interval
+        double fps_log_interval_;        ///< Interval length in seconds
+        Field<double> last_average_fps_; ///< Last computed average FPS
+        bool frame_telemetry_;           ///< Report frames to the binary log / flight recorder / profiler
+
+        // Frame-time statistics
+        FrameHistogram interval_histogram_;          ///< Current FPS log interval
+        FrameHistogram total_histogram_;             ///< Whole run
+        double frame_budget_ms_;                     ///< 0 = no budget
+        std::uint64_t interval_over_budget_;
+        std::uint64_t total_over_budget_;
+
+        /**
+         * @brief Summary of the last completed interval, one readable field per value.
+         */
+        struct SummaryFields {
+            Field<std::uint64_t> frames;
+            Field<double> mean_ms;
+            Field<double> p50_ms;
+            Field<double> p90_ms;
+            Field<double> p99_ms;
+            Field<double> p999_ms;
+            Field<double> max_ms;
+            Field<std::uint64_t> over_budget;
+        };
+        SummaryFields interval_stats_;
+
+        // Fixed timestep
+        Field<double> fixed_step_;                   ///< Seconds per fixed step (0 = off)
+        int max_fixed_steps_;                        ///< Catch-up limit per frame
+        double accumulator_;                         ///< Unsimulated time in seconds
+        Field<int> fixed_steps_;                     ///< Steps to run this frame
+        Field<double> interpolation_alpha_;          ///< accumulator_ / fixed_step_
+        Field<std::uint64_t> dropped_fixed_steps_;   ///< Steps discarded by the catch-up limit
     };
 
+    /**
+     * @brief Frame clock of the main loop: update()/setters from the loop thread,
+     *        lock-free getters from any thread.
+     */
+    using Clock = BasicClock<ThreadPolicy::AtomicRead>;
+
+    extern template class BasicClock<ThreadPolicy::SingleThread, std::chrono::steady_clock>;
+    extern template class BasicClock<ThreadPolicy::Locked, std::chrono::steady_clock>;
+    extern template class BasicClock<ThreadPolicy::AtomicRead, std::chrono::steady_clock>;
+    extern template class BasicClock<ThreadPolicy::SingleThread, TscClock>;
+    extern template class BasicClock<ThreadPolicy::Locked, TscClock>;
+    extern template class BasicClock<ThreadPolicy::AtomicRead, TscClock>;
+
 } // namespace Gem
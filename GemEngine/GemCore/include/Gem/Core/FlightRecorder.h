@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Gem/Core/Logger.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * Number of entries kept by the flight recorder (rounded down to a power of two).
+ * Each entry is 128 bytes.
+ */
+#ifndef GEMENGINE_FLIGHT_RECORDER_SIZE
+    #define GEMENGINE_FLIGHT_RECORDER_SIZE 4096
+#endif
+
+namespace Gem {
+
+    /**
+     * @class FlightRecorder
+     * @brief Always-on in-memory history of the last log records, frame times and ScopedTimer samples.
+     *
+     * Recording is a lock-free write into a fixed ring (one atomic add plus a copy of at most
+     * 100 characters), so it stays enabled in every configuration, including DIST. It records
+     * log messages from its own level (setLogLevel(), GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL at
+     * compile time) upward, even those the logger's levels keep from being printed.
+     *
+     * The ring is written to a text file:
+     * - from the fatal-signal handlers (SIGSEGV, SIGABRT, SIGFPE, SIGILL) installed by enable(),
+     *   using only async-signal-safe calls;
+     * - by a background thread whenever a frame exceeds the configured budget (hitch);
+     * - on demand with dump().
+     */
+    class FlightRecorder {
+    public:
+        /**
+         * @brief What an entry holds.
+         */
+        enum class Kind : std::uint8_t {
+            Empty,
+            Log,    ///< A log message (level + text).
+            Frame,  ///< A frame time in milliseconds.
+            Timer   ///< A ScopedTimer sample (name + milliseconds).
+        };
+
+        /**
+         * @brief Settings used by enable().
+         */
+        struct Config {
+            std::string crash_path = "gem_crash.flight.txt";    ///< Written by the fatal-signal handler.
+            std::string hitch_path_prefix = "gem_hitch";        ///< Hitch dumps go to "<prefix>_<n>.flight.txt".
+            double frame_budget_ms = 0.0;                       ///< Frames longer than this trigger a dump (0 = off).
+            std::chrono::seconds hitch_cooldown{ 10 };          ///< Minimum time between two hitch dumps.
+            bool install_crash_handlers = true;
+        };
+
+        /**
+         * @brief Enables dumping with the default configuration.
+         */
+        static void enable() noexcept;
+
+        /**
+         * @brief Installs the crash handlers and starts the hitch dump thread.
+         *
+         * Recording itself does not need this; the ring is filled from program start.
+         */
+        static void enable(const Config& config) noexcept;
+
+        /**
+         * @brief Restores the previous signal handlers and stops the hitch dump thread.
+         */
+        static void disable() noexcept;
+
+        /**
+         * @brief Frames longer than @p budget_ms trigger a hitch dump (0 = off).
+         */
+        static void setFrameBudget(double budget_ms) noexcept;
+
+        /**
+         * @brief Sets the lowest level recorded at runtime, independent of the logger's output levels.
+         *
+         * Levels below GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL (Info by default) are compiled out
+         * and cannot be enabled here.
+         */
+        static void setLogLevel(Logger::LogLevel level) noexcept;
+
+        [[nodiscard]] static Logger::LogLevel getLogLevel() noexcept;
+
+        //--------------------------------------------------------------------------
+        // Recording (lock-free, callable from any thread)
+        //--------------------------------------------------------------------------
+        static void recordLog(Logger::LogLevel level, std::string_view message) noexcept;
+
+        /**
+         * @brief Records a frame time and checks it against the frame budget.
+         */
+        static void recordFrame(double frame_ms) noexcept;
+
+        static void recordTimer(std::string_view name, double elapsed_ms) noexcept;
+
+        //--------------------------------------------------------------------------
+        // Dumping
+        //--------------------------------------------------------------------------
+        /**
+         * @brief Writes the ring, oldest entry first, to @p path.
+         * @return False if the file could not be created.
+         */
+        static bool dump(const std::string& path, std::string_view reason) noexcept;
+
+    private:
+        FlightRecorder() = delete;  // no instances
+        ~FlightRecorder() = delete;
+    };
+
+} // namespace Gem
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Gem {
+
+    namespace Format {
+
+        /**
+         * @brief Never defined. Calling it from a consteval context turns a bad format
+         *        string into a compile error whose message names the problem.
+         */
+        void placeholder_count_does_not_match_argument_count();
+
+        //--------------------------------------------------------------------------
+        // Argument writers
+        //--------------------------------------------------------------------------
+        /**
+         * @brief Appends one argument to @p out without building intermediate strings.
+         *
+         * Output matches what `std::ostream << value` produced with default flags:
+         * integers in decimal, floating point as "%g" (6 significant digits), bools as 0/1,
+         * pointers in hex. Types without a fast path fall back to a reused thread-local stream.
+         */
+        template <typename T>
+        void append_value(std::string& out, const T& value) {
+            using Type = std::remove_cvref_t<T>;
+
+            if constexpr (std::is_same_v<Type, bool>) {
+                out += value ? '1' : '0';
+            }
+            else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> || std::is_same_v<Type, unsigned char>) {
+                out += static_cast<char>(value);
+            }
+            else if constexpr (std::is_integral_v<Type>) {
+                char buffer[24];
+                auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                out.append(buffer, result.ptr);
+            }
+            else if constexpr (std::is_floating_point_v<Type>) {
+                char buffer[64];
+                auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 6);
+                out.append(buffer, result.ptr);
+            }
+            else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+                out.append(value ? std::string_view(value) : std::string_view("(null)"));
+            }
+            else if constexpr (std::is_convertible_v<const Type&, std::string_view>) {
+                out.append(std::string_view(value));
+            }
+            else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>) {
+                char buffer[2 + 16];
+                buffer[0] = '0';
+                buffer[1] = 'x';
+                auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(value), 16);
+                out.append(buffer, result.ptr);
+            }
+            else {
+                thread_local std::ostringstream stream;
+                stream.str(std::string());
+                stream.clear();
+                stream << value;
+                out.append(stream.view());
+            }
+        }
+
+    } // namespace Format
+
+    /**
+     * @class BasicFormatString
+     * @brief A "{}" format string validated and split at compile time.
+     *
+     * The consteval constructor records where every "{}" placeholder is and rejects the
+     * string at compile time if the placeholder count differs from the argument count.
+     * At runtime, format_to() only copies the literal pieces and writes the arguments.
+     *
+     * Use it through the FormatString alias so the argument types are deduced from the call:
+     * @code
+     * template <typename... Args>
+     * void print(FormatString<Args...> format, const Args&... args);
+     * @endcode
+     */
+    template <typename... Args>
+    class BasicFormatString {
+    public:
+        static constexpr std::size_t ARG_COUNT = sizeof...(Args);
+
+        /**
+         * @brief Parses a compile-time string.
+         */
+        template <typename S>
+            requires std::is_convertible_v<const S&, std::string_view>
+        consteval BasicFormatString(const S& format)
+            : format_(format)
+        {
+            std::size_t found = 0;
+            std::size_t pos = format_.find("{}");
+            while (pos != std::string_view::npos) {
+                if (found < ARG_COUNT) {
+                    positions_[found] = pos;
+                }
+                ++found;
+                pos = format_.find("{}", pos + 2);
+            }
+
+            if (found != ARG_COUNT) {
+                Format::placeholder_count_does_not_match_argument_count();
+            }
+        }
+
+        /**
+         * @brief Returns the raw format string.
+         */
+        [[nodiscard]] constexpr std::string_view get() const noexcept {
+            return format_;
+        }
+
+        /**
+         * @brief Appends the formatted message to @p out.
+         */
+        void format_to(std::string& out, const Args&... args) const {
+            if constexpr (ARG_COUNT == 0) {
+                out.append(format_);
+            }
+            else {
+                std::size_t cursor = 0;
+                std::size_t index = 0;
+
+                auto emit = [&](const auto& value) {
+                    out.append(format_.data() + cursor, positions_[index] - cursor);
+                    Format::append_value(out, value);
+                    cursor = positions_[index] + 2;
+                    ++index;
+                };
+                (emit(args), ...);
+
+                out.append(format_.data() + cursor, format_.size() - cursor);
+            }
+        }
+
+    private:
+        std::string_view format_;
+        std::array<std::size_t, ARG_COUNT> positions_{};
+    };
+
+    /**
+     * @brief Format string type for a call taking @p Args (cv/ref qualifiers ignored, never deduced).
+     */
+    template <typename... Args>
+    using FormatString = BasicFormatString<std::remove_cvref_t<Args>...>;
+
+} // namespace Gem
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Gem {
+
+    /**
+     * @class FrameHistogram
+     * @brief Constant-memory log-linear (HDR-style) histogram of frame times.
+     *
+     * Values are bucketed in microseconds: exact below 64 us, then 32 linear sub-buckets per
+     * power of two (about 3% relative error) up to ~67 s. Recording is O(1) and never allocates;
+     * percentiles walk the fixed bucket array.
+     */
+    class FrameHistogram {
+    public:
+        static constexpr int SUB_BUCKET_BITS = 5;
+        static constexpr std::size_t SUB_BUCKET_COUNT = std::size_t(1) << SUB_BUCKET_BITS;
+        static constexpr int MAX_VALUE_BITS = 26;   ///< Values are clamped to 2^26 us (~67 s).
+        static constexpr std::size_t BUCKET_COUNT = 2 * SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS - 1) * SUB_BUCKET_COUNT;
+
+        /**
+         * @brief Percentile summary of a histogram, in milliseconds.
+         */
+        struct Summary {
+            std::uint64_t frames = 0;
+            double mean_ms = 0.0;
+            double p50_ms = 0.0;
+            double p90_ms = 0.0;
+            double p99_ms = 0.0;
+            double p999_ms = 0.0;
+            double max_ms = 0.0;
+            std::uint64_t over_budget = 0;  ///< Filled by Clock (exact, not bucketed).
+        };
+
+        explicit FrameHistogram() noexcept;
+
+        /**
+         * @brief Adds one frame time.
+         */
+        void record(double frame_ms) noexcept;
+
+        /**
+         * @brief Adds every sample of @p other.
+         */
+        void merge(const FrameHistogram& other) noexcept;
+
+        void reset() noexcept;
+
+        [[nodiscard]] std::uint64_t getCount() const noexcept { return count_; }
+
+        /**
+         * @brief Frame time in ms at percentile @p percentile (0-100), 0 when empty.
+         *
+         * Returns the upper bound of the bucket holding the percentile, capped at the exact maximum.
+         */
+        [[nodiscard]] double getPercentile(double percentile) const noexcept;
+
+        [[nodiscard]] double getMin() const noexcept;
+        [[nodiscard]] double getMax() const noexcept;
+        [[nodiscard]] double getMean() const noexcept;
+
+        /**
+         * @brief Count, mean, p50/p90/p99/p99.9 and max in one pass over the buckets.
+         */
+        [[nodiscard]] Summary summarize() const noexcept;
+
+        /**
+         * @brief Writes the non-empty buckets as CSV: bucket_low_ms, bucket_high_ms, count, cumulative_percent.
+         * @return False if the file could not be written.
+         */
+        bool exportCsv(const std::string& path) const noexcept;
+
+    private:
+        [[nodiscard]] static std::size_t bucketIndex(std::uint64_t value_us) noexcept;
+        [[nodiscard]] static std::uint64_t bucketLow(std::size_t index) noexcept;
+        [[nodiscard]] static std::uint64_t bucketHigh(std::size_t index) noexcept;
+
+        std::array<std::uint32_t, BUCKET_COUNT> buckets_;
+        std::uint64_t count_;
+        double sum_ms_;
+        double min_ms_;
+        double max_ms_;
+    };
+
+} // namespace Gem
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Gem {
+
+    /**
+     * @class FramePacer
+     * @brief Waits for absolute frame deadlines with an OS sleep followed by a short spin.
+     *
+     * Each wait() targets the previous deadline plus one period, so frame times do not drift.
+     * The thread sleeps (clock_nanosleep on Linux, a high-resolution waitable timer on Windows)
+     * until a margin before the deadline and spins for the rest. The margin follows the
+     * measured wake-up latency of the scheduler: large enough to avoid oversleeping, small
+     * enough to keep the spin (and CPU use) short.
+     *
+     * wait() must be called from a single thread; getStats() may be called from any thread.
+     */
+    class FramePacer {
+    public:
+        using ClockType = std::chrono::steady_clock;
+        using TimePoint = ClockType::time_point;
+
+        /**
+         * @brief Pacing error since the last resetStats().
+         *
+         * The error of a frame is the time wait() returned minus its deadline.
+         */
+        struct Stats {
+            std::uint64_t frames = 0;         ///< Waits that reached their deadline.
+            std::uint64_t missed_frames = 0;  ///< Calls that arrived after their deadline (no wait).
+            double mean_error_us = 0.0;       ///< Time past the deadline, over frames and missed frames.
+            double stddev_error_us = 0.0;
+            double max_error_us = 0.0;
+            double mean_spin_us = 0.0;        ///< Average busy-wait after the sleep (frames only).
+            double margin_us = 0.0;           ///< Current sleep margin.
+        };
+
+        explicit FramePacer() noexcept;
+        ~FramePacer();
+
+        /**
+         * @brief Waits until the next deadline, one @p period_seconds after the previous one.
+         *
+         * The first call, a change of period or arriving more than one period late starts a
+         * new schedule from now.
+         */
+        void wait(double period_seconds) noexcept;
+
+        /**
+         * @brief Forgets the current schedule (the next wait() starts a new one).
+         */
+        void reset() noexcept;
+
+        [[nodiscard]] Stats getStats() const noexcept;
+        void resetStats() noexcept;
+
+        // No copy/move
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+        FramePacer(FramePacer&&) = delete;
+        FramePacer& operator=(FramePacer&&) = delete;
+
+    private:
+        void sleepUntil(TimePoint wake_time) noexcept;
+        void adaptMargin(double latency_ns) noexcept;
+
+        // Schedule (wait() thread only)
+        TimePoint deadline_;
+        std::chrono::nanoseconds period_;
+        bool has_deadline_;
+
+        // Margin estimation (wait() thread only)
+        double margin_ns_;
+        double latency_mean_ns_;    ///< Moving average of the wake-up latency.
+        double latency_dev_ns_;     ///< Moving mean absolute deviation of the latency.
+
+        // Statistics
+        mutable std::mutex stats_mutex_;
+        std::uint64_t frames_;
+        std::uint64_t missed_frames_;
+        double error_sum_;
+        double error_square_sum_;
+        double error_max_;
+        double spin_sum_;
+
+        void* timer_handle_;        ///< Windows waitable timer, unused elsewhere.
+    };
+
+} // namespace Gem
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Gem {
+
+    /**
+     * @brief On-disk layout shared by GLCapture and the offline replayer (GemGLReplay).
+     *
+     * File   : FileHeader, then records back to back (no padding).
+     * Record : RecordHeader, then the call's arguments in order, stored raw (GLenum, GLint,
+     *          GLuint and GLsizei as 4 bytes, pointer-sized integers and offsets as 8 bytes).
+     *          Memory the call reads (buffer data, pixels, shader text, uniform values, names)
+     *          is stored as a u64 byte count followed by the bytes; a count of NULL_BLOB means
+     *          the pointer was null. Values the call returns or writes (generated names,
+     *          created objects, uniform locations) come after the arguments.
+     */
+    namespace GLCaptureFormat {
+
+        inline constexpr char MAGIC[8] = { 'G', 'E', 'M', 'G', 'L', 'C', 'A', 'P' };
+        inline constexpr std::uint32_t VERSION = 1;
+        inline constexpr std::uint64_t NULL_BLOB = ~std::uint64_t{ 0 };
+
+        /**
+         * @brief Captured calls. Values are part of the format: append, never reorder.
+         */
+        enum class Call : std::uint16_t {
+            EndFrame = 0,               ///< i64 frame duration (ns) measured while capturing.
+
+            // Uniforms
+            GetUniformLocation,         ///< program, name blob, -> location
+            Uniform,                    ///< u8 type (UniformType), u8 components, location, count, values blob
+            UniformMatrix,              ///< u8 columns, u8 rows, location, count, u8 transpose, values blob
+            GetUniformBlockIndex,       ///< program, name blob, -> index
+            UniformBlockBinding,        ///< program, index, binding
+
+            // Textures
+            GenTextures,                ///< n, -> names blob
+            DeleteTextures,             ///< n, names blob
+            ActiveTexture,
+            BindTexture,
+            TexParameteri,
+            GenerateMipmap,
+            TexImage1D,                 ///< target, level, internalformat, width, border, format, type, pixels blob
+            TexImage2D,
+            TexImage3D,
+            TexSubImage2D,
+            TexSubImage3D,
+            TexStorage2D,
+            TexStorage3D,
+
+            // Buffers
+            GenBuffers,
+            DeleteBuffers,
+            BindBuffer,
+            BufferData,                 ///< target, i64 size, data blob, usage
+            BufferSubData,              ///< target, i64 offset, data blob
+            BindBufferRange,
+            BindBufferBase,
+
+            // Vertex arrays
+            GenVertexArrays,
+            DeleteVertexArrays,
+            BindVertexArray,
+            VertexAttribPointer,        ///< index, size, type, u8 normalized, stride, u64 offset
+            EnableVertexAttribArray,
+
+            // Shaders and programs
+            CreateShader,               ///< type, -> shader
+            ShaderSource,               ///< shader, source blob (all strings joined)
+            CompileShader,
+            AttachShader,
+            DeleteShader,
+            CreateProgram,              ///< -> program
+            LinkProgram,
+            UseProgram,
+            DeleteProgram,
+
+            // Frame buffers and fixed-function state
+            ClearColor,
+            Clear,
+            Viewport,
+            Enable,
+            Disable,
+            CullFace,
+            FrontFace,
+            BlendFunc,
+            DrawElements,               ///< mode, count, type, u64 offset into the element buffer
+
+            // Frame buffer objects
+            GenFramebuffers,
+            DeleteFramebuffers,
+            BindFramebuffer,
+            GenRenderbuffers,
+            DeleteRenderbuffers,
+            BindRenderbuffer,
+            RenderbufferStorage,
+            FramebufferRenderbuffer,
+
+            // Persistent mappings
+            BufferStorage,              ///< target, i64 size, data blob, flags
+            BufferWrite,                ///< buffer, i64 offset, data blob: bytes written through a mapping (GL::mark_mapped_write)
+
+            // Direct state access
+            CreateBuffers,              ///< n, -> names blob
+            NamedBufferData,            ///< buffer, i64 size, data blob, usage
+            NamedBufferStorage,         ///< buffer, i64 size, data blob, flags
+            NamedBufferSubData,         ///< buffer, i64 offset, data blob
+            CreateVertexArrays,         ///< n, -> names blob
+            VertexArrayVertexBuffer,    ///< vaobj, bindingindex, buffer, i64 offset, stride
+            VertexArrayElementBuffer,
+            VertexArrayAttribFormat,    ///< vaobj, attribindex, size, type, u8 normalized, relativeoffset
+            VertexArrayAttribBinding,
+            EnableVertexArrayAttrib,
+            CreateTextures,             ///< target, n, -> names blob
+            TextureParameteri,
+            TextureStorage1D,
+            TextureStorage2D,
+            TextureStorage3D,
+            TextureSubImage1D,          ///< texture, level, xoffset, width, format, type, pixels blob
+            TextureSubImage2D,
+            TextureSubImage3D,
+            GenerateTextureMipmap,
+            BindTextureUnit,            ///< unit, texture
+
+            // Shared geometry buffers
+            CopyBufferSubData,          ///< readTarget, writeTarget, i64 readOffset, i64 writeOffset, i64 size
+            CopyNamedBufferSubData,     ///< readBuffer, writeBuffer, i64 readOffset, i64 writeOffset, i64 size
+            DrawElementsBaseVertex,     ///< mode, count, type, u64 offset into the element buffer, basevertex
+
+            Count
+        };
+
+        enum class UniformType : std::uint8_t { Int, UInt, Float };
+
+        struct FileHeader {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t header_size;
+            std::int64_t system_time_ns;   ///< Wall clock when the capture started.
+        };
+
+        struct RecordHeader {
+            std::uint16_t call;            ///< Call
+            std::uint8_t context;          ///< 0 = the thread that called GLCapture::begin(), then in order of first call.
+            std::uint8_t reserved;
+            std::uint32_t size;            ///< Payload bytes after this header.
+        };
+
+    } // namespace GLCaptureFormat
+
+    /**
+     * @class GLCapture
+     * @brief Records the GL call stream of the Gem::GL wrappers to a file, for GemGLReplay.
+     *
+     * Every wrapper that changes GL state or submits work appends one record after calling
+     * the driver, with the memory it reads (buffer data, pixels, shader sources...), so the
+     * file replays without the application or its assets. Getters, queries, sync objects and
+     * read-backs are not recorded. Binds the state cache elides are not recorded either: the
+     * stream is what the driver actually received. Writes through persistent mappings are
+     * invisible to the wrappers; they are recorded before the next draw when reported with
+     * GL::mark_mapped_write() (Graphics::StreamBuffer does).
+     *
+     * Objects are recorded by the names the driver returned; the replayer maps them to its
+     * own. Start the capture before the objects used by the frames of interest are created
+     * (setting GEM_GL_CAPTURE=<file> starts it in GemEngine::init()). Each thread issuing GL
+     * calls is recorded as its own context, so a thread must keep one context current while
+     * capturing (true for the render thread and AsyncLoader).
+     */
+    class GLCapture {
+    public:
+        /**
+         * @brief Creates (truncates) @p path and starts recording.
+         *
+         * Call on the render thread: it is recorded as context 0, the one the replayer renders
+         * to its offscreen framebuffer. Ends the previous capture if one is running.
+         *
+         * @param frame_limit Ends the capture by itself after this many frames (0 = no limit).
+         * @return False if the file could not be created.
+         */
+        static bool begin(const std::string& path, std::uint32_t frame_limit = 0);
+
+        /**
+         * @brief Writes the remaining records and closes the file. No-op if not capturing.
+         */
+        static void end();
+
+        /**
+         * @brief Checks if calls are being recorded. Cheap: tested by every GL wrapper.
+         */
+        [[nodiscard]] static bool isCapturing() noexcept {
+            return capturing_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Marks the end of a frame. Called by GLFW::swap_buffers(); call it yourself
+         * after each frame when rendering headless.
+         */
+        static void endFrame();
+
+        /**
+         * @brief Frames recorded since begin().
+         */
+        [[nodiscard]] static std::uint32_t getFrameCount() noexcept;
+
+        /**
+         * @brief Bytes written since begin(), headers included.
+         */
+        [[nodiscard]] static std::uint64_t getByteCount() noexcept;
+
+    private:
+        GLCapture() = delete;  // no instances
+        ~GLCapture() = delete;
+
+        friend class GLCaptureRecord;
+
+        /**
+         * @brief Appends one record to the file. Drops it if the capture has ended meanwhile.
+         */
+        static void append(GLCaptureFormat::Call call, const std::byte* payload, std::size_t size);
+
+        static std::atomic<bool> capturing_;
+    };
+
+} // namespace Gem
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 namespace Gem {
 
     /**
      * @class GemEngine
-     * @brief A singleton engine class that manages OpenGL and GLFW initialization.
+     * @brief A singleton engine class that manages OpenGL, GLFW and JobSystem initialization.
      *
      * This class provides a centralized way to initialize and manage the graphics
      * subsystems required by the application. It uses reference counting to ensure
@@ -15,6 +17,30 @@ namespace Gem {
     class GemEngine
     {
     public:
+        /**
+         * @brief Settings used by init().
+         */
+        struct Config {
+            /**
+             * Create the context with EGL instead of GLFW and render into an offscreen
+             * framebuffer, so no display (X11, Wayland) is needed. Window cannot be used
+             * in this mode; read the result back with readFramebuffer().
+             */
+            bool headless = false;
+            int framebuffer_width = 1280;   ///< Size of the offscreen framebuffer (headless only).
+            int framebuffer_height = 720;
+            unsigned int job_workers = 0;   ///< JobSystem worker threads. 0 = hardware threads - 1.
+
+            /**
+             * Run without any GL driver or display: GL calls are discarded (objects still get
+             * names, shaders compile, fences signal) and windows only exist in memory. Measures
+             * the engine's own CPU cost per frame, and runs anywhere. Takes precedence over
+             * headless. Setting GEM_NULL_BACKEND=<frames> turns it on for any program.
+             */
+            bool null_backend = false;
+            unsigned int null_frame_limit = 0;  ///< Null backend: windows ask to close after this many frames (0 = never).
+        };
+
         /**
          * @brief Gets the singleton instance of GemEngine.
          *
@@ -37,6 +63,15 @@ namespace Gem {
          */
         bool init();
 
+        /**
+         * @brief Initializes OpenGL with the given settings (windowed or headless).
+         *
+         * If already initialized, this call will be skipped.
+         *
+         * @return true if initialization was successful or already initialized, false otherwise.
+         */
+        bool init(const Config& config);
+
         /**
          * @brief Shuts down OpenGL and GLFW.
          * 
@@ -51,6 +86,20 @@ namespace Gem {
          */
         bool isInitialized() const;
 
+        /**
+         * @brief Checks if the engine runs without a display (see Config::headless).
+         */
+        bool isHeadless() const;
+
+        /**
+         * @brief Reads back the offscreen framebuffer of a headless context.
+         *
+         * Rows are bottom-up, 4 bytes (RGBA8) per pixel.
+         *
+         * @return false if the engine is not headless.
+         */
+        bool readFramebuffer(std::vector<std::uint8_t>& rgba, int& width, int& height) const;
+
         /**
          * @brief Checks if the engine is running.
          *
@@ -81,11 +130,31 @@ namespace Gem {
          */
         bool initOpenGL();
 
+        /**
+         * @brief Initializes OpenGL on an EGL context with an offscreen framebuffer.
+         *
+         * @return true if successful, false otherwise.
+         */
+        bool initHeadless(const Config& config);
+
+        /**
+         * @brief Loads the null backend (Config::null_backend) in place of a driver.
+         *
+         * @return true if successful, false otherwise.
+         */
+        bool initNull(const Config& config);
+
+        /**
+         * @brief Sets the engine's default GL state (depth test, culling, blending...).
+         */
+        void applyDefaultState();
+
     private:
 
         std::mutex mutex_;      ///< Mutex to guard initialization and shutdown operations.
         bool initialized_ = false; ///< Flag indicating if the engine is initialized.
         bool running_ = false;      ///< Flag indicating if the engine is running.
+        bool headless_ = false;     ///< Flag indicating if the context is an EGL headless one.
     };
 
 } // namespace Gem
\ No newline at end of file
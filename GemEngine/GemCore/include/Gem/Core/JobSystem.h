@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Gem {
+
+    struct JobSystemInternal;
+
+    /**
+     * @class JobSystem
+     * @brief Fixed pool of worker threads with per-thread work-stealing deques.
+     *
+     * Every thread taking part (the workers plus the thread that called init()) owns a
+     * Chase-Lev deque: jobs it submits go to its own deque and are popped LIFO, idle threads
+     * steal FIFO from the others. Jobs are allocated from a per-thread ring, so submitting
+     * does not touch the heap unless the callable is larger than JOB_PAYLOAD_SIZE or the
+     * ring wraps onto a job that has not finished yet.
+     *
+     * Fork/join uses Counters: run() increments the counter, the job decrements it when it
+     * finishes, and wait() executes other jobs (the main thread included) until it reaches zero.
+     * Threads that are not part of the system may submit too; their jobs go through a shared
+     * queue.
+     *
+     * Until init() is called, run() and parallelFor() execute inline.
+     */
+    class JobSystem {
+    public:
+        static constexpr std::size_t JOB_PAYLOAD_SIZE = 40;        ///< Callables up to this size are stored in the job itself...
+        static constexpr std::size_t JOB_PAYLOAD_ALIGNMENT = 8;    ///< ...and up to this alignment (more would pad the job past a cache line).
+
+        /**
+         * @brief Settings used by init().
+         */
+        struct Config {
+            unsigned int worker_count = 0;          ///< Worker threads. 0 = hardware threads - 1 (at least 1).
+            std::size_t jobs_per_thread = 4096;     ///< Pooled jobs per thread (rounded up to a power of two); more spill to the heap.
+        };
+
+        /**
+         * @brief Number of unfinished jobs of a fork/join group.
+         */
+        class Counter {
+        public:
+            Counter() noexcept = default;
+
+            [[nodiscard]] bool isDone() const noexcept {
+                return pending_.load(std::memory_order_acquire) == 0;
+            }
+
+            // No copy/move: jobs hold a pointer to it
+            Counter(const Counter&) = delete;
+            Counter& operator=(const Counter&) = delete;
+            Counter(Counter&&) = delete;
+            Counter& operator=(Counter&&) = delete;
+
+        private:
+            friend class JobSystem;
+            friend struct JobSystemInternal;
+
+            std::atomic<std::uint32_t> pending_{ 0 };
+        };
+
+        /**
+         * @brief Starts the workers with the default configuration.
+         */
+        static void init();
+
+        /**
+         * @brief Starts the workers. The calling thread becomes thread 0 and helps in wait().
+         */
+        static void init(const Config& config);
+
+        /**
+         * @brief Runs the queued jobs to completion and joins the workers. Call from the init() thread.
+         */
+        static void shutdown();
+
+        [[nodiscard]] static bool isInitialized() noexcept;
+
+        /**
+         * @brief Number of worker threads (not counting the init() thread).
+         */
+        [[nodiscard]] static unsigned int getWorkerCount() noexcept;
+
+        /**
+         * @brief Queues @p function (callable as function()) for execution on any thread.
+         *
+         * @param counter Incremented now, decremented once the job has run. May be nullptr.
+         */
+        template <typename F>
+        static void run(F&& function, Counter* counter = nullptr) {
+            if (!isInitialized()) {
+                function();
+                return;
+            }
+
+            Job* job = allocate();
+            bind(*job, std::forward<F>(function));
+            job->counter = counter;
+            if (counter) {
+                counter->pending_.fetch_add(1, std::memory_order_relaxed);
+            }
+            submit(job);
+        }
+
+        /**
+         * @brief Executes queued jobs until every job of @p counter has finished.
+         */
+        static void wait(const Counter& counter);
+
+        /**
+         * @brief Calls function(first, last) over [begin, end) split into chunks of @p grain, in parallel.
+         *
+         * The calling thread runs the first chunk, then helps with the rest until all are done.
+         *
+         * @param grain Indices per job. 0 picks about 4 chunks per thread.
+         */
+        template <typename F>
+        static void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, F&& function) {
+            if (end <= begin) {
+                return;
+            }
+
+            std::size_t count = end - begin;
+            if (grain == 0) {
+                grain = count / (4 * (static_cast<std::size_t>(getWorkerCount()) + 1));
+                grain = grain > 0 ? grain : 1;
+            }
+            if (count <= grain || !isInitialized()) {
+                function(begin, end);
+                return;
+            }
+
+            Counter counter;
+            for (std::size_t first = begin + grain; first < end; first += grain) {
+                std::size_t last = end - first > grain ? first + grain : end;
+                run([&function, first, last]() { function(first, last); }, &counter);
+            }
+
+            try {
+                function(begin, begin + grain);
+            }
+            catch (...) {
+                wait(counter);  // Jobs still reference function and counter
+                throw;
+            }
+            wait(counter);
+        }
+
+    private:
+        friend struct JobSystemInternal;
+
+        /**
+         * A queued callable, one cache line.
+         */
+        struct alignas(64) Job {
+            void (*invoke)(Job& job) = nullptr;
+            Counter* counter = nullptr;
+            std::atomic<bool> finished{ true };     ///< Pool slot free again.
+            bool pooled = true;                     ///< False for heap jobs (foreign threads, ring wrapped).
+            alignas(JOB_PAYLOAD_ALIGNMENT) unsigned char payload[JOB_PAYLOAD_SIZE];
+        };
+        static_assert(sizeof(Job) == 64, "A job must fill exactly one cache line");
+
+        static Job* allocate();
+        static void submit(Job* job);
+
+        /**
+         * Stores the callable in the job: in place when it fits, boxed on the heap otherwise.
+         */
+        template <typename F>
+        static void bind(Job& job, F&& function) {
+            using Function = std::decay_t<F>;
+
+            if constexpr (sizeof(Function) <= JOB_PAYLOAD_SIZE && alignof(Function) <= JOB_PAYLOAD_ALIGNMENT) {
+                ::new (static_cast<void*>(job.payload)) Function(std::forward<F>(function));
+                job.invoke = [](Job& self) {
+                    Function& stored = *std::launder(reinterpret_cast<Function*>(self.payload));
+                    struct Destroy {
+                        Function& function;
+                        ~Destroy() { function.~Function(); }
+                    } destroy{ stored };
+                    stored();
+                };
+            }
+            else {
+                Function* boxed = new Function(std::forward<F>(function));
+                ::new (static_cast<void*>(job.payload)) Function*(boxed);
+                job.invoke = [](Job& self) {
+                    Function* stored = *std::launder(reinterpret_cast<Function**>(self.payload));
+                    struct Destroy {
+                        Function* function;
+                        ~Destroy() { delete function; }
+                    } destroy{ stored };
+                    (*stored)();
+                };
+            }
+        }
+
+        JobSystem() = delete;  // no instances
+        ~JobSystem() = delete;
+    };
+
+} // namespace Gem
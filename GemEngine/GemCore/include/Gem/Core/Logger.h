@@ -1,11 +1,17 @@
 #pragma once
 
+#include <Gem/Core/FormatString.h>
+
+#include <array>
+#include <atomic>
 #include <iostream>
-#include <sstream>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <iomanip>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * If GEMENGINE_MIN_LOG_LEVEL is not defined by the build system,
@@ -30,6 +36,61 @@
     #endif
 #endif
 
+/**
+ * Lowest level the FlightRecorder keeps, independent of GEMENGINE_MIN_LOG_LEVEL: a DIST build
+ * prints only errors but still records the info and warning lines leading up to a crash.
+ */
+#ifndef GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL
+    #define GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL 1
+#endif
+
+/**
+ * Calls below this level are compiled out: they are neither printed nor recorded.
+ */
+#if GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL < GEMENGINE_MIN_LOG_LEVEL
+    #define GEMENGINE_MIN_COMPILED_LOG_LEVEL GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL
+#else
+    #define GEMENGINE_MIN_COMPILED_LOG_LEVEL GEMENGINE_MIN_LOG_LEVEL
+#endif
+
+/**
+ * Channel logging macros.
+ *
+ * The arguments are only evaluated when the message will be printed (compile-time threshold and
+ * runtime global/channel levels) or recorded by the FlightRecorder, so expensive "{}" arguments
+ * cost nothing when filtered.
+ *
+ * Usage: GEM_LOG_DEBUG(Gem::Logger::Channel::Input, "Key event: key={}", key);
+ */
+#define GEM_LOG(channel, level, ...)                                                        \
+    do {                                                                                    \
+        if (static_cast<int>(level) >= GEMENGINE_MIN_COMPILED_LOG_LEVEL                     \
+            && ::Gem::Logger::isCaptured(channel, level)) {                                 \
+            ::Gem::Logger::write(channel, level, 0, __VA_ARGS__);                           \
+        }                                                                                   \
+    } while (0)
+
+#define GEM_LOG_DEBUG(channel, ...)   GEM_LOG(channel, ::Gem::Logger::LogLevel::Debug, __VA_ARGS__)
+#define GEM_LOG_INFO(channel, ...)    GEM_LOG(channel, ::Gem::Logger::LogLevel::Info, __VA_ARGS__)
+#define GEM_LOG_WARNING(channel, ...) GEM_LOG(channel, ::Gem::Logger::LogLevel::Warning, __VA_ARGS__)
+#define GEM_LOG_ERROR(channel, ...)   GEM_LOG(channel, ::Gem::Logger::LogLevel::Error, __VA_ARGS__)
+
+/**
+ * Like GEM_LOG, but this call site prints at most @p max_per_second messages per second.
+ * Suppressed messages are counted and reported as "(xN suppressed)" on the next line it prints.
+ */
+#define GEM_LOG_RATE_LIMITED(channel, level, max_per_second, ...)                           \
+    do {                                                                                    \
+        if (static_cast<int>(level) >= GEMENGINE_MIN_COMPILED_LOG_LEVEL                     \
+            && ::Gem::Logger::isCaptured(channel, level)) {                                 \
+            static ::Gem::Logger::RateLimit gem_log_rate_limit_;                            \
+            std::uint32_t gem_log_suppressed_ = 0;                                          \
+            if (gem_log_rate_limit_.allow(max_per_second, gem_log_suppressed_)) {           \
+                ::Gem::Logger::write(channel, level, gem_log_suppressed_, __VA_ARGS__);     \
+            }                                                                               \
+        }                                                                                   \
+    } while (0)
+
 namespace Gem {
 
     class Logger {
@@ -58,75 +119,258 @@ namespace Gem {
          */
         [[nodiscard]] static LogLevel getMinLogLevel() noexcept;
 
+        //--------------------------------------------------------------------------
+        // 1a) Channels
+        //--------------------------------------------------------------------------
+        /**
+         * @brief Subsystem a message belongs to. Each channel has its own runtime level.
+         *
+         * Values past the built-in ones are handed out by registerChannel().
+         */
+        enum class Channel : std::uint8_t {
+            Core,
+            Window,
+            Input,
+            Graphics,
+            Shader,
+            Texture
+        };
+
+        static constexpr std::size_t MAX_CHANNELS = 32;
+
+        /**
+         * @brief Returns the channel called @p name, creating it if needed.
+         *
+         * New channels start at the Debug level. If all MAX_CHANNELS are taken, Core is returned.
+         */
+        [[nodiscard]] static Channel registerChannel(std::string_view name) noexcept;
+
+        /**
+         * @brief Sets the runtime minimum level of one channel (the global level still applies).
+         */
+        static void setChannelLevel(Channel channel, LogLevel level) noexcept;
+
+        [[nodiscard]] static LogLevel getChannelLevel(Channel channel) noexcept;
+
+        [[nodiscard]] static std::string_view getChannelName(Channel channel) noexcept;
+
+        /**
+         * @brief Lock-free check against the global and the channel level.
+         */
+        [[nodiscard]] static bool isEnabled(Channel channel, LogLevel level) noexcept {
+            int value = static_cast<int>(level);
+            return value >= min_log_level_.load(std::memory_order_relaxed)
+                && value >= channel_levels_[static_cast<std::size_t>(channel) % MAX_CHANNELS].load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief True if a message is printed (isEnabled and the compile-time level) or kept by the FlightRecorder.
+         */
+        [[nodiscard]] static bool isCaptured(Channel channel, LogLevel level) noexcept {
+            return (static_cast<int>(level) >= GEMENGINE_MIN_LOG_LEVEL && isEnabled(channel, level)) || isRecorded(level);
+        }
+
+        /**
+         * @class RateLimit
+         * @brief Per-call-site limiter used by GEM_LOG_RATE_LIMITED.
+         */
+        class RateLimit {
+        public:
+            /**
+             * @brief Returns true if the call may print.
+             * @param suppressed Receives how many calls were dropped since the last one that printed.
+             */
+            bool allow(std::uint32_t max_per_second, std::uint32_t& suppressed) noexcept {
+                std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+                std::int64_t start = window_start_.load(std::memory_order_relaxed);
+                if (now - start >= 1'000'000'000 && window_start_.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+                    emitted_.store(0, std::memory_order_relaxed);
+                }
+
+                if (emitted_.fetch_add(1, std::memory_order_relaxed) < max_per_second) {
+                    suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+                    return true;
+                }
+
+                suppressed_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+        private:
+            std::atomic<std::int64_t> window_start_{ 0 };
+            std::atomic<std::uint32_t> emitted_{ 0 };
+            std::atomic<std::uint32_t> suppressed_{ 0 };
+        };
+
+        //--------------------------------------------------------------------------
+        // 1b) Asynchronous mode
+        //--------------------------------------------------------------------------
+        /**
+         * @brief What a producer does when the async queue is full.
+         */
+        enum class OverflowPolicy {
+            Block,          ///< Spin until the drain thread frees a slot (never loses records).
+            Drop,           ///< Discard the record; only getDroppedCount() reports it.
+            DropAndReport   ///< Discard the record; the drain thread also logs how many were lost.
+        };
+
+        /**
+         * @brief Settings for the asynchronous backend.
+         */
+        struct AsyncConfig {
+            std::size_t queue_capacity = 8192;                        ///< Records in flight (rounded up to a power of two).
+            OverflowPolicy overflow_policy = OverflowPolicy::DropAndReport;
+            std::size_t flush_bytes = 64 * 1024;                      ///< Flush once this many bytes are pending.
+            std::chrono::milliseconds flush_interval{ 100 };          ///< Flush at least this often while records are pending.
+            bool console = true;                                      ///< Write colored lines to stdout.
+            std::string file_path;                                    ///< Also write to this file (empty = no file).
+            std::size_t max_file_size = 10 * 1024 * 1024;             ///< Rotate the file past this size (0 = never).
+            std::size_t max_files = 3;                                ///< Rotated files to keep.
+        };
+
+        /**
+         * @brief Switches to asynchronous logging with the default configuration.
+         */
+        static void enableAsync() noexcept;
+
+        /**
+         * @brief Switches to asynchronous logging.
+         *
+         * Log calls push records into a lock-free MPSC queue; a background thread formats
+         * timestamps and batches writes to the configured sinks. Calling this while async
+         * mode is active restarts the backend with the new configuration.
+         */
+        static void enableAsync(const AsyncConfig& config) noexcept;
+
+        /**
+         * @brief Drains pending records, stops the drain thread and returns to synchronous logging.
+         */
+        static void disableAsync() noexcept;
+
+        /**
+         * @brief Blocks until every record pushed before this call has been written and flushed.
+         *
+         * No-op in synchronous mode.
+         */
+        static void flush() noexcept;
+
+        /**
+         * @brief Returns true while the asynchronous backend is active.
+         */
+        [[nodiscard]] static bool isAsync() noexcept;
+
+        /**
+         * @brief Number of records discarded because the async queue was full.
+         */
+        [[nodiscard]] static std::uint64_t getDroppedCount() noexcept;
+
         //--------------------------------------------------------------------------
         // 2) Core log function with formatting
         //--------------------------------------------------------------------------
         /**
          * @brief Logs a message at a specified level with format placeholders "{}".
          *
-         * This checks both compile-time and run-time thresholds.
+         * The format string is checked at compile time: the number of "{}" must match
+         * the number of arguments. This checks both compile-time and run-time thresholds.
+         * A message filtered from the output is still handed to the FlightRecorder if it
+         * passes the recorder's own level.
          */
         template <typename... Args>
-        static void log(LogLevel level, const std::string& format, Args... args) noexcept {
-            // Compile-time filter (e.g., if GEMENGINE_MIN_LOG_LEVEL=2 and 'level' is Debug=0 or Info=1, skip entirely)
-            if (static_cast<int>(level) < GEMENGINE_MIN_LOG_LEVEL) {
+        static void log(LogLevel level, FormatString<Args...> format, const Args&... args) noexcept {
+            // Compile-time filter (e.g., if both thresholds are 2 and 'level' is Debug=0 or Info=1, skip entirely)
+            if (static_cast<int>(level) < GEMENGINE_MIN_COMPILED_LOG_LEVEL) {
                 return; // compiled out below threshold
             }
 
             // Run-time filter (useful if we compiled with debug but want to filter at runtime)
-            if (level < getMinLogLevel()) {
-                return;
+            if (static_cast<int>(level) >= GEMENGINE_MIN_LOG_LEVEL
+                && static_cast<int>(level) >= min_log_level_.load(std::memory_order_relaxed)) {
+                // Format and print the message
+                logImpl(level, formatMessage(format, args...));
+            }
+            else if (isRecorded(level)) {
+                recordImpl(level, formatMessage(format, args...));
             }
-
-            // Format the message
-            std::ostringstream stream;
-            formatMessage(stream, format, args...);
-
-            // Actually print the log
-            logImpl(level, stream.str());
         }
 
         //--------------------------------------------------------------------------
         // 3) Convenience wrappers for each log level
         //--------------------------------------------------------------------------
         template <typename... Args>
-        static void debug(const std::string& format, Args... args) noexcept {
-            // Compile-time check
-#if GEMENGINE_MIN_LOG_LEVEL <= 0
-        // Run-time check
-            if (LogLevel::Debug >= getMinLogLevel()) {
-                logImpl(LogLevel::Debug, formatMessageString(format, args...));
-            }
+        static void debug(FormatString<Args...> format, const Args&... args) noexcept {
+            // Compile-time check, the run-time checks are in log()
+#if GEMENGINE_MIN_COMPILED_LOG_LEVEL <= 0
+            log(LogLevel::Debug, format, args...);
 #endif
         }
 
         template <typename... Args>
-        static void info(const std::string& format, Args... args) noexcept {
-#if GEMENGINE_MIN_LOG_LEVEL <= 1
-            if (LogLevel::Info >= getMinLogLevel()) {
-                logImpl(LogLevel::Info, formatMessageString(format, args...));
-            }
+        static void info(FormatString<Args...> format, const Args&... args) noexcept {
+#if GEMENGINE_MIN_COMPILED_LOG_LEVEL <= 1
+            log(LogLevel::Info, format, args...);
 #endif
         }
 
         template <typename... Args>
-        static void warning(const std::string& format, Args... args) noexcept {
-#if GEMENGINE_MIN_LOG_LEVEL <= 2
-            if (LogLevel::Warning >= getMinLogLevel()) {
-                logImpl(LogLevel::Warning, formatMessageString(format, args...));
-            }
+        static void warning(FormatString<Args...> format, const Args&... args) noexcept {
+#if GEMENGINE_MIN_COMPILED_LOG_LEVEL <= 2
+            log(LogLevel::Warning, format, args...);
 #endif
         }
 
         template <typename... Args>
-        static void error(const std::string& format, Args... args) noexcept {
-#if GEMENGINE_MIN_LOG_LEVEL <= 3
-            if (LogLevel::Error >= getMinLogLevel()) {
-                logImpl(LogLevel::Error, formatMessageString(format, args...));
-            }
+        static void error(FormatString<Args...> format, const Args&... args) noexcept {
+#if GEMENGINE_MIN_COMPILED_LOG_LEVEL <= 3
+            log(LogLevel::Error, format, args...);
 #endif
         }
 
+        /**
+         * @brief Logs on a channel, prefixing the message with "[Channel] ".
+         *
+         * Checks the levels, but the arguments are already evaluated; prefer the GEM_LOG_* macros.
+         */
+        template <typename... Args>
+        static void log(Channel channel, LogLevel level, FormatString<Args...> format, const Args&... args) noexcept {
+            if (static_cast<int>(level) >= GEMENGINE_MIN_COMPILED_LOG_LEVEL && isCaptured(channel, level)) {
+                write(channel, level, 0, format, args...);
+            }
+        }
+
+        /**
+         * @brief Formats a channel message that passed isCaptured(). Used by the GEM_LOG_* macros.
+         *
+         * The message is printed if the channel's levels allow it, and only recorded otherwise.
+         * @param suppressed If non-zero, " (xN suppressed)" is appended.
+         */
+        template <typename... Args>
+        static void write(Channel channel, LogLevel level, std::uint32_t suppressed, FormatString<Args...> format, const Args&... args) noexcept {
+            std::string& buffer = formatBuffer();
+            buffer.clear();
+            try {
+                buffer += '[';
+                buffer += getChannelName(channel);
+                buffer += "] ";
+                format.format_to(buffer, args...);
+                if (suppressed > 0) {
+                    buffer += " (x";
+                    Format::append_value(buffer, suppressed);
+                    buffer += " suppressed)";
+                }
+            }
+            catch (...) {
+                buffer.assign(format.get()); // Out of memory: fall back to the raw format string
+            }
+            if (static_cast<int>(level) >= GEMENGINE_MIN_LOG_LEVEL && isEnabled(channel, level)) {
+                logImpl(level, buffer);
+            }
+            else {
+                recordImpl(level, buffer);
+            }
+        }
+
     private:
         //--------------------------------------------------------------------------
         // Implementation details
@@ -134,41 +378,40 @@ namespace Gem {
         Logger() = delete;  // no instances
         ~Logger() = delete;
 
-        // This function actually prints to console (or file). No compile-time checks here.
-        static void logImpl(LogLevel level, const std::string& message) noexcept;
+        friend class FlightRecorder;    // Owns record_min_log_level_
+
+        // This function actually prints to console (or hands the record to the async backend).
+        // No compile-time checks here.
+        static void logImpl(LogLevel level, std::string_view message) noexcept;
+
+        // Hands a message filtered from the output to the FlightRecorder only.
+        static void recordImpl(LogLevel level, std::string_view message) noexcept;
+
+        [[nodiscard]] static bool isRecorded(LogLevel level) noexcept {
+            int value = static_cast<int>(level);
+            return value >= GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL && value >= record_min_log_level_.load(std::memory_order_relaxed);
+        }
 
         //--------------------------------------------------------------------------
         // 4) Formatting
         //--------------------------------------------------------------------------
-        // For direct usage in log():
-        template <typename... Args>
-        static void formatMessage(std::ostringstream& stream, const std::string& format, Args... args) noexcept {
-            stream << formatMessageString(format, args...);
-        }
-
-        // For usage in debug()/info()/warning()/error() macros
-        // that build a single string.
-        static std::string formatMessageString(const std::string& format) noexcept {
-            return format;
-        }
+        /**
+         * @brief Per-thread scratch string the message is formatted into.
+         *        Its capacity is kept between calls, so steady-state logging does not allocate.
+         */
+        [[nodiscard]] static std::string& formatBuffer() noexcept;
 
-        template<typename T, typename... Args>
-        static std::string formatMessageString(const std::string& format, T value, Args... args) noexcept {
-            size_t pos = format.find("{}");
-            if (pos != std::string::npos) {
-                std::ostringstream stream;
-                // Output everything before "{}"
-                stream << format.substr(0, pos);
-                // Insert the argument
-                stream << value;
-                // Recursively format the rest
-                stream << formatMessageString(format.substr(pos + 2), args...);
-                return stream.str();
+        template <typename... Args>
+        static std::string_view formatMessage(const FormatString<Args...>& format, const Args&... args) noexcept {
+            std::string& buffer = formatBuffer();
+            buffer.clear();
+            try {
+                format.format_to(buffer, args...);
             }
-            else {
-                // No more placeholders
-                return format;
+            catch (...) {
+                buffer.assign(format.get()); // Out of memory: fall back to the raw format string
             }
+            return buffer;
         }
 
         //--------------------------------------------------------------------------
@@ -181,7 +424,9 @@ namespace Gem {
         // 6) Shared data
         //--------------------------------------------------------------------------
         static std::mutex log_mutex_;
-        static LogLevel min_log_level_; // runtime min log level
+        static std::atomic<int> min_log_level_; // runtime min log level
+        static std::atomic<int> record_min_log_level_; // runtime min level of the FlightRecorder
+        static std::array<std::atomic<int>, MAX_CHANNELS> channel_levels_;
     };
 
 } // namespace Gem
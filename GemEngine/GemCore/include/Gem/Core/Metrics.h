@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Gem {
+
+    /**
+     * @class Metrics
+     * @brief Registry of named engine counters, gauges and histograms.
+     *
+     * Counters and histograms are sharded per thread: recording is a plain relaxed store into
+     * the calling thread's shard, with no lock and no shared cache line. Once per frame
+     * (Clock::update) the shards are merged into per-frame values and running totals, which
+     * can be read lock-free through the handles or all at once with snapshot(), and can be
+     * dumped to the log periodically.
+     *
+     * Handles are meant to be static objects; creating two handles with the same name gives
+     * the same metric.
+     */
+    class Metrics {
+    public:
+        static constexpr std::size_t MAX_COUNTERS = 128;
+        static constexpr std::size_t MAX_GAUGES = 64;
+        static constexpr std::size_t MAX_HISTOGRAMS = 32;
+        static constexpr std::size_t HISTOGRAM_BUCKETS = 65;   ///< Bucket i holds values with bit width i.
+
+        /**
+         * @brief Monotonic count (events, bytes). Reported per frame and as a total.
+         */
+        class Counter {
+        public:
+            explicit Counter(std::string_view name) noexcept;
+
+            void add(std::uint64_t amount = 1) noexcept;
+
+            [[nodiscard]] std::uint64_t getFrameValue() const noexcept;   ///< Amount added during the last frame.
+            [[nodiscard]] std::uint64_t getTotal() const noexcept;        ///< Amount added up to the last frame.
+
+        private:
+            std::uint32_t id_;
+        };
+
+        /**
+         * @brief Current level of something (memory in use, queue depth). Last set() wins.
+         */
+        class Gauge {
+        public:
+            explicit Gauge(std::string_view name) noexcept;
+
+            void set(std::int64_t value) noexcept;
+            void add(std::int64_t delta) noexcept;
+
+            [[nodiscard]] std::int64_t get() const noexcept;
+
+        private:
+            std::uint32_t id_;
+        };
+
+        /**
+         * @brief Distribution of values in power-of-two buckets (sizes, latencies).
+         */
+        class Histogram {
+        public:
+            explicit Histogram(std::string_view name) noexcept;
+
+            void record(std::uint64_t value) noexcept;
+
+        private:
+            std::uint32_t id_;
+        };
+
+        enum class Kind : std::uint8_t {
+            Counter,
+            Gauge,
+            Histogram
+        };
+
+        /**
+         * @brief Value of one metric at the last frame boundary.
+         */
+        struct Sample {
+            std::string name;
+            Kind kind = Kind::Counter;
+            std::uint64_t frame_value = 0;   ///< Counter: amount of the last frame. Histogram: samples of the last frame.
+            std::uint64_t total = 0;         ///< Counter: running total. Histogram: total samples.
+            std::int64_t gauge = 0;          ///< Gauge value.
+            std::uint64_t p50 = 0;           ///< Histogram, last frame: upper bound of the median bucket.
+            std::uint64_t p99 = 0;           ///< Histogram, last frame: upper bound of the p99 bucket.
+            std::uint64_t max = 0;           ///< Histogram, last frame: upper bound of the highest bucket.
+        };
+
+        /**
+         * @brief Merges every thread's shard into the frame values and totals.
+         *
+         * Called by Clock::update; also logs the metrics when a dump interval is set.
+         */
+        static void newFrame() noexcept;
+
+        /**
+         * @brief All registered metrics, as of the last newFrame().
+         */
+        [[nodiscard]] static std::vector<Sample> snapshot();
+
+        /**
+         * @brief Logs the per-frame average of every metric every @p interval_seconds (0 = off).
+         */
+        static void setDumpInterval(double interval_seconds) noexcept;
+
+        /**
+         * @brief Logs every metric now (per-frame averages since the last dump).
+         */
+        static void dump() noexcept;
+
+    private:
+        Metrics() = delete;  // no instances
+        ~Metrics() = delete;
+    };
+
+} // namespace Gem
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * If GEMENGINE_PROFILING is not defined by the build system, profile every
+ * configuration except DIST. With 0, GEM_PROFILE_ZONE compiles to nothing.
+ */
+#ifndef GEMENGINE_PROFILING
+
+    #ifdef DIST
+        #define GEMENGINE_PROFILING 0
+
+    #else
+        #define GEMENGINE_PROFILING 1
+
+    #endif
+#endif
+
+#define GEM_PROFILE_CONCAT_INNER(a, b) a##b
+#define GEM_PROFILE_CONCAT(a, b) GEM_PROFILE_CONCAT_INNER(a, b)
+
+#if GEMENGINE_PROFILING
+
+    /**
+     * @brief Profiles the rest of the enclosing scope under @p name (a string literal).
+     *
+     * The zone descriptor is a static, so entering a zone only reads the clock and
+     * pushes onto a thread-local stack.
+     */
+    #define GEM_PROFILE_ZONE(name)                                                                              \
+        static const ::Gem::Profiler::ZoneDesc GEM_PROFILE_CONCAT(gem_zone_desc_, __LINE__){ name, __FILE__, __LINE__ }; \
+        ::Gem::Profiler::Zone GEM_PROFILE_CONCAT(gem_zone_, __LINE__)(GEM_PROFILE_CONCAT(gem_zone_desc_, __LINE__))
+
+    /**
+     * @brief Profiles the enclosing function.
+     */
+    #define GEM_PROFILE_FUNCTION() GEM_PROFILE_ZONE(__func__)
+
+#else
+
+    #define GEM_PROFILE_ZONE(name) static_cast<void>(0)
+    #define GEM_PROFILE_FUNCTION() static_cast<void>(0)
+
+#endif
+
+namespace Gem {
+
+    /**
+     * @class Profiler
+     * @brief Hierarchical frame profiler.
+     *
+     * Zones record their begin/end into per-thread buffers. At every frame boundary
+     * (Clock::update) the buffers of all threads are merged into a per-frame tree with
+     * total time, self time and call counts per zone. Frames can also be captured and
+     * exported as Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+     */
+    class Profiler {
+    public:
+        /**
+         * @brief Static description of a zone. One per GEM_PROFILE_ZONE call site.
+         */
+        struct ZoneDesc {
+            const char* name;
+            const char* file;
+            int line;
+        };
+
+        /**
+         * @brief RAII zone; use GEM_PROFILE_ZONE rather than this directly.
+         */
+        class Zone {
+        public:
+            explicit Zone(const ZoneDesc& desc) noexcept;
+            ~Zone();
+
+            // No copy/move
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+            Zone(Zone&&) = delete;
+            Zone& operator=(Zone&&) = delete;
+
+        private:
+            const ZoneDesc* desc_;
+            std::int64_t start_ns_;
+        };
+
+        /**
+         * @brief One node of a frame tree. Calls of the same zone under the same parent are merged.
+         */
+        struct Node {
+            const ZoneDesc* zone = nullptr;
+            std::uint32_t thread = 0;   ///< Profiler thread index (see setThreadName()).
+            int parent = -1;            ///< Index into FrameProfile::nodes, -1 for a root.
+            int depth = 0;
+            std::uint32_t calls = 0;
+            std::int64_t total_ns = 0;
+            std::int64_t self_ns = 0;   ///< total_ns minus the time spent in child zones.
+        };
+
+        /**
+         * @brief Aggregated zones of one frame, in depth-first order per thread.
+         */
+        struct FrameProfile {
+            std::uint64_t frame_index = 0;
+            std::int64_t start_ns = 0;
+            std::int64_t end_ns = 0;
+            std::vector<Node> nodes;
+        };
+
+        //--------------------------------------------------------------------------
+        // Frames
+        //--------------------------------------------------------------------------
+        /**
+         * @brief Closes the current frame: merges every thread's zones into the frame tree.
+         *
+         * Called by Clock::update.
+         */
+        static void newFrame() noexcept;
+
+        /**
+         * @brief Returns a copy of the last completed frame.
+         */
+        [[nodiscard]] static FrameProfile getLastFrame();
+
+        /**
+         * @brief Logs the last frame tree at Info level (one line per node).
+         */
+        static void logLastFrame() noexcept;
+
+        /**
+         * @brief Adds a zone measured outside the CPU zones (e.g. GPU queries) to a named track.
+         *
+         * The track shows up like a thread in reports and traces. Times are steady_clock time
+         * points, so external zones line up with CPU zones; they are collected by the next
+         * newFrame(), whatever frame they were measured in.
+         */
+        static void recordExternalZone(const char* track, const ZoneDesc& desc, std::uint32_t depth,
+            std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) noexcept;
+
+        /**
+         * @brief Names the calling thread in traces and reports.
+         */
+        static void setThreadName(const std::string& name) noexcept;
+
+        /**
+         * @brief Enables/disables recording at runtime (zones still compile in).
+         */
+        static void setEnabled(bool enabled) noexcept;
+        [[nodiscard]] static bool isEnabled() noexcept;
+
+        //--------------------------------------------------------------------------
+        // Capture / export
+        //--------------------------------------------------------------------------
+        /**
+         * @brief Starts keeping raw zones of the next @p max_frames frames for export.
+         */
+        static void startCapture(std::size_t max_frames = 300) noexcept;
+
+        static void stopCapture() noexcept;
+
+        /**
+         * @brief Writes the captured frames as Chrome trace JSON.
+         * @return False if the file could not be written.
+         */
+        static bool exportChromeTrace(const std::string& path) noexcept;
+
+    private:
+        Profiler() = delete;  // no instances
+        ~Profiler() = delete;
+    };
+
+} // namespace Gem
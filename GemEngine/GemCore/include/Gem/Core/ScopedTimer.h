@@ -39,7 +39,7 @@ namespace Gem {
         ScopedTimer& operator=(ScopedTimer&&) = delete;
 
     private:
-        Timer timer_;
+        FastTimer timer_; ///< Owned by the creating scope: no lock, TSC timestamps.
         std::string name_;
         Logger::LogLevel logLevel_;
         bool useCallback_;
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+namespace Gem {
+
+    /**
+     * @brief Synchronization policies for BasicTimer / BasicClock.
+     *
+     * A policy provides:
+     * - Field<T>     : storage for a value read by queries (load()/store()).
+     * - WriteGuard   : RAII object held by every mutating member function.
+     * - read(f)      : runs a query so that it sees a consistent set of fields.
+     */
+    namespace ThreadPolicy {
+
+        /**
+         * @brief Plain storage for the policies that never read concurrently with a write.
+         */
+        template <typename T>
+        class PlainField {
+        public:
+            PlainField() noexcept = default;
+            explicit PlainField(T value) noexcept : value_(value) {}
+
+            [[nodiscard]] T load() const noexcept { return value_; }
+            void store(T value) noexcept { value_ = value; }
+
+        private:
+            T value_{};
+        };
+
+        /**
+         * @struct SingleThread
+         * @brief No synchronization at all. Every call must come from the same thread.
+         */
+        struct SingleThread {
+            template <typename T>
+            using Field = PlainField<T>;
+
+            class WriteGuard {
+            public:
+                explicit WriteGuard(SingleThread&) noexcept {}
+            };
+
+            template <typename F>
+            auto read(F&& query) const noexcept {
+                return query();
+            }
+        };
+
+        /**
+         * @struct Locked
+         * @brief Every call takes a mutex. Safe from any number of threads.
+         */
+        struct Locked {
+            template <typename T>
+            using Field = PlainField<T>;
+
+            class WriteGuard {
+            public:
+                explicit WriteGuard(Locked& policy) noexcept : lock_(policy.mutex_) {}
+
+            private:
+                std::lock_guard<std::mutex> lock_;
+            };
+
+            template <typename F>
+            auto read(F&& query) const noexcept {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return query();
+            }
+
+        private:
+            mutable std::mutex mutex_;
+        };
+
+        /**
+         * @struct AtomicRead
+         * @brief One writer thread, any number of lock-free readers (sequence lock).
+         *
+         * Mutating calls must all come from the same thread (e.g. the main loop); queries may
+         * come from anywhere and retry if they overlap a write, so they never block the writer.
+         */
+        struct AtomicRead {
+            template <typename T>
+            class Field {
+                static_assert(std::is_trivially_copyable_v<T>, "AtomicRead fields must be trivially copyable");
+
+            public:
+                Field() noexcept = default;
+                explicit Field(T value) noexcept : value_(value) {}
+
+                [[nodiscard]] T load() const noexcept { return value_.load(std::memory_order_relaxed); }
+                void store(T value) noexcept { value_.store(value, std::memory_order_relaxed); }
+
+            private:
+                std::atomic<T> value_{};
+            };
+
+            class WriteGuard {
+            public:
+                explicit WriteGuard(AtomicRead& policy) noexcept : sequence_(policy.sequence_) {
+                    sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); // odd: writing
+                    std::atomic_thread_fence(std::memory_order_release);
+                }
+
+                ~WriteGuard() {
+                    sequence_.store(sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_release); // even: stable
+                }
+
+            private:
+                std::atomic<std::uint32_t>& sequence_;
+            };
+
+            template <typename F>
+            auto read(F&& query) const noexcept {
+                for (;;) {
+                    std::uint32_t before = sequence_.load(std::memory_order_acquire);
+                    if (before & 1u) {
+                        continue;
+                    }
+
+                    auto result = query();
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence_.load(std::memory_order_relaxed) == before) {
+                        return result;
+                    }
+                }
+            }
+
+        private:
+            std::atomic<std::uint32_t> sequence_{ 0 };
+        };
+
+    } // namespace ThreadPolicy
+
+} // namespace Gem
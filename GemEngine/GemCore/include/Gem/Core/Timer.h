@@ -1,24 +1,32 @@
 #pragma once
 
+#include <Gem/Core/ThreadPolicy.h>
+#include <Gem/Core/TscClock.h>
+
 #include <chrono>
-#include <mutex>
 
 namespace Gem {
 
     /**
-     * @class Timer
-     * @brief A thread-safe utility class for measuring elapsed time
+     * @class BasicTimer
+     * @brief A utility class for measuring elapsed time
      *        with start, stop, pause, and reset functionality.
+     *
+     * @tparam Policy      Synchronization, see ThreadPolicy (Locked, AtomicRead, SingleThread).
+     * @tparam ClockSource std::chrono clock used for timestamps (steady_clock or TscClock).
+     *
+     * Instantiated in gemTimer.cpp for every policy with steady_clock and TscClock.
      */
-    class Timer {
+    template <typename Policy, typename ClockSource = std::chrono::steady_clock>
+    class BasicTimer {
     public:
-        using ClockType = std::chrono::steady_clock;
-        using TimePoint = std::chrono::time_point<ClockType>;
+        using ClockType = ClockSource;
+        using TimePoint = typename ClockType::time_point;
 
         /**
          * @brief Constructs a new timer instance, not running by default.
          */
-        explicit Timer() noexcept;
+        explicit BasicTimer() noexcept;
 
         /**
          * @brief Starts or restarts the timer from zero.
@@ -72,19 +80,40 @@ namespace Gem {
         [[nodiscard]] bool isPaused() const noexcept;
 
         // Delete copy/move
-        Timer(const Timer&) = delete;
-        Timer& operator=(const Timer&) = delete;
-        Timer(Timer&&) = delete;
-        Timer& operator=(Timer&&) = delete;
+        BasicTimer(const BasicTimer&) = delete;
+        BasicTimer& operator=(const BasicTimer&) = delete;
+        BasicTimer(BasicTimer&&) = delete;
+        BasicTimer& operator=(BasicTimer&&) = delete;
 
     private:
-        mutable std::mutex mutex_;
-        TimePoint start_time_;
-        TimePoint pause_time_;   ///< When we last paused the timer.
-        double accumulated_time_; ///< Elapsed time stored when paused/stopped.
+        template <typename T>
+        using Field = typename Policy::template Field<T>;
+        using WriteGuard = typename Policy::WriteGuard;
+
+        mutable Policy policy_;
+        Field<TimePoint> start_time_;
+        Field<TimePoint> pause_time_;   ///< When we last paused the timer.
+        Field<double> accumulated_time_; ///< Elapsed time stored when paused/stopped.
 
-        bool is_running_;  ///< True if actively accumulating time.
-        bool is_paused_;   ///< True if paused (not accumulating), but has some stored time.
+        Field<bool> is_running_;  ///< True if actively accumulating time.
+        Field<bool> is_paused_;   ///< True if paused (not accumulating), but has some stored time.
     };
 
+    /**
+     * @brief Thread-safe timer (mutex), usable from any thread.
+     */
+    using Timer = BasicTimer<ThreadPolicy::Locked>;
+
+    /**
+     * @brief Timer owned by one thread: no locking and TSC timestamps when available.
+     */
+    using FastTimer = BasicTimer<ThreadPolicy::SingleThread, TscClock>;
+
+    extern template class BasicTimer<ThreadPolicy::SingleThread, std::chrono::steady_clock>;
+    extern template class BasicTimer<ThreadPolicy::Locked, std::chrono::steady_clock>;
+    extern template class BasicTimer<ThreadPolicy::AtomicRead, std::chrono::steady_clock>;
+    extern template class BasicTimer<ThreadPolicy::SingleThread, TscClock>;
+    extern template class BasicTimer<ThreadPolicy::Locked, TscClock>;
+    extern template class BasicTimer<ThreadPolicy::AtomicRead, TscClock>;
+
 } // namespace Gem
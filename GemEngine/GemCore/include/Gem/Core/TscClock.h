@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define GEM_TSC_X86 1
+
+    #ifdef _MSC_VER
+        #include <intrin.h>
+
+    #else
+        #include <x86intrin.h>
+
+    #endif
+#else
+    #define GEM_TSC_X86 0
+
+#endif
+
+namespace Gem {
+
+    /**
+     * @class TscClock
+     * @brief std::chrono-compatible clock backed by the CPU time-stamp counter.
+     *
+     * On x86 CPUs with an invariant TSC (constant rate, not stopped in sleep states) now()
+     * is a single rdtsc plus a multiply. The counter is calibrated against steady_clock the
+     * first time the clock is used. Without an invariant TSC (or on other architectures)
+     * now() falls back to std::chrono::steady_clock, so the clock is always usable.
+     */
+    class TscClock {
+    public:
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::nanoseconds;
+        using time_point = std::chrono::time_point<TscClock>;
+        static constexpr bool is_steady = true;
+
+        /**
+         * @brief Current time in nanoseconds, on the same epoch as steady_clock.
+         */
+        [[nodiscard]] static time_point now() noexcept;
+
+        /**
+         * @brief Raw counter value, for timestamps stored now and converted later.
+         *
+         * The TSC when isUsingTsc(), steady_clock nanoseconds otherwise. Skips now()'s
+         * conversion: pair getTicksPerSecond() with a (ticks(), now()) sample taken at the
+         * same instant to turn it into nanoseconds offline. Calibrates on first use like now().
+         */
+        [[nodiscard]] static std::int64_t ticks() noexcept {
+            CounterSource source = counter_source_.load(std::memory_order_relaxed);
+            if (source == CounterSource::Unknown) {
+                calibrate();
+                source = counter_source_.load(std::memory_order_relaxed);
+            }
+#if GEM_TSC_X86
+            if (source == CounterSource::Tsc) {
+                return static_cast<std::int64_t>(__rdtsc());
+            }
+#endif
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Rate of ticks(): getFrequency() when using the TSC, 1e9 otherwise.
+         */
+        [[nodiscard]] static double getTicksPerSecond() noexcept;
+
+        /**
+         * @brief Calibrates the TSC now instead of on first use (takes ~10 ms).
+         */
+        static void calibrate() noexcept;
+
+        /**
+         * @brief True if now() reads the TSC, false if it falls back to steady_clock.
+         */
+        [[nodiscard]] static bool isUsingTsc() noexcept;
+
+        /**
+         * @brief Calibrated TSC frequency in Hz (0 when not using the TSC).
+         */
+        [[nodiscard]] static double getFrequency() noexcept;
+
+    private:
+        enum class CounterSource : std::uint8_t { Unknown, Tsc, Steady };
+
+        static inline std::atomic<CounterSource> counter_source_{ CounterSource::Unknown };  ///< Set by the calibration.
+
+        TscClock() = delete;  // no instances
+        ~TscClock() = delete;
+    };
+
+} // namespace Gem
@@ -0,0 +1,360 @@
+#include <EGL_Manager.h>
+#include <function_overload.h>
+#include <Gem/Core/Logger.h>
+
+// The build defines GEM_HAS_EGL=0 when libEGL is not linked, even if its headers are installed
+#if !defined(GEM_HAS_EGL) && defined(__has_include)
+    #if __has_include(<EGL/egl.h>)
+        #define GEM_HAS_EGL 1
+    #endif
+#endif
+
+#if GEM_HAS_EGL
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+    #include <cstring>
+#endif
+
+namespace Gem {
+
+#if GEM_HAS_EGL
+
+    namespace {
+
+        bool hasExtension(const char* extensions, const char* name) {
+            if (!extensions) {
+                return false;
+            }
+            std::size_t length = std::strlen(name);
+            for (const char* p = std::strstr(extensions, name); p; p = std::strstr(p + length, name)) {
+                if ((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Prefers Mesa's surfaceless platform, which never touches a display server.
+         */
+        EGLDisplay openDisplay() {
+            const char* client_extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+            if (hasExtension(client_extensions, "EGL_MESA_platform_surfaceless")) {
+                auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+                if (get_platform_display) {
+                    EGLDisplay display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+                    if (display != EGL_NO_DISPLAY) {
+                        return display;
+                    }
+                }
+            }
+
+            return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        }
+
+    } // namespace
+
+#endif
+
+    EGLManager& EGLManager::getInstance() {
+
+        static EGLManager instance;
+        return instance;
+    }
+
+    bool EGLManager::initEGL(int major, int minor) {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (initialized_) {
+            return true;
+        }
+
+#if GEM_HAS_EGL
+        GEM_LOG_DEBUG(Logger::Channel::Core, "Initializing EGL...");
+
+        EGLDisplay display = openDisplay();
+        EGLint egl_major = 0, egl_minor = 0;
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &egl_major, &egl_minor)) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to initialize EGL display! (error {})", static_cast<unsigned int>(eglGetError()));
+            return false;
+        }
+
+        bool surfaceless = hasExtension(eglQueryString(display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context");
+
+        const EGLint config_attributes[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+            EGL_NONE
+        };
+        EGLConfig config = nullptr;
+        EGLint config_count = 0;
+        if (!eglChooseConfig(display, config_attributes, &config, 1, &config_count) || config_count == 0) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "No EGL config supports desktop OpenGL!");
+            eglTerminate(display);
+            return false;
+        }
+
+        if (!eglBindAPI(EGL_OPENGL_API)) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "EGL implementation has no desktop OpenGL API!");
+            eglTerminate(display);
+            return false;
+        }
+
+        // Requested version first, then the most common software/driver limits
+        const int versions[][2] = { { major, minor }, { 4, 5 }, { 4, 3 }, { 3, 3 } };
+        EGLContext context = EGL_NO_CONTEXT;
+        int context_major = 0, context_minor = 0;
+        for (const auto& version : versions) {
+            if (version[0] * 10 + version[1] > major * 10 + minor) {
+                continue;
+            }
+            const EGLint context_attributes[] = {
+                EGL_CONTEXT_MAJOR_VERSION, version[0],
+                EGL_CONTEXT_MINOR_VERSION, version[1],
+                EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+                EGL_NONE
+            };
+            context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes);
+            if (context != EGL_NO_CONTEXT) {
+                context_major = version[0];
+                context_minor = version[1];
+                GEM_LOG_DEBUG(Logger::Channel::Core, "EGL: created OpenGL {}.{} core context.", version[0], version[1]);
+                break;
+            }
+        }
+        if (context == EGL_NO_CONTEXT) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to create EGL OpenGL context! (error {})", static_cast<unsigned int>(eglGetError()));
+            eglTerminate(display);
+            return false;
+        }
+
+        // Without surfaceless support, a tiny pbuffer keeps the context current
+        EGLSurface surface = EGL_NO_SURFACE;
+        if (!surfaceless) {
+            const EGLint pbuffer_attributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+            surface = eglCreatePbufferSurface(display, config, pbuffer_attributes);
+        }
+
+        if (!eglMakeCurrent(display, surface, surface, context)) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to make EGL context current! (error {})", static_cast<unsigned int>(eglGetError()));
+            if (surface != EGL_NO_SURFACE) {
+                eglDestroySurface(display, surface);
+            }
+            eglDestroyContext(display, context);
+            eglTerminate(display);
+            return false;
+        }
+
+        Gem::GL::invalidate_state_cache();
+
+        display_ = display;
+        context_ = context;
+        surface_ = surface;
+        config_ = config;
+        major_ = context_major;
+        minor_ = context_minor;
+        surfaceless_ = surfaceless;
+        initialized_ = true;
+        GEM_LOG_DEBUG(Logger::Channel::Core, "EGL {}.{} initialized ({}).", egl_major, egl_minor, surfaceless ? "surfaceless" : "pbuffer");
+        return true;
+#else
+        static_cast<void>(major);
+        static_cast<void>(minor);
+        GEM_LOG_ERROR(Logger::Channel::Core, "Headless mode requires EGL, which is not available in this build.");
+        return false;
+#endif
+    }
+
+    bool EGLManager::createFramebuffer(int width, int height) {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!initialized_ || framebuffer_ != 0) {
+            return framebuffer_ != 0;
+        }
+
+        GLuint framebuffer = 0, color = 0, depth = 0;
+
+        Gem::GL::gen_renderbuffers(1, &color);
+        Gem::GL::bind_renderbuffer(GL_RENDERBUFFER, color);
+        Gem::GL::renderbuffer_storage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+        Gem::GL::gen_renderbuffers(1, &depth);
+        Gem::GL::bind_renderbuffer(GL_RENDERBUFFER, depth);
+        Gem::GL::renderbuffer_storage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+
+        Gem::GL::gen_framebuffers(1, &framebuffer);
+        Gem::GL::bind_framebuffer(GL_FRAMEBUFFER, framebuffer);
+        Gem::GL::framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+        Gem::GL::framebuffer_renderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+        GLenum status = Gem::GL::check_framebuffer_status(GL_FRAMEBUFFER);
+        if (status != GL_FRAMEBUFFER_COMPLETE) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Offscreen framebuffer is incomplete! (error {})", static_cast<unsigned int>(status));
+            Gem::GL::bind_framebuffer(GL_FRAMEBUFFER, 0);
+            Gem::GL::delete_framebuffers(1, &framebuffer);
+            Gem::GL::delete_renderbuffers(1, &color);
+            Gem::GL::delete_renderbuffers(1, &depth);
+            return false;
+        }
+
+        // Stays bound: it is the default framebuffer of the headless context
+        Gem::GL::viewport(0, 0, width, height);
+
+        framebuffer_ = framebuffer;
+        color_buffer_ = color;
+        depth_buffer_ = depth;
+        width_ = width;
+        height_ = height;
+        GEM_LOG_DEBUG(Logger::Channel::Core, "Offscreen framebuffer created ({}x{}).", width, height);
+        return true;
+    }
+
+    bool EGLManager::createSharedContext(SharedContext& shared) {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!initialized_) {
+            return false;
+        }
+
+#if GEM_HAS_EGL
+        EGLDisplay display = static_cast<EGLDisplay>(display_);
+        EGLConfig config = static_cast<EGLConfig>(config_);
+
+        const EGLint context_attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major_,
+            EGL_CONTEXT_MINOR_VERSION, minor_,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        EGLContext context = eglCreateContext(display, config, static_cast<EGLContext>(context_), context_attributes);
+        if (context == EGL_NO_CONTEXT) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to create shared EGL context! (error {})", static_cast<unsigned int>(eglGetError()));
+            return false;
+        }
+
+        // A surface can only be current on one thread, so the fallback needs its own
+        EGLSurface surface = EGL_NO_SURFACE;
+        if (!surfaceless_) {
+            const EGLint pbuffer_attributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+            surface = eglCreatePbufferSurface(display, config, pbuffer_attributes);
+        }
+
+        shared.context = context;
+        shared.surface = surface;
+        return true;
+#else
+        static_cast<void>(shared);
+        return false;
+#endif
+    }
+
+    EGLManager::SharedContext EGLManager::getContext() const {
+        return SharedContext{ context_, surface_ };
+    }
+
+    bool EGLManager::makeCurrent(const SharedContext& shared) {
+
+#if GEM_HAS_EGL
+        EGLDisplay display = static_cast<EGLDisplay>(display_);
+        EGLSurface surface = shared.surface ? static_cast<EGLSurface>(shared.surface) : EGL_NO_SURFACE;
+        EGLContext context = shared.context ? static_cast<EGLContext>(shared.context) : EGL_NO_CONTEXT;
+
+        if (!eglMakeCurrent(display, surface, surface, context)) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to make shared EGL context current! (error {})", static_cast<unsigned int>(eglGetError()));
+            return false;
+        }
+        if (!shared.context) {
+            eglReleaseThread();
+        }
+        Gem::GL::invalidate_state_cache();  // The shadow described the previous context
+        return true;
+#else
+        static_cast<void>(shared);
+        return false;
+#endif
+    }
+
+    void EGLManager::destroySharedContext(SharedContext& shared) {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+#if GEM_HAS_EGL
+        if (initialized_ && shared.context) {
+            EGLDisplay display = static_cast<EGLDisplay>(display_);
+            if (shared.surface) {
+                eglDestroySurface(display, static_cast<EGLSurface>(shared.surface));
+            }
+            eglDestroyContext(display, static_cast<EGLContext>(shared.context));
+        }
+#endif
+
+        shared.context = shared.surface = nullptr;
+    }
+
+    void EGLManager::terminateEGL() {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!initialized_) {
+            return;
+        }
+
+        GEM_LOG_DEBUG(Logger::Channel::Core, "Terminating EGL.");
+
+        if (framebuffer_ != 0) {
+            Gem::GL::bind_framebuffer(GL_FRAMEBUFFER, 0);
+            Gem::GL::delete_framebuffers(1, &framebuffer_);
+            Gem::GL::delete_renderbuffers(1, &color_buffer_);
+            Gem::GL::delete_renderbuffers(1, &depth_buffer_);
+            framebuffer_ = color_buffer_ = depth_buffer_ = 0;
+        }
+
+#if GEM_HAS_EGL
+        EGLDisplay display = static_cast<EGLDisplay>(display_);
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (surface_) {
+            eglDestroySurface(display, static_cast<EGLSurface>(surface_));
+        }
+        eglDestroyContext(display, static_cast<EGLContext>(context_));
+        eglTerminate(display);
+        eglReleaseThread();
+#endif
+
+        display_ = context_ = surface_ = config_ = nullptr;
+        major_ = minor_ = 0;
+        surfaceless_ = false;
+        width_ = height_ = 0;
+        initialized_ = false;
+    }
+
+    bool EGLManager::isInitialized() const {
+        return initialized_;
+    }
+
+    unsigned int EGLManager::getFramebuffer() const {
+        return framebuffer_;
+    }
+
+    int EGLManager::getWidth() const {
+        return width_;
+    }
+
+    int EGLManager::getHeight() const {
+        return height_;
+    }
+
+    void* EGLManager::getProcAddress(const char* name) {
+#if GEM_HAS_EGL
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+#else
+        static_cast<void>(name);
+        return nullptr;
+#endif
+    }
+
+} // namespace Gem
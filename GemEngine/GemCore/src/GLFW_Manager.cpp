@@ -21,7 +21,7 @@ namespace Gem {
         }
 
         ++refCount_;
-        Logger::debug("GLFWManager: refCount incremented to {}", refCount_);
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GLFWManager: refCount incremented to {}", refCount_);
     }
 
     void GLFWManager::decrementRefCount() {
@@ -29,7 +29,7 @@ namespace Gem {
         std::lock_guard<std::mutex> lock(mutex_);
 
         --refCount_;
-        Logger::debug("GLFWManager: refCount decremented to {}", refCount_);
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GLFWManager: refCount decremented to {}", refCount_);
 
         // If reference count reaches zero, terminate GLFW
         if (refCount_ <= 0) {
@@ -43,16 +43,16 @@ namespace Gem {
             return;
         }
 
-        Logger::debug("Initializing GLFW...");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "Initializing GLFW...");
 
         if (!Gem::GLFW::init()) {
 
-            Logger::error("Failed to initialize GLFW!");
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to initialize GLFW!");
             throw std::runtime_error("Failed to initialize GLFW!");
         }
 
         initialized_ = true;
-        Logger::debug("GLFW initialized successfully.");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GLFW initialized successfully.");
     }
 
     void GLFWManager::terminateGLFW() {
@@ -61,7 +61,7 @@ namespace Gem {
             return;
         }
 
-        Logger::debug("Terminating GLFW.");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "Terminating GLFW.");
 
 		Gem::GLFW::terminate();
         initialized_ = false;
@@ -1,9 +1,15 @@
 #include <Gem/Core/GemEngine.h>
 #include <GLFW_Manager.h>
+#include <EGL_Manager.h>
+#include <NullBackend.h>
+#include <Gem/Core/GLCapture.h>
+#include <Gem/Core/JobSystem.h>
 #include <Gem/Core/Logger.h>
+#include <Gem/Core/TscClock.h>
 
 #include <function_overload.h>
 
+#include <cstdlib>
 #include <stdexcept>
 
 namespace Gem {
@@ -15,27 +21,64 @@ namespace Gem {
     }
 
     bool GemEngine::init() {
+        return init(Config{});
+    }
+
+    bool GemEngine::init(const Config& requested) {
 
         std::lock_guard<std::mutex> lock(mutex_);
         
         // If already initialized, skip initialization
         if (initialized_) {
-            Logger::debug("GemEngine: Already initialized, skipping initialization.");
+            GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Already initialized, skipping initialization.");
             return true;
         }
 
-        Logger::debug("GemEngine: Initializing...");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Initializing...");
 
+        // GEM_NULL_BACKEND=<frames> runs any program on the null backend, e.g. GemProject on a CI box
+        Config config = requested;
+        const char* null_frames = std::getenv("GEM_NULL_BACKEND");
+        if (null_frames && *null_frames) {
+            config.null_backend = true;
+            config.null_frame_limit = static_cast<unsigned int>(std::strtoul(null_frames, nullptr, 10));
+        }
+        if (config.null_backend) {
+            config.headless = false;    // Null windows stand in for real ones
+        }
 
         // Initialize OpenGL
-        if (!initOpenGL()) {
-            Logger::error("GemEngine: Failed to initialize OpenGL!");
+        bool initialized = config.null_backend ? initNull(config)
+            : config.headless ? initHeadless(config)
+            : initOpenGL();
+        if (!initialized) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "GemEngine: Failed to initialize OpenGL!");
             return false;
         }
 
+        // GEM_GL_CAPTURE=<file> records the GL calls of the whole run for GemGLReplay. It starts
+        // before the default state is applied, so the stream begins from a fresh context
+        const char* capture_path = std::getenv("GEM_GL_CAPTURE");
+        if (capture_path && *capture_path) {
+            GLCapture::begin(capture_path);
+        }
+
+        if (config.headless || config.null_backend) {
+            applyDefaultState();    // The windowed context does not exist yet; initOpenGL() set it on the temporary one
+        }
+
+        JobSystem::Config job_config;
+        job_config.worker_count = config.job_workers;
+        JobSystem::init(job_config);
+
+        // The ~10 ms TSC calibration runs here rather than inside the first timed frame
+        TscClock::calibrate();
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: TscClock {} ({} Hz).", TscClock::isUsingTsc() ? "reads the TSC" : "falls back to steady_clock", TscClock::getFrequency());
+
+        headless_ = config.headless;
         initialized_ = true;
 		running_ = true;
-        Logger::debug("GemEngine: Initialized successfully.");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Initialized successfully.");
 
         return true;
     }
@@ -45,16 +88,28 @@ namespace Gem {
         std::lock_guard<std::mutex> lock(mutex_);
         
         if (!initialized_) {
-            Logger::debug("GemEngine: Not initialized, nothing to shut down.");
+            GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Not initialized, nothing to shut down.");
             return;
         }
 
-        Logger::debug("GemEngine: Shutdown requested.");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Shutdown requested.");
+
+        // Whole-run GL call counts, when the policy counts them (Dist)
+        if (!GL::get_call_stats().empty()) {
+            GL::log_call_stats();
+        }
+
+        JobSystem::shutdown();
+        GLCapture::end();
 
         initialized_ = false;
    
-        Logger::debug("GemEngine: Shut down completely.");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Shut down completely.");
         
+        if (headless_) {
+            Gem::EGLManager::getInstance().terminateEGL();
+            headless_ = false;
+        }
 		Gem::GLFWManager::getInstance().terminateGLFW();
     }
 
@@ -62,6 +117,26 @@ namespace Gem {
         return initialized_;
     }
 
+    bool GemEngine::isHeadless() const {
+        return headless_;
+    }
+
+    bool GemEngine::readFramebuffer(std::vector<std::uint8_t>& rgba, int& width, int& height) const {
+
+        const EGLManager& egl = EGLManager::getInstance();
+        if (!headless_ || egl.getFramebuffer() == 0) {
+            return false;
+        }
+
+        width = egl.getWidth();
+        height = egl.getHeight();
+        rgba.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+
+        Gem::GL::bind_framebuffer(GL_READ_FRAMEBUFFER, egl.getFramebuffer());
+        Gem::GL::read_pixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+        return true;
+    }
+
     bool GemEngine::isRunning() {
 
         std::lock_guard<std::mutex> lock(mutex_);
@@ -83,7 +158,7 @@ namespace Gem {
 
 		Gem::GLFWManager::getInstance().initGLFW();
         
-        Logger::debug("GemEngine: Initializing OpenGL...");
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Initializing OpenGL...");
 
 		Gem::GLFW::set_context_version(4, 6);
 		Gem::GLFW::set_openGL_profile(GLFW_OPENGL_CORE_PROFILE);
@@ -91,7 +166,7 @@ namespace Gem {
         // Create temporary window for OpenGL context
         GLFWwindow* tempWindow = Gem::GLFW::create_window(1, 1, "Temp Window");
         if (!tempWindow) {
-            Logger::error("Failed to create temporary GLFW window!");
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to create temporary GLFW window!");
             return false;
         }
         Gem::GLFW::make_context_current(tempWindow);
@@ -99,39 +174,91 @@ namespace Gem {
         // Initialize GLAD
         if (!Gem::GLAD::init()) {
 
-            Logger::error("Failed to initialize GLAD!");
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to initialize GLAD!");
             glfwDestroyWindow(tempWindow);
             return false;
         }
 
+        applyDefaultState();
+
+        // Cleanup temporary window
+        Gem::GLFW::destroy_window(tempWindow);
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: OpenGL initialized successfully.");
+        return true;
+    }
+
+    bool GemEngine::initHeadless(const Config& config) {
+
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Initializing headless OpenGL...");
+
+        Gem::EGLManager& egl = Gem::EGLManager::getInstance();
+        if (!egl.initEGL(4, 6)) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to create headless EGL context!");
+            return false;
+        }
+
+        // Initialize GLAD
+        if (!Gem::GLAD::init(reinterpret_cast<GLADloadproc>(&EGLManager::getProcAddress))) {
+
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to initialize GLAD!");
+            egl.terminateEGL();
+            return false;
+        }
+
+        // Offscreen target standing in for the window's default framebuffer
+        if (!egl.createFramebuffer(config.framebuffer_width, config.framebuffer_height)) {
+            egl.terminateEGL();
+            return false;
+        }
+
+        GEM_LOG_INFO(Logger::Channel::Core, "GemEngine: Headless OpenGL {} ({}x{} offscreen framebuffer).",
+            Gem::GLAD::get_version_string(), config.framebuffer_width, config.framebuffer_height);
+        return true;
+    }
+
+    bool GemEngine::initNull(const Config& config) {
+
+        GEM_LOG_DEBUG(Logger::Channel::Core, "GemEngine: Initializing the null backend...");
+
+        Gem::NullBackend::enable(config.null_frame_limit);
+
+        // Initialize GLAD
+        if (!Gem::GLAD::init(reinterpret_cast<GLADloadproc>(&NullBackend::getProcAddress))) {
+
+            GEM_LOG_ERROR(Logger::Channel::Core, "Failed to initialize GLAD!");
+            return false;
+        }
+
+        GEM_LOG_INFO(Logger::Channel::Core, "GemEngine: Null backend, OpenGL {} (no GL calls reach a driver).",
+            Gem::GLAD::get_version_string());
+        return true;
+    }
+
+    void GemEngine::applyDefaultState() {
+
         bool depth_test = true;
         bool cull_face = true;
         bool blending = true;
         bool multisampling = true;
 
-        depth_test ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+        depth_test ? Gem::GL::enable(GL_DEPTH_TEST) : Gem::GL::disable(GL_DEPTH_TEST);
 
         if (cull_face) {
-            glEnable(GL_CULL_FACE);
-            glCullFace(GL_BACK);
-            glFrontFace(GL_CW);
+            Gem::GL::enable(GL_CULL_FACE);
+            Gem::GL::cull_face(GL_BACK);
+            Gem::GL::front_face(GL_CW);
         }
         else 
-            glDisable(GL_CULL_FACE);
+            Gem::GL::disable(GL_CULL_FACE);
 
         if (blending) {
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            Gem::GL::enable(GL_BLEND);
+            Gem::GL::blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         }
         else 
-            glDisable(GL_BLEND);
-
-        multisampling ? glEnable(GL_MULTISAMPLE) : glDisable(GL_MULTISAMPLE);
+            Gem::GL::disable(GL_BLEND);
 
-        // Cleanup temporary window
-        Gem::GLFW::destroy_window(tempWindow);
-        Logger::debug("GemEngine: OpenGL initialized successfully.");
-        return true;
+        multisampling ? Gem::GL::enable(GL_MULTISAMPLE) : Gem::GL::disable(GL_MULTISAMPLE);
     }
 
 } // namespace Gem
\ No newline at end of file
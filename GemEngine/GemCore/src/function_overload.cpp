@@ -1,16 +1,228 @@
 #include <function_overload.h>
+#include <GLCaptureRecord.h>
+#include <GLPolicy.h>
+#include <NullBackend.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
 #include <stdexcept>
 
 namespace Gem {
 
+	namespace {
+
+		Metrics::Counter draw_calls_("gl.draw_calls");
+		Metrics::Counter draw_indices_("gl.draw_indices");
+
+		Metrics::Counter elided_buffer_binds_("gl.elided_buffer_binds");
+		Metrics::Counter elided_vertex_array_binds_("gl.elided_vertex_array_binds");
+		Metrics::Counter elided_program_binds_("gl.elided_program_binds");
+		Metrics::Counter elided_active_texture_("gl.elided_active_texture");
+		Metrics::Counter elided_texture_binds_("gl.elided_texture_binds");
+
+		/**
+		 * Shadow of the bindings of the context current on this thread. Contexts are only ever
+		 * current on one thread at a time, so one shadow per thread is one per context as long as
+		 * make_context_current() (or invalidate_state_cache()) is called when switching.
+		 */
+		struct StateCache {
+			static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;	// Forces the next bind through
+			static constexpr int BUFFER_TARGETS = 14;
+			static constexpr int TEXTURE_TARGETS = 11;
+			static constexpr GLuint TEXTURE_UNITS = 32;	// Higher units are not cached
+
+			GLuint buffers[BUFFER_TARGETS];
+			GLuint vertex_array;
+			GLuint program;
+			GLuint active_unit;
+			GLuint textures[TEXTURE_UNITS][TEXTURE_TARGETS];
+
+			StateCache() noexcept {
+				reset();
+			}
+
+			void reset() noexcept {
+				for (GLuint& buffer : buffers) {
+					buffer = UNKNOWN;
+				}
+				vertex_array = UNKNOWN;
+				program = UNKNOWN;
+				active_unit = UNKNOWN;
+				for (auto& unit : textures) {
+					for (GLuint& texture : unit) {
+						texture = UNKNOWN;
+					}
+				}
+			}
+		};
+
+		std::mutex call_sites_mutex_;			///< Guards the list below.
+		GLPolicy::Site* call_sites_ = nullptr;	///< Wrappers seen by the Counting policy.
+
+		thread_local StateCache state_cache_;
+		std::atomic<bool> state_cache_enabled_{ true };
+
+		bool stateCacheEnabled() noexcept {
+			return state_cache_enabled_.load(std::memory_order_relaxed);
+		}
+
+		int bufferTargetIndex(GLenum target) noexcept {
+			switch (target) {
+				case GL_ARRAY_BUFFER:				return 0;
+				case GL_ELEMENT_ARRAY_BUFFER:		return 1;	// Part of the bound VAO
+				case GL_UNIFORM_BUFFER:				return 2;
+				case GL_COPY_READ_BUFFER:			return 3;
+				case GL_COPY_WRITE_BUFFER:			return 4;
+				case GL_PIXEL_PACK_BUFFER:			return 5;
+				case GL_PIXEL_UNPACK_BUFFER:		return 6;
+				case GL_TEXTURE_BUFFER:				return 7;
+				case GL_TRANSFORM_FEEDBACK_BUFFER:	return 8;
+				case GL_DRAW_INDIRECT_BUFFER:		return 9;
+				case GL_DISPATCH_INDIRECT_BUFFER:	return 10;
+				case GL_SHADER_STORAGE_BUFFER:		return 11;
+				case GL_ATOMIC_COUNTER_BUFFER:		return 12;
+				case GL_QUERY_BUFFER:				return 13;
+				default:							return -1;
+			}
+		}
+
+		int textureTargetIndex(GLenum target) noexcept {
+			switch (target) {
+				case GL_TEXTURE_1D:						return 0;
+				case GL_TEXTURE_2D:						return 1;
+				case GL_TEXTURE_3D:						return 2;
+				case GL_TEXTURE_1D_ARRAY:				return 3;
+				case GL_TEXTURE_2D_ARRAY:				return 4;
+				case GL_TEXTURE_RECTANGLE:				return 5;
+				case GL_TEXTURE_CUBE_MAP:				return 6;
+				case GL_TEXTURE_CUBE_MAP_ARRAY:			return 7;
+				case GL_TEXTURE_BUFFER:					return 8;
+				case GL_TEXTURE_2D_MULTISAMPLE:			return 9;
+				case GL_TEXTURE_2D_MULTISAMPLE_ARRAY:	return 10;
+				default:								return -1;
+			}
+		}
+
+		//|========================================================= Capture =========================================================================================
+
+		using GLCaptureFormat::Call;
+		using GLCaptureFormat::UniformType;
+
+		/**
+		 * Gen* and Delete* calls: the count and the names, so the replayer can map them to its own.
+		 */
+		void captureNames(Call call, GLsizei n, const GLuint* names) {
+			GLCaptureRecord(call) << n << GLCaptureRecord::Blob{ names, static_cast<std::size_t>(n) * sizeof(GLuint) };
+		}
+
+		template <typename T>
+		void captureUniform(UniformType type, std::uint8_t components, GLint location, GLsizei count, const T* values) {
+			GLCaptureRecord(Call::Uniform) << type << components << location << count
+				<< GLCaptureRecord::Blob{ values, static_cast<std::size_t>(count) * components * sizeof(T) };
+		}
+
+		/**
+		 * Range written through a persistent mapping (GL::mark_mapped_write), recorded before the
+		 * next draw on this thread.
+		 */
+		struct MappedWrite {
+			GLuint buffer;
+			GLintptr offset;
+			GLsizeiptr size;
+			const void* data;
+		};
+		thread_local std::vector<MappedWrite> mapped_writes_;
+
+		void captureMappedWrites() {
+			for (const MappedWrite& write : mapped_writes_) {
+				GLCaptureRecord(Call::BufferWrite) << write.buffer << GLCaptureRecord::i64(write.offset)
+					<< GLCaptureRecord::Blob{ write.data, static_cast<std::size_t>(write.size) };
+			}
+			mapped_writes_.clear();
+		}
+
+		void captureUniformMatrix(std::uint8_t columns, std::uint8_t rows, GLint location, GLsizei count, GLboolean transpose, const GLfloat* values) {
+			GLCaptureRecord(Call::UniformMatrix) << columns << rows << location << count << transpose
+				<< GLCaptureRecord::Blob{ values, static_cast<std::size_t>(count) * columns * rows * sizeof(GLfloat) };
+		}
+
+		/**
+		 * Bytes glTex(Sub)Image reads from @p pixels, with the default GL_UNPACK_ALIGNMENT of 4
+		 * (the wrappers have no glPixelStore).
+		 */
+		GLCaptureRecord::Blob pixelBlob(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) noexcept {
+			std::size_t components = 4;
+			switch (format) {
+				case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: case GL_DEPTH_STENCIL:
+					components = 1; break;
+				case GL_RG: case GL_RG_INTEGER:
+					components = 2; break;
+				case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+					components = 3; break;
+				default:
+					break;
+			}
+
+			std::size_t pixel_size = 0;
+			switch (type) {
+				case GL_UNSIGNED_BYTE: case GL_BYTE:
+					pixel_size = components; break;
+				case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+					pixel_size = components * 2; break;
+				case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+					pixel_size = components * 4; break;
+				case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+					pixel_size = 8; break;
+				case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+					pixel_size = 1; break;
+				case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+				case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+				case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+					pixel_size = 2; break;
+				default:	// Packed 32-bit types (8_8_8_8, 10_10_10_2, 24_8, 10F_11F_11F...)
+					pixel_size = 4; break;
+			}
+
+			std::size_t rows = static_cast<std::size_t>(height) * static_cast<std::size_t>(depth);
+			if (!pixels || width <= 0 || rows == 0) {
+				return { pixels, 0 };
+			}
+			std::size_t row_size = static_cast<std::size_t>(width) * pixel_size;
+			std::size_t stride = (row_size + 3) & ~static_cast<std::size_t>(3);
+			return { pixels, stride * (rows - 1) + row_size };	// The last row is not padded
+		}
+
+	} // namespace
+
+	void GLPolicy::registerSite(Site& site) noexcept {
+		std::lock_guard<std::mutex> lock(call_sites_mutex_);
+		if (site.registered.load(std::memory_order_relaxed)) {
+			return;		// Raced with another thread
+		}
+		site.next = call_sites_;
+		call_sites_ = &site;
+		site.registered.store(true, std::memory_order_relaxed);
+	}
+
 	namespace GLAD {
 
 		//|========================================================= Init =========================================================================================
 
 		int init() {
+			if (NullBackend::isEnabled()) {
+				return gladLoadGLLoader(reinterpret_cast<GLADloadproc>(&NullBackend::getProcAddress));
+			}
 			return gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
 		}
 
+		int init(GLADloadproc loader) {
+			return gladLoadGLLoader(loader);
+		}
+
 		//|========================================================= Version =========================================================================================
 
 		std::string get_version_string() {
@@ -29,122 +241,263 @@ namespace Gem {
 	namespace GLFW {
 
 		bool init() {
+			if (NullBackend::isEnabled()) {
+				return true;
+			}
 			return glfwInit();
 		}
 
 		void terminate() {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwTerminate();
 		}
 		//|========================================================= Context - Profile =========================================================================================
 
 		void window_hint(int hint, int value) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwWindowHint(hint, value);
 		}
 
 		void set_context_version(int major, int minor) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, major);
 			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, minor);
 		}
 
 		void set_openGL_profile(int profile) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwWindowHint(GLFW_OPENGL_PROFILE, profile);
 		}
 
 		//|========================================================= Window =========================================================================================
 
 		void set_window_resizable(bool resizable) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwWindowHint(GLFW_RESIZABLE, resizable ? GLFW_TRUE : GLFW_FALSE);
 		}
 
 		GLFWwindow* create_window(int width, int height, const std::string& title) {
+			if (NullBackend::isEnabled()) {
+				return NullBackend::createWindow(width, height, title.c_str());
+			}
 			return glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
 		}
 
+		GLFWwindow* create_window(int width, int height, const std::string& title, GLFWwindow* share) {
+			if (NullBackend::isEnabled()) {
+				return NullBackend::createWindow(width, height, title.c_str());	// All null contexts share
+			}
+			return glfwCreateWindow(width, height, title.c_str(), nullptr, share);
+		}
+
 		void make_context_current(GLFWwindow* window) {
-			glfwMakeContextCurrent(window);
+			if (NullBackend::isEnabled()) {
+				NullBackend::makeContextCurrent(window);
+			}
+			else {
+				glfwMakeContextCurrent(window);
+			}
+			GL::invalidate_state_cache();	// The shadow described the previous context
+		}
+
+		GLFWwindow* get_current_context() {
+			if (NullBackend::isEnabled()) {
+				return NullBackend::getCurrentContext();
+			}
+			return glfwGetCurrentContext();
 		}
 
 		void set_swap_interval(int interval) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwSwapInterval(interval);
 		}
 
 		void set_window_user_pointer(GLFWwindow* window, void* pointer) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->user_pointer = pointer;
+				}
+				return;
+			}
 			glfwSetWindowUserPointer(window, pointer);
 		}
 
 		void* get_window_user_pointer(GLFWwindow* window) {
+			if (NullBackend::isEnabled()) {
+				NullBackend::Window* state = NullBackend::getWindow(window);
+				return state ? state->user_pointer : nullptr;
+			}
 			return glfwGetWindowUserPointer(window);
 		}
 
 		void set_window_should_close(GLFWwindow* window, int value) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->should_close = value;
+				}
+				return;
+			}
 			glfwSetWindowShouldClose(window, value);
 		}
 
 		void set_window_size(GLFWwindow* window, int width, int height) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->width = width;
+					state->height = height;
+					state->resized = true;
+				}
+				return;
+			}
 			glfwSetWindowSize(window, width, height);
 		}
 
 		void set_window_title(GLFWwindow* window, const char* title) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->title = title;
+				}
+				return;
+			}
 			glfwSetWindowTitle(window, title);
 		}
 
 		int window_should_close(GLFWwindow* window) {
+			if (NullBackend::isEnabled()) {
+				NullBackend::Window* state = NullBackend::getWindow(window);
+				return state ? state->should_close : GLFW_TRUE;
+			}
 			return glfwWindowShouldClose(window);
 		}
 
 		void destroy_window(GLFWwindow* window) {
+			if (NullBackend::isEnabled()) {
+				NullBackend::destroyWindow(window);
+				return;
+			}
 			glfwDestroyWindow(window);
 		}
 
 		void set_mouse_button_callback(GLFWwindow* window, GLFWmousebuttonfun callback) {
+			if (NullBackend::isEnabled()) {
+				return;	// No input
+			}
 			glfwSetMouseButtonCallback(window, callback);
 		}
 
 		void set_key_callback(GLFWwindow* window, GLFWkeyfun callback) {
+			if (NullBackend::isEnabled()) {
+				return;	// No input
+			}
 			glfwSetKeyCallback(window, callback);
 		}
 
 		void set_framebuffer_size_callback(GLFWwindow* window, GLFWframebuffersizefun callback) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->framebuffer_size_callback = callback;
+				}
+				return;
+			}
 			glfwSetFramebufferSizeCallback(window, callback);
 		}
 
 		void set_input_mode(GLFWwindow* window, int mode, int value) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwSetInputMode(window, mode, value);
 		}
 
 		void set_cursor_pos(GLFWwindow* window, double xpos, double ypos) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->cursor_x = xpos;
+					state->cursor_y = ypos;
+				}
+				return;
+			}
 			glfwSetCursorPos(window, xpos, ypos);
 		}
 
 		void get_cursor_pos(GLFWwindow* window, double* xpos, double* ypos) {
+			if (NullBackend::isEnabled()) {
+				NullBackend::Window* state = NullBackend::getWindow(window);
+				*xpos = state ? state->cursor_x : 0.0;
+				*ypos = state ? state->cursor_y : 0.0;
+				return;
+			}
 			glfwGetCursorPos(window, xpos, ypos);
 		}
 
 		void set_cursor_mode(GLFWwindow* window, int mode) {
+			if (NullBackend::isEnabled()) {
+				return;
+			}
 			glfwSetInputMode(window, GLFW_CURSOR, mode);
 		}
 
 		void set_cursor_pos_callback(GLFWwindow* window, GLFWcursorposfun callback) {
+			if (NullBackend::isEnabled()) {
+				return;	// No input
+			}
 			glfwSetCursorPosCallback(window, callback);
 		}
 
 		void set_scroll_callback(GLFWwindow* window, GLFWscrollfun callback) {
+			if (NullBackend::isEnabled()) {
+				return;	// No input
+			}
 			glfwSetScrollCallback(window, callback);
 		}
 
 		void set_window_size_callback(GLFWwindow* window, GLFWwindowsizefun callback) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->window_size_callback = callback;
+				}
+				return;
+			}
 			glfwSetWindowSizeCallback(window, callback);
 		}
 
 		void set_window_close_callback(GLFWwindow* window, GLFWwindowclosefun callback) {
+			if (NullBackend::isEnabled()) {
+				if (NullBackend::Window* state = NullBackend::getWindow(window)) {
+					state->window_close_callback = callback;
+				}
+				return;
+			}
 			glfwSetWindowCloseCallback(window, callback);
 		}
 
 		void swap_buffers(GLFWwindow* window) {
-			glfwSwapBuffers(window);
+			if (NullBackend::isEnabled()) {
+				NullBackend::swapBuffers(window);
+			}
+			else {
+				glfwSwapBuffers(window);
+			}
+			GLCapture::endFrame();
 		}
 
 		void poll_events() {
+			if (NullBackend::isEnabled()) {
+				NullBackend::pollEvents();
+				return;
+			}
 			glfwPollEvents();
 		}
 
@@ -155,334 +508,947 @@ namespace Gem {
 		//|========================================================= Uniforms =============================================================================================
 
 		GLint get_uniform_location(GLuint program, const std::string& name) {
-			return glGetUniformLocation(program, name.c_str());
+			GLint location = GEM_GL_CALL("get_uniform_location", 0, glGetUniformLocation(program, name.c_str()));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::GetUniformLocation) << program << GLCaptureRecord::Blob{ name.data(), name.size() } << location;
+			}
+			return location;
+		}
+
+		GLuint get_uniform_block_index(GLuint program, const std::string& name) {
+			GLuint index = GEM_GL_CALL("get_uniform_block_index", 0, glGetUniformBlockIndex(program, name.c_str()));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::GetUniformBlockIndex) << program << GLCaptureRecord::Blob{ name.data(), name.size() } << index;
+			}
+			return index;
+		}
+
+		void uniform_block_binding(GLuint program, GLuint index, GLuint binding) {
+			GEM_GL_CALL("uniform_block_binding", 0, glUniformBlockBinding(program, index, binding));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::UniformBlockBinding) << program << index << binding;
+			}
 		}
 
 		void set_uniform_matrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix2fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix2fv", static_cast<std::size_t>(count) * 4 * sizeof(GLfloat), glUniformMatrix2fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(2, 2, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix3fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix3fv", static_cast<std::size_t>(count) * 9 * sizeof(GLfloat), glUniformMatrix3fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(3, 3, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix4fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix4fv", static_cast<std::size_t>(count) * 16 * sizeof(GLfloat), glUniformMatrix4fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(4, 4, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix2x3fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix2x3fv", static_cast<std::size_t>(count) * 6 * sizeof(GLfloat), glUniformMatrix2x3fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(2, 3, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix3x2fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix3x2fv", static_cast<std::size_t>(count) * 6 * sizeof(GLfloat), glUniformMatrix3x2fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(3, 2, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix2x4fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix2x4fv", static_cast<std::size_t>(count) * 8 * sizeof(GLfloat), glUniformMatrix2x4fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(2, 4, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix4x2fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix4x2fv", static_cast<std::size_t>(count) * 8 * sizeof(GLfloat), glUniformMatrix4x2fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(4, 2, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix3x4fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix3x4fv", static_cast<std::size_t>(count) * 12 * sizeof(GLfloat), glUniformMatrix3x4fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(3, 4, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform_matrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
-			glUniformMatrix4x3fv(location, count, transpose, value);
+			GEM_GL_CALL("set_uniform_matrix4x3fv", static_cast<std::size_t>(count) * 12 * sizeof(GLfloat), glUniformMatrix4x3fv(location, count, transpose, value));
+			if (GLCapture::isCapturing()) {
+				captureUniformMatrix(4, 3, location, count, transpose, value);
+			}
 		}
 
 		void set_uniform1i(GLint location, GLint v0) {
-			glUniform1i(location, v0);
+			GEM_GL_CALL("set_uniform1i", 0, glUniform1i(location, v0));
+			if (GLCapture::isCapturing()) {
+				const GLint values[] = { v0 };
+				captureUniform(UniformType::Int, 1, location, 1, values);
+			}
 		}
 
 		void set_uniform2i(GLint location, GLint v0, GLint v1) {
-			glUniform2i(location, v0, v1);
+			GEM_GL_CALL("set_uniform2i", 0, glUniform2i(location, v0, v1));
+			if (GLCapture::isCapturing()) {
+				const GLint values[] = { v0, v1 };
+				captureUniform(UniformType::Int, 2, location, 1, values);
+			}
 		}
 
 		void set_uniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
-			glUniform3i(location, v0, v1, v2);
+			GEM_GL_CALL("set_uniform3i", 0, glUniform3i(location, v0, v1, v2));
+			if (GLCapture::isCapturing()) {
+				const GLint values[] = { v0, v1, v2 };
+				captureUniform(UniformType::Int, 3, location, 1, values);
+			}
 		}
 
 		void set_uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
-			glUniform4i(location, v0, v1, v2, v3);
+			GEM_GL_CALL("set_uniform4i", 0, glUniform4i(location, v0, v1, v2, v3));
+			if (GLCapture::isCapturing()) {
+				const GLint values[] = { v0, v1, v2, v3 };
+				captureUniform(UniformType::Int, 4, location, 1, values);
+			}
 		}
 
 		void set_uniform1iv(GLint location, GLsizei count, const GLint* value) {
-			glUniform1iv(location, count, value);
+			GEM_GL_CALL("set_uniform1iv", static_cast<std::size_t>(count) * 1 * sizeof(*value), glUniform1iv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Int, 1, location, count, value);
+			}
 		}
 
 		void set_uniform2iv(GLint location, GLsizei count, const GLint* value) {
-			glUniform2iv(location, count, value);
+			GEM_GL_CALL("set_uniform2iv", static_cast<std::size_t>(count) * 2 * sizeof(*value), glUniform2iv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Int, 2, location, count, value);
+			}
 		}
 
 		void set_uniform3iv(GLint location, GLsizei count, const GLint* value) {
-			glUniform3iv(location, count, value);
+			GEM_GL_CALL("set_uniform3iv", static_cast<std::size_t>(count) * 3 * sizeof(*value), glUniform3iv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Int, 3, location, count, value);
+			}
 		}
 
 		void set_uniform4iv(GLint location, GLsizei count, const GLint* value) {
-			glUniform4iv(location, count, value);
+			GEM_GL_CALL("set_uniform4iv", static_cast<std::size_t>(count) * 4 * sizeof(*value), glUniform4iv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Int, 4, location, count, value);
+			}
 		}
 
 		void set_uniform1f(GLint location, GLfloat v0) {
-			glUniform1f(location, v0);
+			GEM_GL_CALL("set_uniform1f", 0, glUniform1f(location, v0));
+			if (GLCapture::isCapturing()) {
+				const GLfloat values[] = { v0 };
+				captureUniform(UniformType::Float, 1, location, 1, values);
+			}
 		}
 
 		void set_uniform2f(GLint location, GLfloat v0, GLfloat v1) {
-			glUniform2f(location, v0, v1);
+			GEM_GL_CALL("set_uniform2f", 0, glUniform2f(location, v0, v1));
+			if (GLCapture::isCapturing()) {
+				const GLfloat values[] = { v0, v1 };
+				captureUniform(UniformType::Float, 2, location, 1, values);
+			}
 		}
 
 		void set_uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
-			glUniform3f(location, v0, v1, v2);
+			GEM_GL_CALL("set_uniform3f", 0, glUniform3f(location, v0, v1, v2));
+			if (GLCapture::isCapturing()) {
+				const GLfloat values[] = { v0, v1, v2 };
+				captureUniform(UniformType::Float, 3, location, 1, values);
+			}
 		}
 
 		void set_uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
-			glUniform4f(location, v0, v1, v2, v3);
+			GEM_GL_CALL("set_uniform4f", 0, glUniform4f(location, v0, v1, v2, v3));
+			if (GLCapture::isCapturing()) {
+				const GLfloat values[] = { v0, v1, v2, v3 };
+				captureUniform(UniformType::Float, 4, location, 1, values);
+			}
 		}
 
 		void set_uniform1fv(GLint location, GLsizei count, const GLfloat* value) {
-			glUniform1fv(location, count, value);
+			GEM_GL_CALL("set_uniform1fv", static_cast<std::size_t>(count) * 1 * sizeof(*value), glUniform1fv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Float, 1, location, count, value);
+			}
 		}
 
 		void set_uniform2fv(GLint location, GLsizei count, const GLfloat* value) {
-			glUniform2fv(location, count, value);
+			GEM_GL_CALL("set_uniform2fv", static_cast<std::size_t>(count) * 2 * sizeof(*value), glUniform2fv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Float, 2, location, count, value);
+			}
 		}
 
 		void set_uniform3fv(GLint location, GLsizei count, const GLfloat* value) {
-			glUniform3fv(location, count, value);
+			GEM_GL_CALL("set_uniform3fv", static_cast<std::size_t>(count) * 3 * sizeof(*value), glUniform3fv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Float, 3, location, count, value);
+			}
 		}
 
 		void set_uniform4fv(GLint location, GLsizei count, const GLfloat* value) {
-			glUniform4fv(location, count, value);
+			GEM_GL_CALL("set_uniform4fv", static_cast<std::size_t>(count) * 4 * sizeof(*value), glUniform4fv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::Float, 4, location, count, value);
+			}
 		}
 
 		void set_uniform1ui(GLint location, GLuint v0) {
-			glUniform1ui(location, v0);
+			GEM_GL_CALL("set_uniform1ui", 0, glUniform1ui(location, v0));
+			if (GLCapture::isCapturing()) {
+				const GLuint values[] = { v0 };
+				captureUniform(UniformType::UInt, 1, location, 1, values);
+			}
 		}
 
 		void set_uniform2ui(GLint location, GLuint v0, GLuint v1) {
-			glUniform2ui(location, v0, v1);
+			GEM_GL_CALL("set_uniform2ui", 0, glUniform2ui(location, v0, v1));
+			if (GLCapture::isCapturing()) {
+				const GLuint values[] = { v0, v1 };
+				captureUniform(UniformType::UInt, 2, location, 1, values);
+			}
 		}
 
 		void set_uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
-			glUniform3ui(location, v0, v1, v2);
+			GEM_GL_CALL("set_uniform3ui", 0, glUniform3ui(location, v0, v1, v2));
+			if (GLCapture::isCapturing()) {
+				const GLuint values[] = { v0, v1, v2 };
+				captureUniform(UniformType::UInt, 3, location, 1, values);
+			}
 		}
 
 		void set_uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
-			glUniform4ui(location, v0, v1, v2, v3);
+			GEM_GL_CALL("set_uniform4ui", 0, glUniform4ui(location, v0, v1, v2, v3));
+			if (GLCapture::isCapturing()) {
+				const GLuint values[] = { v0, v1, v2, v3 };
+				captureUniform(UniformType::UInt, 4, location, 1, values);
+			}
 		}
 
 		void set_uniform1uiv(GLint location, GLsizei count, const GLuint* value) {
-			glUniform1uiv(location, count, value);
+			GEM_GL_CALL("set_uniform1uiv", static_cast<std::size_t>(count) * 1 * sizeof(*value), glUniform1uiv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::UInt, 1, location, count, value);
+			}
 		}
 
 		void set_uniform2uiv(GLint location, GLsizei count, const GLuint* value) {
-			glUniform2uiv(location, count, value);
+			GEM_GL_CALL("set_uniform2uiv", static_cast<std::size_t>(count) * 2 * sizeof(*value), glUniform2uiv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::UInt, 2, location, count, value);
+			}
 		}
 
 		void set_uniform3uiv(GLint location, GLsizei count, const GLuint* value) {
-			glUniform3uiv(location, count, value);
+			GEM_GL_CALL("set_uniform3uiv", static_cast<std::size_t>(count) * 3 * sizeof(*value), glUniform3uiv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::UInt, 3, location, count, value);
+			}
 		}
 
 		void set_uniform4uiv(GLint location, GLsizei count, const GLuint* value) {
-			glUniform4uiv(location, count, value);
+			GEM_GL_CALL("set_uniform4uiv", static_cast<std::size_t>(count) * 4 * sizeof(*value), glUniform4uiv(location, count, value));
+			if (GLCapture::isCapturing()) {
+				captureUniform(UniformType::UInt, 4, location, count, value);
+			}
 		}
 
 		//|========================================================= Textures ==============================================================================================
 
 		void tex_parameteri(GLenum target, GLenum pname, GLint param) {
-			glTexParameteri(target, pname, param);
+			GEM_GL_CALL("tex_parameteri", 0, glTexParameteri(target, pname, param));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexParameteri) << target << pname << param;
+			}
 		}
 
 		void delete_textures(GLsizei n, const GLuint* textures) {
-			glDeleteTextures(n, textures);
+			GEM_GL_CALL("delete_textures", 0, glDeleteTextures(n, textures));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::DeleteTextures, n, textures);
+			}
+
+			// Deleted textures revert to 0 in every unit they were bound to
+			for (GLsizei i = 0; i < n; ++i) {
+				for (auto& unit : state_cache_.textures) {
+					for (GLuint& texture : unit) {
+						if (texture == textures[i]) {
+							texture = 0;
+						}
+					}
+				}
+			}
 		}
 
 		void tex_storage_3d(GLenum target, GLsizei levels, GLenum internalformat,
 			GLsizei width, GLsizei height, GLsizei depth) {
-			glTexStorage3D(target, levels, internalformat, width, height, depth);
+			GEM_GL_CALL("tex_storage_3d", 0, glTexStorage3D(target, levels, internalformat, width, height, depth));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexStorage3D) << target << levels << internalformat << width << height << depth;
+			}
 		}
 
 		void gen_textures(GLsizei n, GLuint* textures) {
-			glGenTextures(n, textures);
+			GEM_GL_CALL("gen_textures", 0, glGenTextures(n, textures));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::GenTextures, n, textures);
+			}
 		}
 
 		void active_texture(GLenum texture) {
-			glActiveTexture(texture);
+			GLuint unit = texture - GL_TEXTURE0;
+			if (stateCacheEnabled() && state_cache_.active_unit == unit) {
+				elided_active_texture_.add();
+				return;
+			}
+			GEM_GL_CALL("active_texture", 0, glActiveTexture(texture));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::ActiveTexture) << texture;
+			}
+			state_cache_.active_unit = unit;
 		}
 
 		void bind_texture(GLenum target, GLuint texture) {
-			glBindTexture(target, texture);
+			GLuint unit = state_cache_.active_unit;
+			int index = textureTargetIndex(target);
+			if (unit >= StateCache::TEXTURE_UNITS || index < 0) {
+				GEM_GL_CALL("bind_texture", 0, glBindTexture(target, texture));	// Not tracked
+				if (GLCapture::isCapturing()) {
+					GLCaptureRecord(Call::BindTexture) << target << texture;
+				}
+				return;
+			}
+
+			GLuint& bound = state_cache_.textures[unit][index];
+			if (stateCacheEnabled() && bound == texture) {
+				elided_texture_binds_.add();
+				return;
+			}
+			GEM_GL_CALL("bind_texture", 0, glBindTexture(target, texture));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindTexture) << target << texture;
+			}
+			bound = texture;
 		}
 
 		void generate_mipmap(GLenum target) {
-			glGenerateMipmap(target);
+			GEM_GL_CALL("generate_mipmap", 0, glGenerateMipmap(target));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::GenerateMipmap) << target;
+			}
 		}
 
 		void tex_image_3d(GLenum target, GLint level, GLint internalformat,
 			GLsizei width, GLsizei height, GLsizei depth, GLint border,
 			GLenum format, GLenum type, const void* pixels) {
-			glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+			GEM_GL_CALL("tex_image_3d", pixelBlob(width, height, depth, format, type, pixels).size, glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexImage3D) << target << level << internalformat << width << height << depth << border << format << type
+					<< pixelBlob(width, height, depth, format, type, pixels);
+			}
 		}
 
 		void tex_sub_image_3d(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
 			GLsizei width, GLsizei height, GLsizei depth,
 			GLenum format, GLenum type, const void* pixels) {
-			glTexSubImage3D(target, level, xoffset, yoffset, zoffset,
-				width, height, depth, format, type, pixels);
+			GEM_GL_CALL("tex_sub_image_3d", pixelBlob(width, height, depth, format, type, pixels).size, glTexSubImage3D(target, level, xoffset, yoffset, zoffset,
+					width, height, depth, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexSubImage3D) << target << level << xoffset << yoffset << zoffset << width << height << depth << format << type
+					<< pixelBlob(width, height, depth, format, type, pixels);
+			}
 		}
 
 		void tex_image_2d(GLenum target, GLint level, GLint internalformat,
 			GLsizei width, GLsizei height, GLint border,
 			GLenum format, GLenum type, const void* pixels) {
-			glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+			GEM_GL_CALL("tex_image_2d", pixelBlob(width, height, 1, format, type, pixels).size, glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexImage2D) << target << level << internalformat << width << height << border << format << type
+					<< pixelBlob(width, height, 1, format, type, pixels);
+			}
 		}
 
 		void tex_sub_image_2d(GLenum target, GLint level, GLint xoffset, GLint yoffset,
 			GLsizei width, GLsizei height,
 			GLenum format, GLenum type, const void* pixels) {
-			glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+			GEM_GL_CALL("tex_sub_image_2d", pixelBlob(width, height, 1, format, type, pixels).size, glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexSubImage2D) << target << level << xoffset << yoffset << width << height << format << type
+					<< pixelBlob(width, height, 1, format, type, pixels);
+			}
 		}
 
 		void tex_storage_2d(GLenum target, GLsizei levels, GLenum internalformat,
 			GLsizei width, GLsizei height) {
-			glTexStorage2D(target, levels, internalformat, width, height);
+			GEM_GL_CALL("tex_storage_2d", 0, glTexStorage2D(target, levels, internalformat, width, height));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexStorage2D) << target << levels << internalformat << width << height;
+			}
 		}
 
 		void tex_image_1d(GLenum target, GLint level, GLint internalformat,
 			GLsizei width, GLint border,
 			GLenum format, GLenum type, const void* pixels) {
-			glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+			GEM_GL_CALL("tex_image_1d", pixelBlob(width, 1, 1, format, type, pixels).size, glTexImage1D(target, level, internalformat, width, border, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TexImage1D) << target << level << internalformat << width << border << format << type
+					<< pixelBlob(width, 1, 1, format, type, pixels);
+			}
 		}
 
 		//|========================================================= Buffers ===============================================================================================
 
 		void gen_buffers(GLsizei n, GLuint* buffers) {
-			glGenBuffers(n, buffers);
+			GEM_GL_CALL("gen_buffers", 0, glGenBuffers(n, buffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::GenBuffers, n, buffers);
+			}
 		}
 
 		void bind_buffer(GLenum target, GLuint buffer) {
-			glBindBuffer(target, buffer);
+			int index = bufferTargetIndex(target);
+			if (index < 0) {
+				GEM_GL_CALL("bind_buffer", 0, glBindBuffer(target, buffer));	// Not tracked
+				if (GLCapture::isCapturing()) {
+					GLCaptureRecord(Call::BindBuffer) << target << buffer;
+				}
+				return;
+			}
+
+			GLuint& bound = state_cache_.buffers[index];
+			if (stateCacheEnabled() && bound == buffer) {
+				elided_buffer_binds_.add();
+				return;
+			}
+			GEM_GL_CALL("bind_buffer", 0, glBindBuffer(target, buffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindBuffer) << target << buffer;
+			}
+			bound = buffer;
 		}
 
 		void buffer_data(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
-			glBufferData(target, size, data, usage);
+			GEM_GL_CALL("buffer_data", data ? size : 0, glBufferData(target, size, data, usage));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BufferData) << target << GLCaptureRecord::i64(size) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) } << usage;
+			}
 		}
 
 		void delete_buffers(GLsizei n, const GLuint* buffers) {
-			glDeleteBuffers(n, buffers);
+			GEM_GL_CALL("delete_buffers", 0, glDeleteBuffers(n, buffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::DeleteBuffers, n, buffers);
+			}
+
+			// Deleted buffers revert to 0 on every target they were bound to, and their mappings are gone
+			for (GLsizei i = 0; i < n; ++i) {
+				std::erase_if(mapped_writes_, [&](const MappedWrite& write) { return write.buffer == buffers[i]; });
+				for (GLuint& bound : state_cache_.buffers) {
+					if (bound == buffers[i]) {
+						bound = 0;
+					}
+				}
+			}
+		}
+
+		void buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+			GEM_GL_CALL("buffer_sub_data", size, glBufferSubData(target, offset, size, data));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BufferSubData) << target << GLCaptureRecord::i64(offset) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) };
+			}
+		}
+
+		void copy_buffer_sub_data(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+			GEM_GL_CALL("copy_buffer_sub_data", size, glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CopyBufferSubData) << readTarget << writeTarget << GLCaptureRecord::i64(readOffset) << GLCaptureRecord::i64(writeOffset) << GLCaptureRecord::i64(size);
+			}
+		}
+
+		void buffer_storage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags) {
+			GEM_GL_CALL("buffer_storage", data ? size : 0, glBufferStorage(target, size, data, flags));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BufferStorage) << target << GLCaptureRecord::i64(size) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) } << flags;
+			}
+		}
+
+		void* map_buffer_range(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+			return GEM_GL_CALL("map_buffer_range", 0, glMapBufferRange(target, offset, length, access));
+		}
+
+		GLboolean unmap_buffer(GLenum target) {
+			return GEM_GL_CALL("unmap_buffer", 0, glUnmapBuffer(target));
+		}
+
+		void mark_mapped_write(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* mapped) {
+			if (!GLCapture::isCapturing() || size <= 0) {
+				return;
+			}
+
+			// Bump allocators write back to back: extend the last range instead of adding one
+			if (!mapped_writes_.empty()) {
+				MappedWrite& last = mapped_writes_.back();
+				if (last.buffer == buffer && last.offset + last.size == offset
+					&& static_cast<const std::byte*>(last.data) + last.size == mapped) {
+					last.size += size;
+					return;
+				}
+			}
+			mapped_writes_.push_back({ buffer, offset, size, mapped });
+		}
+
+		void bind_buffer_range(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+			GEM_GL_CALL("bind_buffer_range", 0, glBindBufferRange(target, index, buffer, offset, size));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindBufferRange) << target << index << buffer << GLCaptureRecord::i64(offset) << GLCaptureRecord::i64(size);
+			}
+
+			int target_index = bufferTargetIndex(target);
+			if (target_index >= 0) {
+				state_cache_.buffers[target_index] = buffer;	// Also binds the generic binding point
+			}
+		}
+
+		void bind_buffer_base(GLenum target, GLuint index, GLuint buffer) {
+			GEM_GL_CALL("bind_buffer_base", 0, glBindBufferBase(target, index, buffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindBufferBase) << target << index << buffer;
+			}
+
+			int target_index = bufferTargetIndex(target);
+			if (target_index >= 0) {
+				state_cache_.buffers[target_index] = buffer;	// Also binds the generic binding point
+			}
 		}
 
 		//|========================================================= Vertex Arrays =========================================================================================
 
 		void gen_vertex_arrays(GLsizei n, GLuint* arrays) {
-			glGenVertexArrays(n, arrays);
+			GEM_GL_CALL("gen_vertex_arrays", 0, glGenVertexArrays(n, arrays));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::GenVertexArrays, n, arrays);
+			}
 		}
 
 		void bind_vertex_array(GLuint array) {
-			glBindVertexArray(array);
+			if (stateCacheEnabled() && state_cache_.vertex_array == array) {
+				elided_vertex_array_binds_.add();
+				return;
+			}
+			GEM_GL_CALL("bind_vertex_array", 0, glBindVertexArray(array));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindVertexArray) << array;
+			}
+			state_cache_.vertex_array = array;
+			state_cache_.buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = StateCache::UNKNOWN;	// Comes with the VAO
 		}
 
 		void vertex_attrib_pointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer) {
-			glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+			GEM_GL_CALL("vertex_attrib_pointer", 0, glVertexAttribPointer(index, size, type, normalized, stride, pointer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::VertexAttribPointer) << index << size << type << normalized << stride << GLCaptureRecord::offset(pointer);
+			}
 		}
 
 		void enable_vertex_attrib_array(GLuint index) {
-			glEnableVertexAttribArray(index);
+			GEM_GL_CALL("enable_vertex_attrib_array", 0, glEnableVertexAttribArray(index));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::EnableVertexAttribArray) << index;
+			}
 		}
 
 		void delete_vertex_arrays(GLsizei n, const GLuint* arrays) {
-			glDeleteVertexArrays(n, arrays);
+			GEM_GL_CALL("delete_vertex_arrays", 0, glDeleteVertexArrays(n, arrays));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::DeleteVertexArrays, n, arrays);
+			}
+
+			for (GLsizei i = 0; i < n; ++i) {
+				if (state_cache_.vertex_array == arrays[i]) {
+					state_cache_.vertex_array = 0;	// Deleting the bound VAO binds 0
+					state_cache_.buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = StateCache::UNKNOWN;
+				}
+			}
+		}
+
+		//|========================================================= Direct state access =========================================================================================
+
+		bool has_direct_state_access() noexcept {
+			return glCreateBuffers != nullptr;	// Loaded by GLAD from GL 4.5 or ARB_direct_state_access
+		}
+
+		void create_buffers(GLsizei n, GLuint* buffers) {
+			GEM_GL_CALL("create_buffers", 0, glCreateBuffers(n, buffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::CreateBuffers, n, buffers);
+			}
+		}
+
+		void named_buffer_data(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage) {
+			GEM_GL_CALL("named_buffer_data", data ? size : 0, glNamedBufferData(buffer, size, data, usage));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::NamedBufferData) << buffer << GLCaptureRecord::i64(size) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) } << usage;
+			}
+		}
+
+		void named_buffer_storage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags) {
+			GEM_GL_CALL("named_buffer_storage", data ? size : 0, glNamedBufferStorage(buffer, size, data, flags));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::NamedBufferStorage) << buffer << GLCaptureRecord::i64(size) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) } << flags;
+			}
+		}
+
+		void named_buffer_sub_data(GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data) {
+			GEM_GL_CALL("named_buffer_sub_data", size, glNamedBufferSubData(buffer, offset, size, data));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::NamedBufferSubData) << buffer << GLCaptureRecord::i64(offset) << GLCaptureRecord::Blob{ data, static_cast<std::size_t>(size) };
+			}
+		}
+
+		void copy_named_buffer_sub_data(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+			GEM_GL_CALL("copy_named_buffer_sub_data", size, glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CopyNamedBufferSubData) << readBuffer << writeBuffer << GLCaptureRecord::i64(readOffset) << GLCaptureRecord::i64(writeOffset) << GLCaptureRecord::i64(size);
+			}
+		}
+
+		void create_vertex_arrays(GLsizei n, GLuint* arrays) {
+			GEM_GL_CALL("create_vertex_arrays", 0, glCreateVertexArrays(n, arrays));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::CreateVertexArrays, n, arrays);
+			}
+		}
+
+		void vertex_array_vertex_buffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+			GEM_GL_CALL("vertex_array_vertex_buffer", 0, glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::VertexArrayVertexBuffer) << vaobj << bindingindex << buffer << GLCaptureRecord::i64(offset) << stride;
+			}
+		}
+
+		void vertex_array_element_buffer(GLuint vaobj, GLuint buffer) {
+			GEM_GL_CALL("vertex_array_element_buffer", 0, glVertexArrayElementBuffer(vaobj, buffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::VertexArrayElementBuffer) << vaobj << buffer;
+			}
+
+			if (state_cache_.vertex_array == vaobj) {
+				state_cache_.buffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = buffer;	// The bound VAO's element buffer is the binding
+			}
+		}
+
+		void vertex_array_attrib_format(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+			GEM_GL_CALL("vertex_array_attrib_format", 0, glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::VertexArrayAttribFormat) << vaobj << attribindex << size << type << normalized << relativeoffset;
+			}
+		}
+
+		void vertex_array_attrib_binding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+			GEM_GL_CALL("vertex_array_attrib_binding", 0, glVertexArrayAttribBinding(vaobj, attribindex, bindingindex));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::VertexArrayAttribBinding) << vaobj << attribindex << bindingindex;
+			}
+		}
+
+		void enable_vertex_array_attrib(GLuint vaobj, GLuint index) {
+			GEM_GL_CALL("enable_vertex_array_attrib", 0, glEnableVertexArrayAttrib(vaobj, index));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::EnableVertexArrayAttrib) << vaobj << index;
+			}
+		}
+
+		void create_textures(GLenum target, GLsizei n, GLuint* textures) {
+			GEM_GL_CALL("create_textures", 0, glCreateTextures(target, n, textures));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CreateTextures) << target << n << GLCaptureRecord::Blob{ textures, static_cast<std::size_t>(n) * sizeof(GLuint) };
+			}
+		}
+
+		void texture_parameteri(GLuint texture, GLenum pname, GLint param) {
+			GEM_GL_CALL("texture_parameteri", 0, glTextureParameteri(texture, pname, param));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureParameteri) << texture << pname << param;
+			}
+		}
+
+		void texture_storage_1d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+			GEM_GL_CALL("texture_storage_1d", 0, glTextureStorage1D(texture, levels, internalformat, width));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureStorage1D) << texture << levels << internalformat << width;
+			}
+		}
+
+		void texture_storage_2d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+			GEM_GL_CALL("texture_storage_2d", 0, glTextureStorage2D(texture, levels, internalformat, width, height));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureStorage2D) << texture << levels << internalformat << width << height;
+			}
+		}
+
+		void texture_storage_3d(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+			GEM_GL_CALL("texture_storage_3d", 0, glTextureStorage3D(texture, levels, internalformat, width, height, depth));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureStorage3D) << texture << levels << internalformat << width << height << depth;
+			}
+		}
+
+		void texture_sub_image_1d(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels) {
+			GEM_GL_CALL("texture_sub_image_1d", pixelBlob(width, 1, 1, format, type, pixels).size, glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureSubImage1D) << texture << level << xoffset << width << format << type
+					<< pixelBlob(width, 1, 1, format, type, pixels);
+			}
+		}
+
+		void texture_sub_image_2d(GLuint texture, GLint level, GLint xoffset, GLint yoffset,
+			GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels) {
+			GEM_GL_CALL("texture_sub_image_2d", pixelBlob(width, height, 1, format, type, pixels).size, glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureSubImage2D) << texture << level << xoffset << yoffset << width << height << format << type
+					<< pixelBlob(width, height, 1, format, type, pixels);
+			}
+		}
+
+		void texture_sub_image_3d(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset,
+			GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels) {
+			GEM_GL_CALL("texture_sub_image_3d", pixelBlob(width, height, depth, format, type, pixels).size, glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset,
+					width, height, depth, format, type, pixels));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::TextureSubImage3D) << texture << level << xoffset << yoffset << zoffset << width << height << depth << format << type
+					<< pixelBlob(width, height, depth, format, type, pixels);
+			}
+		}
+
+		void generate_texture_mipmap(GLuint texture) {
+			GEM_GL_CALL("generate_texture_mipmap", 0, glGenerateTextureMipmap(texture));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::GenerateTextureMipmap) << texture;
+			}
+		}
+
+		void bind_texture_unit(GLuint unit, GLenum target, GLuint texture) {
+			int index = textureTargetIndex(target);
+			bool cached = unit < StateCache::TEXTURE_UNITS && index >= 0;
+			if (cached && stateCacheEnabled() && state_cache_.textures[unit][index] == texture) {
+				elided_texture_binds_.add();
+				return;
+			}
+			GEM_GL_CALL("bind_texture_unit", 0, glBindTextureUnit(unit, texture));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindTextureUnit) << unit << texture;
+			}
+
+			if (!cached) {
+				return;
+			}
+			if (texture == 0) {
+				for (GLuint& bound : state_cache_.textures[unit]) {
+					bound = 0;	// Binding 0 unbinds every target of the unit
+				}
+			}
+			else {
+				state_cache_.textures[unit][index] = texture;
+			}
 		}
 
 		//|========================================================= Shader =========================================================================================
 
 		GLuint create_shader(GLenum shaderType) {
-			return glCreateShader(shaderType);
+			GLuint shader = GEM_GL_CALL("create_shader", 0, glCreateShader(shaderType));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CreateShader) << shaderType << shader;
+			}
+			return shader;
 		}
 
 		void shader_source(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length) {
-			glShaderSource(shader, count, string, length);
+			GEM_GL_CALL("shader_source", 0, glShaderSource(shader, count, string, length));
+			if (GLCapture::isCapturing()) {
+				std::string source;
+				for (GLsizei i = 0; i < count; ++i) {
+					source.append(string[i], length && length[i] >= 0 ? static_cast<std::size_t>(length[i]) : std::strlen(string[i]));
+				}
+				GLCaptureRecord(Call::ShaderSource) << shader << GLCaptureRecord::Blob{ source.data(), source.size() };
+			}
 		}
 
 		void compile_shader(GLuint shader) {
-			glCompileShader(shader);
+			GEM_GL_CALL("compile_shader", 0, glCompileShader(shader));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CompileShader) << shader;
+			}
 		}
 
 		void get_shader_iv(GLuint shader, GLenum pname, GLint* params) {
-			glGetShaderiv(shader, pname, params);
+			GEM_GL_CALL("get_shader_iv", 0, glGetShaderiv(shader, pname, params));
 		}
 
 		void get_shader_info_log(GLuint shader, GLsizei maxLength, GLsizei* length, GLchar* infoLog) {
-			glGetShaderInfoLog(shader, maxLength, length, infoLog);
+			GEM_GL_CALL("get_shader_info_log", 0, glGetShaderInfoLog(shader, maxLength, length, infoLog));
 		}
 
 		void delete_shader(GLuint shader) {
-			glDeleteShader(shader);
+			GEM_GL_CALL("delete_shader", 0, glDeleteShader(shader));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::DeleteShader) << shader;
+			}
 		}
 
 		void attach_shader(GLuint program, GLuint shader) {
-			glAttachShader(program, shader);
+			GEM_GL_CALL("attach_shader", 0, glAttachShader(program, shader));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::AttachShader) << program << shader;
+			}
 		}
 
 		//|========================================================= Program =========================================================================================
 
 		GLuint create_program() {
-			return glCreateProgram();
+			GLuint program = GEM_GL_CALL("create_program", 0, glCreateProgram());
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CreateProgram) << program;
+			}
+			return program;
 		}
 
 		void link_program(GLuint program) {
-			glLinkProgram(program);
+			GEM_GL_CALL("link_program", 0, glLinkProgram(program));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::LinkProgram) << program;
+			}
 		}
 
 		void get_program_iv(GLuint program, GLenum pname, GLint* params) {
-			glGetProgramiv(program, pname, params);
+			GEM_GL_CALL("get_program_iv", 0, glGetProgramiv(program, pname, params));
 		}
 
 		void get_program_info_log(GLuint program, GLsizei maxLength, GLsizei* length, GLchar* infoLog) {
-			glGetProgramInfoLog(program, maxLength, length, infoLog);
+			GEM_GL_CALL("get_program_info_log", 0, glGetProgramInfoLog(program, maxLength, length, infoLog));
 		}
 
 		void validate_program(GLuint program) {
-			glValidateProgram(program);
+			GEM_GL_CALL("validate_program", 0, glValidateProgram(program));
 		}
 
 		void use_program(GLuint program) {
-			glUseProgram(program);
+			if (stateCacheEnabled() && state_cache_.program == program) {
+				elided_program_binds_.add();
+				return;
+			}
+			GEM_GL_CALL("use_program", 0, glUseProgram(program));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::UseProgram) << program;
+			}
+			state_cache_.program = program;
 		}
 
 		void delete_program(GLuint program) {
-			glDeleteProgram(program);
+			GEM_GL_CALL("delete_program", 0, glDeleteProgram(program));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::DeleteProgram) << program;
+			}
 		}
 
 		//|========================================================= Frame buffers =========================================================================================
 
 		void clear_color(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
-			glClearColor(red, green, blue, alpha);
+			GEM_GL_CALL("clear_color", 0, glClearColor(red, green, blue, alpha));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::ClearColor) << red << green << blue << alpha;
+			}
 		}
 
 		void viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
-			glViewport(x, y, width, height);
+			GEM_GL_CALL("viewport", 0, glViewport(x, y, width, height));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::Viewport) << x << y << width << height;
+			}
 		}
 
 		void clear(GLbitfield mask) {
-			glClear(mask);
+			GEM_GL_CALL("clear", 0, glClear(mask));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::Clear) << mask;
+			}
 		}
 
 		void draw_elements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
-			glDrawElements(mode, count, type, indices);
+			GEM_GL_CALL("draw_elements", 0, glDrawElements(mode, count, type, indices));
+			if (GLCapture::isCapturing()) {
+				captureMappedWrites();
+				GLCaptureRecord(Call::DrawElements) << mode << count << type << GLCaptureRecord::offset(indices);
+			}
+			draw_calls_.add();
+			draw_indices_.add(static_cast<std::uint64_t>(count));
+		}
+
+		void draw_elements_base_vertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex) {
+			GEM_GL_CALL("draw_elements_base_vertex", 0, glDrawElementsBaseVertex(mode, count, type, indices, basevertex));
+			if (GLCapture::isCapturing()) {
+				captureMappedWrites();
+				GLCaptureRecord(Call::DrawElementsBaseVertex) << mode << count << type << GLCaptureRecord::offset(indices) << basevertex;
+			}
+			draw_calls_.add();
+			draw_indices_.add(static_cast<std::uint64_t>(count));
 		}
 
 		//|========================================================= Server Side =========================================================================================
 
 		void enable(GLenum cap) {
-			glEnable(cap);
+			GEM_GL_CALL("enable", 0, glEnable(cap));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::Enable) << cap;
+			}
 		}
 
 		void disable(GLenum cap) {
-			glDisable(cap);
+			GEM_GL_CALL("disable", 0, glDisable(cap));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::Disable) << cap;
+			}
+		}
+
+		void cull_face(GLenum mode) {
+			GEM_GL_CALL("cull_face", 0, glCullFace(mode));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::CullFace) << mode;
+			}
+		}
+
+		void front_face(GLenum mode) {
+			GEM_GL_CALL("front_face", 0, glFrontFace(mode));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::FrontFace) << mode;
+			}
+		}
+
+		void blend_func(GLenum sfactor, GLenum dfactor) {
+			GEM_GL_CALL("blend_func", 0, glBlendFunc(sfactor, dfactor));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BlendFunc) << sfactor << dfactor;
+			}
 		}
 
 		//|========================================================= Error =========================================================================================
@@ -491,6 +1457,231 @@ namespace Gem {
 			return glGetError();
 		}
 
+		//|========================================================= Queries =========================================================================================
+
+		void gen_queries(GLsizei n, GLuint* ids) {
+			GEM_GL_CALL("gen_queries", 0, glGenQueries(n, ids));
+		}
+
+		void delete_queries(GLsizei n, const GLuint* ids) {
+			GEM_GL_CALL("delete_queries", 0, glDeleteQueries(n, ids));
+		}
+
+		void begin_query(GLenum target, GLuint id) {
+			GEM_GL_CALL("begin_query", 0, glBeginQuery(target, id));
+		}
+
+		void end_query(GLenum target) {
+			GEM_GL_CALL("end_query", 0, glEndQuery(target));
+		}
+
+		void query_counter(GLuint id, GLenum target) {
+			GEM_GL_CALL("query_counter", 0, glQueryCounter(id, target));
+		}
+
+		void get_query_object_iv(GLuint id, GLenum pname, GLint* params) {
+			GEM_GL_CALL("get_query_object_iv", 0, glGetQueryObjectiv(id, pname, params));
+		}
+
+		void get_query_object_ui64v(GLuint id, GLenum pname, GLuint64* params) {
+			GEM_GL_CALL("get_query_object_ui64v", 0, glGetQueryObjectui64v(id, pname, params));
+		}
+
+		void get_integerv(GLenum pname, GLint* data) {
+			GEM_GL_CALL("get_integerv", 0, glGetIntegerv(pname, data));
+		}
+
+		void get_integer64v(GLenum pname, GLint64* data) {
+			GEM_GL_CALL("get_integer64v", 0, glGetInteger64v(pname, data));
+		}
+
+		bool has_extension(const char* name) {
+			GLint count = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+			for (GLint i = 0; i < count; ++i) {
+				const GLubyte* extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+				if (extension && std::strcmp(reinterpret_cast<const char*>(extension), name) == 0) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		//|========================================================= Frame buffer objects =========================================================================================
+
+		void gen_framebuffers(GLsizei n, GLuint* framebuffers) {
+			GEM_GL_CALL("gen_framebuffers", 0, glGenFramebuffers(n, framebuffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::GenFramebuffers, n, framebuffers);
+			}
+		}
+
+		void bind_framebuffer(GLenum target, GLuint framebuffer) {
+			GEM_GL_CALL("bind_framebuffer", 0, glBindFramebuffer(target, framebuffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindFramebuffer) << target << framebuffer;
+			}
+		}
+
+		void delete_framebuffers(GLsizei n, const GLuint* framebuffers) {
+			GEM_GL_CALL("delete_framebuffers", 0, glDeleteFramebuffers(n, framebuffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::DeleteFramebuffers, n, framebuffers);
+			}
+		}
+
+		GLenum check_framebuffer_status(GLenum target) {
+			return GEM_GL_CALL("check_framebuffer_status", 0, glCheckFramebufferStatus(target));
+		}
+
+		void framebuffer_renderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+			GEM_GL_CALL("framebuffer_renderbuffer", 0, glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::FramebufferRenderbuffer) << target << attachment << renderbuffertarget << renderbuffer;
+			}
+		}
+
+		void gen_renderbuffers(GLsizei n, GLuint* renderbuffers) {
+			GEM_GL_CALL("gen_renderbuffers", 0, glGenRenderbuffers(n, renderbuffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::GenRenderbuffers, n, renderbuffers);
+			}
+		}
+
+		void bind_renderbuffer(GLenum target, GLuint renderbuffer) {
+			GEM_GL_CALL("bind_renderbuffer", 0, glBindRenderbuffer(target, renderbuffer));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::BindRenderbuffer) << target << renderbuffer;
+			}
+		}
+
+		void renderbuffer_storage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+			GEM_GL_CALL("renderbuffer_storage", 0, glRenderbufferStorage(target, internalformat, width, height));
+			if (GLCapture::isCapturing()) {
+				GLCaptureRecord(Call::RenderbufferStorage) << target << internalformat << width << height;
+			}
+		}
+
+		void delete_renderbuffers(GLsizei n, const GLuint* renderbuffers) {
+			GEM_GL_CALL("delete_renderbuffers", 0, glDeleteRenderbuffers(n, renderbuffers));
+			if (GLCapture::isCapturing()) {
+				captureNames(Call::DeleteRenderbuffers, n, renderbuffers);
+			}
+		}
+
+		void read_pixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels) {
+			GEM_GL_CALL("read_pixels", 0, glReadPixels(x, y, width, height, format, type, pixels));
+		}
+
+		//|========================================================= Sync objects =========================================================================================
+
+		GLsync fence_sync(GLenum condition, GLbitfield flags) {
+			return GEM_GL_CALL("fence_sync", 0, glFenceSync(condition, flags));
+		}
+
+		GLenum client_wait_sync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+			return GEM_GL_CALL("client_wait_sync", 0, glClientWaitSync(sync, flags, timeout));
+		}
+
+		void delete_sync(GLsync sync) {
+			GEM_GL_CALL("delete_sync", 0, glDeleteSync(sync));
+		}
+
+		void flush() {
+			GEM_GL_CALL("flush", 0, glFlush());
+		}
+
+		void finish() {
+			GEM_GL_CALL("finish", 0, glFinish());
+		}
+
+		//|========================================================= State cache =========================================================================================
+
+		void invalidate_state_cache() {
+			state_cache_.reset();
+		}
+
+		void set_state_cache_enabled(bool enabled) {
+			state_cache_enabled_.store(enabled, std::memory_order_relaxed);
+		}
+
+		bool is_state_cache_enabled() {
+			return stateCacheEnabled();
+		}
+
+		//|========================================================= Instrumentation =========================================================================================
+
+		std::vector<CallStats> get_call_stats() {
+			std::vector<CallStats> stats;
+			{
+				std::lock_guard<std::mutex> lock(call_sites_mutex_);
+				for (const GLPolicy::Site* site = call_sites_; site; site = site->next) {
+					std::uint64_t calls = site->calls.load(std::memory_order_relaxed);
+					if (calls == 0) {
+						continue;
+					}
+
+					// A wrapper with several call sites (tracked and untracked binds) is one entry
+					auto same = std::find_if(stats.begin(), stats.end(), [site](const CallStats& entry) { return std::strcmp(entry.name, site->zone.name) == 0; });
+					if (same != stats.end()) {
+						same->calls += calls;
+						same->bytes += site->bytes.load(std::memory_order_relaxed);
+					}
+					else {
+						stats.push_back({ site->zone.name, calls, site->bytes.load(std::memory_order_relaxed) });
+					}
+				}
+			}
+
+			std::sort(stats.begin(), stats.end(), [](const CallStats& a, const CallStats& b) { return a.calls > b.calls; });
+			return stats;
+		}
+
+		void reset_call_stats() {
+			std::lock_guard<std::mutex> lock(call_sites_mutex_);
+			for (GLPolicy::Site* site = call_sites_; site; site = site->next) {
+				site->calls.store(0, std::memory_order_relaxed);
+				site->bytes.store(0, std::memory_order_relaxed);
+			}
+		}
+
+		void log_call_stats() {
+			std::vector<CallStats> stats = get_call_stats();
+			if (stats.empty()) {
+				GEM_LOG_INFO(Logger::Channel::Graphics, "GL calls: nothing counted (policy {}).", get_instrumentation_policy());
+				return;
+			}
+			for (const CallStats& entry : stats) {
+				GEM_LOG_INFO(Logger::Channel::Graphics, "GL::{}: {} calls, {} bytes", entry.name, entry.calls, entry.bytes);
+			}
+		}
+
+		bool export_call_stats(const std::string& path) {
+			std::vector<CallStats> stats = get_call_stats();
+			if (stats.empty()) {
+				return false;
+			}
+
+			std::FILE* file = std::fopen(path.c_str(), "w");
+			if (!file) {
+				return false;
+			}
+
+			std::fprintf(file, "name,calls,bytes\n");
+			for (const CallStats& entry : stats) {
+				std::fprintf(file, "%s,%llu,%llu\n", entry.name,
+					static_cast<unsigned long long>(entry.calls), static_cast<unsigned long long>(entry.bytes));
+			}
+
+			bool ok = std::ferror(file) == 0;
+			ok = std::fclose(file) == 0 && ok;
+			return ok;
+		}
+
+		const char* get_instrumentation_policy() {
+			return GLPolicy::Active::NAME;
+		}
+
 	} // namespace GL
 
 } // Gem
\ No newline at end of file
@@ -0,0 +1,270 @@
+#include <Gem/Core/BinaryLog.h>
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace Gem {
+
+    namespace {
+
+        //--------------------------------------------------------------------------
+        // Memory-mapped file
+        //--------------------------------------------------------------------------
+        /**
+         * Maps a file of a fixed size read/write and trims it back on close.
+         */
+        class MappedFile {
+        public:
+            bool open(const std::string& path, std::size_t size) noexcept {
+#ifdef _WIN32
+                file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                    CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file_ == INVALID_HANDLE_VALUE) {
+                    return false;
+                }
+
+                auto size64 = static_cast<unsigned long long>(size);
+                mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READWRITE,
+                    static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFFull), nullptr);
+                if (!mapping_) {
+                    close(0);
+                    return false;
+                }
+
+                data_ = static_cast<std::byte*>(MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, size));
+                if (!data_) {
+                    close(0);
+                    return false;
+                }
+#else
+                fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+                if (fd_ < 0) {
+                    return false;
+                }
+
+                if (::ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+                    close(0);
+                    return false;
+                }
+
+                void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+                if (data == MAP_FAILED) {
+                    close(0);
+                    return false;
+                }
+                data_ = static_cast<std::byte*>(data);
+#endif
+                size_ = size;
+                return true;
+            }
+
+            /**
+             * Unmaps the view and truncates the file to @p used bytes.
+             */
+            void close(std::size_t used) noexcept {
+#ifdef _WIN32
+                if (data_) {
+                    FlushViewOfFile(data_, 0);
+                    UnmapViewOfFile(data_);
+                }
+                if (mapping_) {
+                    CloseHandle(mapping_);
+                }
+                if (file_ != INVALID_HANDLE_VALUE) {
+                    LARGE_INTEGER end;
+                    end.QuadPart = static_cast<LONGLONG>(used);
+                    SetFilePointerEx(file_, end, nullptr, FILE_BEGIN);
+                    SetEndOfFile(file_);
+                    CloseHandle(file_);
+                }
+                file_ = INVALID_HANDLE_VALUE;
+                mapping_ = nullptr;
+#else
+                if (data_) {
+                    ::munmap(data_, size_);
+                }
+                if (fd_ >= 0) {
+                    [[maybe_unused]] int result = ::ftruncate(fd_, static_cast<off_t>(used));
+                    ::close(fd_);
+                }
+                fd_ = -1;
+#endif
+                data_ = nullptr;
+                size_ = 0;
+            }
+
+            [[nodiscard]] std::byte* data() const noexcept { return data_; }
+
+        private:
+#ifdef _WIN32
+            HANDLE file_ = INVALID_HANDLE_VALUE;
+            HANDLE mapping_ = nullptr;
+#else
+            int fd_ = -1;
+#endif
+            std::byte* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+
+        std::mutex registry_mutex_;                  ///< Guards everything below and open()/close().
+        BinaryLog::Site* registry_head_ = nullptr;   ///< Every registered call site.
+        std::uint32_t next_format_id_ = BinaryLogFormat::DEFINITION_ID + 1;
+        MappedFile mapped_file_;
+
+        std::int64_t nanosecondsSinceEpoch(auto time_point) noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+        }
+
+    } // namespace
+
+    std::atomic<std::byte*> BinaryLog::base_{ nullptr };
+    std::atomic<std::size_t> BinaryLog::offset_{ 0 };
+    std::size_t BinaryLog::capacity_ = 0;
+    std::atomic<std::uint64_t> BinaryLog::dropped_{ 0 };
+    std::atomic<int> BinaryLog::min_log_level_{ static_cast<int>(Logger::LogLevel::Debug) };
+
+    //------------------------------------------------------------------------------
+    // 1) Open / close
+    //------------------------------------------------------------------------------
+    bool BinaryLog::open(const std::string& path, std::size_t capacity) noexcept {
+        close();
+
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+
+        capacity = std::max(capacity, sizeof(BinaryLogFormat::FileHeader) + 4096);
+        if (!mapped_file_.open(path, capacity)) {
+            std::cerr << "[BinaryLog] Failed to map log file '" << path << "'." << std::endl;
+            return false;
+        }
+
+        std::byte* base = mapped_file_.data();
+
+        BinaryLogFormat::FileHeader header{};
+        std::memcpy(header.magic, BinaryLogFormat::MAGIC, sizeof(header.magic));
+        header.version = BinaryLogFormat::VERSION;
+        header.header_size = sizeof(BinaryLogFormat::FileHeader);
+        header.system_time_ns = nanosecondsSinceEpoch(std::chrono::system_clock::now());
+        header.steady_time_ns = nanosecondsSinceEpoch(std::chrono::steady_clock::now());
+        header.ticks = TscClock::ticks();
+        header.ticks_per_second = TscClock::getTicksPerSecond();
+        std::memcpy(base, &header, sizeof(header));
+
+        capacity_ = capacity;
+        offset_.store(sizeof(BinaryLogFormat::FileHeader), std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+
+        // Sites seen by a previous file still need their definitions in this one
+        for (Site* site = registry_head_; site; site = site->next) {
+            writeDefinition(base, *site, site->id.load(std::memory_order_relaxed));
+        }
+
+        base_.store(base, std::memory_order_release);
+        return true;
+    }
+
+    void BinaryLog::close() noexcept {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+
+        if (!base_.exchange(nullptr, std::memory_order_acq_rel)) {
+            return;
+        }
+
+        std::size_t used = std::min(offset_.load(std::memory_order_acquire), capacity_);
+        mapped_file_.close(used);
+        capacity_ = 0;
+    }
+
+    bool BinaryLog::isOpen() noexcept {
+        return base_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    // 2) Level / statistics
+    //------------------------------------------------------------------------------
+    void BinaryLog::setMinLogLevel(Logger::LogLevel level) noexcept {
+        min_log_level_.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    Logger::LogLevel BinaryLog::getMinLogLevel() noexcept {
+        return static_cast<Logger::LogLevel>(min_log_level_.load(std::memory_order_relaxed));
+    }
+
+    std::uint64_t BinaryLog::getDroppedCount() noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    // 3) Call site registration
+    //------------------------------------------------------------------------------
+    std::uint32_t BinaryLog::registerSite(Site& site, Logger::LogLevel level, std::string_view format,
+        const BinaryLogFormat::ArgType* arg_types, std::size_t arg_count) noexcept {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+
+        // Another thread may have registered this site while we waited for the lock
+        std::uint32_t id = site.id.load(std::memory_order_relaxed);
+        if (id != 0) {
+            return id;
+        }
+
+        id = next_format_id_++;
+        site.level = level;
+        site.format = format.substr(0, BinaryLogFormat::MAX_STRING_LENGTH);
+        site.arg_types = arg_types;
+        site.arg_count = static_cast<std::uint8_t>(std::min<std::size_t>(arg_count, 0xFF));
+        site.next = registry_head_;
+        registry_head_ = &site;
+
+        // The id is not published yet, so the definition lands before any record that uses it
+        std::byte* base = base_.load(std::memory_order_acquire);
+        if (base) {
+            writeDefinition(base, site, id);
+        }
+
+        site.id.store(id, std::memory_order_release);
+        return id;
+    }
+
+    void BinaryLog::writeDefinition(std::byte* base, const Site& site, std::uint32_t id) noexcept {
+        std::size_t payload = sizeof(std::uint32_t) + 2 * sizeof(std::uint8_t) + sizeof(std::uint16_t)
+            + site.arg_count + site.format.size();
+        std::size_t size = BinaryLogFormat::align_record(sizeof(BinaryLogFormat::RecordHeader) + payload);
+
+        std::byte* record = reserve(base, size);
+        if (!record) {
+            return;
+        }
+
+        std::byte* cursor = record + sizeof(BinaryLogFormat::RecordHeader);
+        auto put = [&cursor](const void* data, std::size_t bytes) {
+            std::memcpy(cursor, data, bytes);
+            cursor += bytes;
+        };
+
+        auto level = static_cast<std::uint8_t>(site.level);
+        auto format_length = static_cast<std::uint16_t>(site.format.size());
+        put(&id, sizeof(id));
+        put(&level, sizeof(level));
+        put(&site.arg_count, sizeof(site.arg_count));
+        put(&format_length, sizeof(format_length));
+        put(site.arg_types, site.arg_count);
+        put(site.format.data(), site.format.size());
+
+        commit(record, BinaryLogFormat::DEFINITION_ID, TscClock::ticks());
+    }
+
+} // namespace Gem
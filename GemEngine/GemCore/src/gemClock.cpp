@@ -1,10 +1,16 @@
 #include <Gem/Core/Clock.h>
 #include <Gem/Core/Logger.h>
+#include <Gem/Core/BinaryLog.h>
+#include <Gem/Core/FlightRecorder.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
 #include <algorithm>
+#include <cmath>
 
 namespace Gem {
 
-    Clock::Clock() noexcept
+    template <typename Policy, typename ClockSource>
+    BasicClock<Policy, ClockSource>::BasicClock() noexcept
         : previous_time_(ClockType::now())
         , current_time_(ClockType::now())
         , delta_time_(0.0)
@@ -12,76 +18,261 @@ namespace Gem {
         , fps_timer_(0.0)
         , fps_log_interval_(0.0)
         , last_average_fps_(0.0)
+        , frame_telemetry_(true)
+        , frame_budget_ms_(0.0)
+        , interval_over_budget_(0)
+        , total_over_budget_(0)
+        , fixed_step_(0.0)
+        , max_fixed_steps_(8)
+        , accumulator_(0.0)
+        , fixed_steps_(0)
+        , interpolation_alpha_(0.0)
+        , dropped_fixed_steps_(0)
     {
     }
 
-    void Clock::update(int max_fps) noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicClock<Policy, ClockSource>::update(int max_fps) noexcept {
+        double delta_time = 0.0;
+        double avg_fps = 0.0;
+        bool log_average = false;
+        FrameHistogram::Summary interval_summary;
+        bool frame_telemetry = false;
 
-        current_time_ = ClockType::now();
-        std::chrono::duration<double> frame_duration = current_time_ - previous_time_;
-        delta_time_ = frame_duration.count();
-        previous_time_ = current_time_;
+        // Only the bookkeeping runs under the write guard: logging, telemetry and the
+        // FPS cap below must not block (or, with AtomicRead, stall) the readers.
+        {
+            WriteGuard guard(policy_);
 
-        // FPS logging logic
-        frame_count_++;
-        fps_timer_ += delta_time_;
+            current_time_ = ClockType::now();
+            std::chrono::duration<double> frame_duration = current_time_ - previous_time_;
+            delta_time = frame_duration.count();
+            delta_time_.store(delta_time);
+            previous_time_ = current_time_;
 
-        if (fps_log_interval_ > 0.0 && fps_timer_ >= fps_log_interval_) {
-            // Compute average FPS
-            double avg_fps = frame_count_ / fps_timer_;
-            last_average_fps_ = avg_fps;
+            // Frame-time histograms (O(1), no allocation)
+            double delta_ms = delta_time * 1000.0;
+            interval_histogram_.record(delta_ms);
+            total_histogram_.record(delta_ms);
+            if (frame_budget_ms_ > 0.0 && delta_ms > frame_budget_ms_) {
+                interval_over_budget_++;
+                total_over_budget_++;
+            }
+
+            // FPS logging logic
+            frame_count_++;
+            fps_timer_ += delta_time;
+
+            if (fps_log_interval_ > 0.0 && fps_timer_ >= fps_log_interval_) {
+                // Compute average FPS
+                avg_fps = frame_count_ / fps_timer_;
+                last_average_fps_.store(avg_fps);
+                log_average = true;
+
+                // Close the frame-time interval
+                interval_summary = interval_histogram_.summarize();
+                interval_summary.over_budget = interval_over_budget_;
+                interval_stats_.frames.store(interval_summary.frames);
+                interval_stats_.mean_ms.store(interval_summary.mean_ms);
+                interval_stats_.p50_ms.store(interval_summary.p50_ms);
+                interval_stats_.p90_ms.store(interval_summary.p90_ms);
+                interval_stats_.p99_ms.store(interval_summary.p99_ms);
+                interval_stats_.p999_ms.store(interval_summary.p999_ms);
+                interval_stats_.max_ms.store(interval_summary.max_ms);
+                interval_stats_.over_budget.store(interval_summary.over_budget);
+                interval_histogram_.reset();
+                interval_over_budget_ = 0;
+
+                // Reset counters
+                frame_count_ = 0;
+                fps_timer_ = 0.0;
+            }
+
+            // Fixed-step accumulator
+            double fixed_step = fixed_step_.load();
+            if (fixed_step > 0.0) {
+                accumulator_ += delta_time;
+
+                int steps = static_cast<int>(accumulator_ / fixed_step);
+                if (steps > max_fixed_steps_) {
+                    // Too far behind: drop the backlog instead of trying to catch up
+                    dropped_fixed_steps_.store(dropped_fixed_steps_.load() + static_cast<std::uint64_t>(steps - max_fixed_steps_));
+                    steps = max_fixed_steps_;
+                    accumulator_ = std::fmod(accumulator_, fixed_step) + steps * fixed_step;
+                }
+
+                accumulator_ -= steps * fixed_step;
+                fixed_steps_.store(steps);
+                interpolation_alpha_.store(std::clamp(accumulator_ / fixed_step, 0.0, 1.0));
+            }
 
+            frame_telemetry = frame_telemetry_;
+        }
+
+        if (frame_telemetry) {
+            // Binary log records are only written while a BinaryLog file is open
+            GEM_BINARY_LOG(Logger::LogLevel::Debug, "[Clock] ~ frame time: {} ms", delta_time * 1000.0);
+            FlightRecorder::recordFrame(delta_time * 1000.0);
+            Metrics::newFrame();
+
+#if GEMENGINE_PROFILING
+            Profiler::newFrame();
+#endif
+        }
+
+        if (log_average) {
             Gem::Logger::info("[Clock] ~ AVG FPS: {}", avg_fps);
+            Gem::Logger::info("[Clock] ~ frame time p50 {} ms, p90 {} ms, p99 {} ms, p99.9 {} ms, max {} ms, over budget {}",
+                interval_summary.p50_ms, interval_summary.p90_ms, interval_summary.p99_ms, interval_summary.p999_ms,
+                interval_summary.max_ms, interval_summary.over_budget);
 
-            // Reset counters
-            frame_count_ = 0;
-            fps_timer_ = 0.0;
+            FramePacer::Stats pacing = pacer_.getStats();
+            if (pacing.frames + pacing.missed_frames > 0) {
+                Gem::Logger::info("[Clock] ~ pacing error: mean {} us, stddev {} us, max {} us, missed {}, margin {} us",
+                    pacing.mean_error_us, pacing.stddev_error_us, pacing.max_error_us, pacing.missed_frames, pacing.margin_us);
+                pacer_.resetStats();
+            }
         }
 
         // Cap FPS if needed
         if (max_fps > 0) {
-            double target_frame = 1.0 / static_cast<double>(max_fps);
-            if (delta_time_ < target_frame) {
-                double sleep_time = target_frame - delta_time_;
-                
-                // Simple approach:
-                // std::this_thread::sleep_for(std::chrono::duration<double>(sleep_time));
-
-                // More precise approach
-                auto wakeUp = ClockType::now() + std::chrono::duration<double>(sleep_time);
-                while (ClockType::now() < wakeUp) {
-                    std::this_thread::sleep_for(std::chrono::microseconds(50));
-                }
-            }
+            pacer_.wait(1.0 / static_cast<double>(max_fps));
+        }
+        else {
+            pacer_.reset();
         }
     }
 
-    void Clock::logFPS(int interval_seconds) noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicClock<Policy, ClockSource>::logFPS(int interval_seconds) noexcept {
+        WriteGuard guard(policy_);
         fps_log_interval_ = static_cast<double>(interval_seconds);
         // Reset so we don't mix intervals
         fps_timer_ = 0.0;
         frame_count_ = 0;
-        last_average_fps_ = 0.0;
+        last_average_fps_.store(0.0);
+        interval_histogram_.reset();
+        interval_over_budget_ = 0;
+    }
+
+    template <typename Policy, typename ClockSource>
+    void BasicClock<Policy, ClockSource>::setFrameBudget(double budget_ms) noexcept {
+        WriteGuard guard(policy_);
+        frame_budget_ms_ = std::max(budget_ms, 0.0);
     }
 
-    double Clock::getDeltaTime() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return delta_time_;
+    template <typename Policy, typename ClockSource>
+    FrameHistogram::Summary BasicClock<Policy, ClockSource>::getFrameStats() const noexcept {
+        return policy_.read([this]() noexcept {
+            FrameHistogram::Summary summary;
+            summary.frames = interval_stats_.frames.load();
+            summary.mean_ms = interval_stats_.mean_ms.load();
+            summary.p50_ms = interval_stats_.p50_ms.load();
+            summary.p90_ms = interval_stats_.p90_ms.load();
+            summary.p99_ms = interval_stats_.p99_ms.load();
+            summary.p999_ms = interval_stats_.p999_ms.load();
+            summary.max_ms = interval_stats_.max_ms.load();
+            summary.over_budget = interval_stats_.over_budget.load();
+            return summary;
+        });
     }
 
-    double Clock::getInstantFPS() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (delta_time_ > 0.0) {
-            return 1.0 / delta_time_;
+    template <typename Policy, typename ClockSource>
+    FrameHistogram::Summary BasicClock<Policy, ClockSource>::getTotalFrameStats() const noexcept {
+        return policy_.read([this]() noexcept {
+            FrameHistogram::Summary summary = total_histogram_.summarize();
+            summary.over_budget = total_over_budget_;
+            return summary;
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    bool BasicClock<Policy, ClockSource>::exportFrameHistogram(const std::string& path) const noexcept {
+        // Copy under the read, write outside it: a retry must not redo (or tear) the file I/O
+        FrameHistogram histogram = policy_.read([this]() noexcept {
+            return total_histogram_;
+        });
+        return histogram.exportCsv(path);
+    }
+
+    template <typename Policy, typename ClockSource>
+    void BasicClock<Policy, ClockSource>::setFrameTelemetry(bool enabled) noexcept {
+        WriteGuard guard(policy_);
+        frame_telemetry_ = enabled;
+    }
+
+    template <typename Policy, typename ClockSource>
+    void BasicClock<Policy, ClockSource>::setFixedTimestep(double step_seconds, int max_steps_per_frame) noexcept {
+        WriteGuard guard(policy_);
+        fixed_step_.store(std::max(step_seconds, 0.0));
+        max_fixed_steps_ = std::max(max_steps_per_frame, 1);
+        // Start from an empty accumulator
+        accumulator_ = 0.0;
+        fixed_steps_.store(0);
+        interpolation_alpha_.store(0.0);
+    }
+
+    template <typename Policy, typename ClockSource>
+    double BasicClock<Policy, ClockSource>::getFixedTimestep() const noexcept {
+        return policy_.read([this]() noexcept {
+            return fixed_step_.load();
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    int BasicClock<Policy, ClockSource>::getFixedSteps() const noexcept {
+        return policy_.read([this]() noexcept {
+            return fixed_steps_.load();
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    double BasicClock<Policy, ClockSource>::getInterpolationAlpha() const noexcept {
+        return policy_.read([this]() noexcept {
+            return interpolation_alpha_.load();
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    std::uint64_t BasicClock<Policy, ClockSource>::getDroppedFixedSteps() const noexcept {
+        return policy_.read([this]() noexcept {
+            return dropped_fixed_steps_.load();
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    double BasicClock<Policy, ClockSource>::getDeltaTime() const noexcept {
+        return policy_.read([this]() noexcept {
+            return delta_time_.load();
+        });
+    }
+
+    template <typename Policy, typename ClockSource>
+    double BasicClock<Policy, ClockSource>::getInstantFPS() const noexcept {
+        double delta_time = getDeltaTime();
+        if (delta_time > 0.0) {
+            return 1.0 / delta_time;
         }
         return 0.0;
     }
 
-    double Clock::getAverageFPS() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return last_average_fps_;
+    template <typename Policy, typename ClockSource>
+    double BasicClock<Policy, ClockSource>::getAverageFPS() const noexcept {
+        return policy_.read([this]() noexcept {
+            return last_average_fps_.load();
+        });
     }
 
+    template <typename Policy, typename ClockSource>
+    FramePacer::Stats BasicClock<Policy, ClockSource>::getPacingStats() const noexcept {
+        return pacer_.getStats();
+    }
+
+    template class BasicClock<ThreadPolicy::SingleThread, std::chrono::steady_clock>;
+    template class BasicClock<ThreadPolicy::Locked, std::chrono::steady_clock>;
+    template class BasicClock<ThreadPolicy::AtomicRead, std::chrono::steady_clock>;
+    template class BasicClock<ThreadPolicy::SingleThread, TscClock>;
+    template class BasicClock<ThreadPolicy::Locked, TscClock>;
+    template class BasicClock<ThreadPolicy::AtomicRead, TscClock>;
+
 } // namespace Gem
@@ -0,0 +1,512 @@
+#include <Gem/Core/FlightRecorder.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#pragma warning( disable : 4996 ) // Disable warning about POSIX names (_open, _write) on MSVC
+
+namespace Gem {
+
+    namespace {
+
+        //--------------------------------------------------------------------------
+        // Ring
+        //--------------------------------------------------------------------------
+        constexpr std::size_t floorPowerOfTwo(std::size_t value) noexcept {
+            std::size_t result = 1;
+            while (result * 2 <= value) {
+                result *= 2;
+            }
+            return result;
+        }
+
+        constexpr std::size_t RING_SIZE = floorPowerOfTwo(GEMENGINE_FLIGHT_RECORDER_SIZE);
+        constexpr std::size_t RING_MASK = RING_SIZE - 1;
+        constexpr std::size_t TEXT_SIZE = 100;
+
+        /**
+         * One ring slot. sequence is a per-slot seqlock: odd while being written,
+         * 2 * index + 2 once entry number "index" is complete.
+         */
+        struct alignas(128) Entry {
+            std::atomic<std::uint64_t> sequence{ 0 };
+            std::int64_t timestamp_ns = 0;
+            double value = 0.0;
+            FlightRecorder::Kind kind = FlightRecorder::Kind::Empty;
+            std::uint8_t level = 0;
+            std::uint16_t length = 0;
+            char text[TEXT_SIZE] = {};
+        };
+
+        Entry ring_[RING_SIZE];
+        std::atomic<std::uint64_t> head_{ 0 };
+
+        const std::chrono::steady_clock::time_point start_time_ = std::chrono::steady_clock::now();
+
+        std::int64_t nowNanoseconds() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count();
+        }
+
+        void record(FlightRecorder::Kind kind, std::uint8_t level, double value, std::string_view text) noexcept {
+            std::uint64_t index = head_.fetch_add(1, std::memory_order_relaxed);
+            Entry& entry = ring_[index & RING_MASK];
+
+            entry.sequence.store(2 * index + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            std::size_t length = std::min(text.size(), TEXT_SIZE);
+            entry.timestamp_ns = nowNanoseconds();
+            entry.value = value;
+            entry.kind = kind;
+            entry.level = level;
+            entry.length = static_cast<std::uint16_t>(length);
+            std::memcpy(entry.text, text.data(), length);
+
+            entry.sequence.store(2 * index + 2, std::memory_order_release);
+        }
+
+        //--------------------------------------------------------------------------
+        // Async-signal-safe text writer
+        //--------------------------------------------------------------------------
+        /**
+         * Buffers output in a fixed array and writes it with the raw file API.
+         * No allocation, no locks, no stdio: usable from a signal handler.
+         */
+        class DumpWriter {
+        public:
+            explicit DumpWriter(const char* path) noexcept {
+#ifdef _WIN32
+                fd_ = ::_open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+                fd_ = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+            }
+
+            ~DumpWriter() {
+                flush();
+                if (fd_ >= 0) {
+#ifdef _WIN32
+                    ::_close(fd_);
+#else
+                    ::close(fd_);
+#endif
+                }
+            }
+
+            [[nodiscard]] bool is_open() const noexcept { return fd_ >= 0; }
+
+            void append(std::string_view text) noexcept {
+                while (!text.empty()) {
+                    if (used_ == sizeof(buffer_)) {
+                        flush();
+                    }
+                    std::size_t count = std::min(text.size(), sizeof(buffer_) - used_);
+                    std::memcpy(buffer_ + used_, text.data(), count);
+                    used_ += count;
+                    text.remove_prefix(count);
+                }
+            }
+
+            template <typename T>
+            void append_number(T value, int precision = 3) noexcept {
+                char digits[32];
+                std::to_chars_result result;
+                if constexpr (std::is_floating_point_v<T>) {
+                    result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, precision);
+                }
+                else {
+                    result = std::to_chars(digits, digits + sizeof(digits), value);
+                }
+                append(std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)));
+            }
+
+            void flush() noexcept {
+                std::size_t written = 0;
+                while (fd_ >= 0 && written < used_) {
+#ifdef _WIN32
+                    int result = ::_write(fd_, buffer_ + written, static_cast<unsigned int>(used_ - written));
+#else
+                    auto result = ::write(fd_, buffer_ + written, used_ - written);
+#endif
+                    if (result <= 0) {
+                        break;
+                    }
+                    written += static_cast<std::size_t>(result);
+                }
+                used_ = 0;
+            }
+
+        private:
+            int fd_ = -1;
+            char buffer_[4096];
+            std::size_t used_ = 0;
+        };
+
+        const char* levelName(std::uint8_t level) noexcept {
+            switch (static_cast<Logger::LogLevel>(level)) {
+            case Logger::LogLevel::Debug:   return "DEBUG";
+            case Logger::LogLevel::Info:    return "INFO";
+            case Logger::LogLevel::Warning: return "WARN";
+            case Logger::LogLevel::Error:   return "ERROR";
+            }
+            return "UNKNOWN";
+        }
+
+        /**
+         * Writes every complete entry, oldest first. Entries being written or
+         * overwritten while we read them are skipped.
+         */
+        bool dumpRing(const char* path, std::string_view reason) noexcept {
+            DumpWriter out(path);
+            if (!out.is_open()) {
+                return false;
+            }
+
+            std::uint64_t end = head_.load(std::memory_order_acquire);
+            std::uint64_t begin = end > RING_SIZE ? end - RING_SIZE : 0;
+
+            out.append("=== GemEngine flight recorder: ");
+            out.append(reason);
+            out.append(" ===\n");
+            out.append("t = seconds since start, ");
+            out.append_number(end - begin);
+            out.append(" entries\n");
+
+            for (std::uint64_t index = begin; index < end; ++index) {
+                const Entry& entry = ring_[index & RING_MASK];
+
+                std::uint64_t sequence = entry.sequence.load(std::memory_order_acquire);
+                if (sequence != 2 * index + 2) {
+                    continue;
+                }
+
+                std::int64_t timestamp_ns = entry.timestamp_ns;
+                double value = entry.value;
+                FlightRecorder::Kind kind = entry.kind;
+                std::uint8_t level = entry.level;
+                std::size_t length = std::min<std::size_t>(entry.length, TEXT_SIZE);
+                char text[TEXT_SIZE];
+                std::memcpy(text, entry.text, length);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (entry.sequence.load(std::memory_order_relaxed) != sequence) {
+                    continue; // Overwritten while we copied it
+                }
+
+                out.append("[t=");
+                out.append_number(static_cast<double>(timestamp_ns) / 1e9, 6);
+                out.append("] ");
+
+                switch (kind) {
+                case FlightRecorder::Kind::Log:
+                    out.append("[");
+                    out.append(levelName(level));
+                    out.append("] ");
+                    out.append(std::string_view(text, length));
+                    break;
+                case FlightRecorder::Kind::Frame:
+                    out.append("[FRAME] ");
+                    out.append_number(value);
+                    out.append(" ms");
+                    break;
+                case FlightRecorder::Kind::Timer:
+                    out.append("[TIMER] ");
+                    out.append(std::string_view(text, length));
+                    out.append(" ");
+                    out.append_number(value);
+                    out.append(" ms");
+                    break;
+                case FlightRecorder::Kind::Empty:
+                    break;
+                }
+                out.append("\n");
+            }
+
+            return true;
+        }
+
+        //--------------------------------------------------------------------------
+        // Crash handlers
+        //--------------------------------------------------------------------------
+        char crash_path_[512] = {};          ///< Copied at enable() so the handler never allocates.
+        std::atomic<bool> crash_dumped_{ false };
+        bool handlers_installed_ = false;
+
+        constexpr int FATAL_SIGNALS[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+        const char* signalName(int signal) noexcept {
+            switch (signal) {
+            case SIGSEGV: return "crash (SIGSEGV)";
+            case SIGABRT: return "crash (SIGABRT)";
+            case SIGFPE:  return "crash (SIGFPE)";
+            case SIGILL:  return "crash (SIGILL)";
+            }
+            return "crash";
+        }
+
+        void dumpCrash(const char* reason) noexcept {
+            if (!crash_dumped_.exchange(true)) {
+                dumpRing(crash_path_, reason);
+            }
+        }
+
+#ifdef _WIN32
+        using SignalHandler = void (*)(int);
+        SignalHandler previous_abort_handler_ = SIG_DFL;
+        LPTOP_LEVEL_EXCEPTION_FILTER previous_exception_filter_ = nullptr;
+
+        LONG WINAPI onUnhandledException(EXCEPTION_POINTERS* info) {
+            dumpCrash(info && info->ExceptionRecord && info->ExceptionRecord->ExceptionCode == EXCEPTION_ACCESS_VIOLATION
+                ? "crash (access violation)" : "crash (unhandled exception)");
+            return previous_exception_filter_ ? previous_exception_filter_(info) : EXCEPTION_CONTINUE_SEARCH;
+        }
+
+        void onAbort(int signal) {
+            dumpCrash(signalName(signal));
+            std::signal(SIGABRT, previous_abort_handler_);
+            std::raise(SIGABRT);
+        }
+
+        void installCrashHandlers() noexcept {
+            previous_exception_filter_ = SetUnhandledExceptionFilter(onUnhandledException);
+            previous_abort_handler_ = std::signal(SIGABRT, onAbort);
+        }
+
+        void removeCrashHandlers() noexcept {
+            SetUnhandledExceptionFilter(previous_exception_filter_);
+            std::signal(SIGABRT, previous_abort_handler_);
+        }
+#else
+        struct sigaction previous_actions_[std::size(FATAL_SIGNALS)];
+
+        void onFatalSignal(int signal) {
+            dumpCrash(signalName(signal));
+
+            // Hand the signal to whoever was installed before us (usually the default: core dump)
+            for (std::size_t i = 0; i < std::size(FATAL_SIGNALS); ++i) {
+                if (FATAL_SIGNALS[i] == signal) {
+                    sigaction(signal, &previous_actions_[i], nullptr);
+                }
+            }
+            raise(signal);
+        }
+
+        void installCrashHandlers() noexcept {
+            struct sigaction action {};
+            action.sa_handler = onFatalSignal;
+            sigemptyset(&action.sa_mask);
+            action.sa_flags = SA_RESETHAND;
+
+            for (std::size_t i = 0; i < std::size(FATAL_SIGNALS); ++i) {
+                sigaction(FATAL_SIGNALS[i], &action, &previous_actions_[i]);
+            }
+        }
+
+        void removeCrashHandlers() noexcept {
+            for (std::size_t i = 0; i < std::size(FATAL_SIGNALS); ++i) {
+                sigaction(FATAL_SIGNALS[i], &previous_actions_[i], nullptr);
+            }
+        }
+#endif
+
+        //--------------------------------------------------------------------------
+        // Hitch dumps
+        //--------------------------------------------------------------------------
+        std::atomic<double> frame_budget_ms_{ 0.0 };
+        std::atomic<std::int64_t> hitch_cooldown_ns_{ 10'000'000'000 };
+        std::atomic<std::int64_t> last_hitch_ns_{ std::numeric_limits<std::int64_t>::min() / 2 };
+
+        /**
+         * Writes hitch dumps off the frame thread.
+         */
+        class HitchDumper {
+        public:
+            explicit HitchDumper(std::string path_prefix)
+                : path_prefix_(std::move(path_prefix))
+                , worker_(&HitchDumper::run, this)
+            {
+            }
+
+            ~HitchDumper() {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    running_ = false;
+                }
+                condition_.notify_one();
+                worker_.join();
+            }
+
+            void request(double frame_ms, double budget_ms) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    frame_ms_ = frame_ms;
+                    budget_ms_ = budget_ms;
+                    pending_ = true;
+                }
+                condition_.notify_one();
+            }
+
+        private:
+            void run() {
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (;;) {
+                    condition_.wait(lock, [this] { return pending_ || !running_; });
+                    if (!running_) {
+                        return;
+                    }
+
+                    pending_ = false;
+                    std::string reason = "frame hitch: " + std::to_string(frame_ms_) + " ms (budget " + std::to_string(budget_ms_) + " ms)";
+                    std::string path = path_prefix_ + "_" + std::to_string(++count_) + ".flight.txt";
+
+                    lock.unlock();
+                    if (!dumpRing(path.c_str(), reason)) {
+                        Logger::error("[FlightRecorder] Failed to write hitch dump '{}'", path);
+                    }
+                    lock.lock();
+                }
+            }
+
+            std::string path_prefix_;
+            std::mutex mutex_;
+            std::condition_variable condition_;
+            bool running_ = true;
+            bool pending_ = false;
+            double frame_ms_ = 0.0;
+            double budget_ms_ = 0.0;
+            std::uint64_t count_ = 0;
+            std::thread worker_;
+        };
+
+        std::mutex enable_mutex_;
+        std::atomic<HitchDumper*> hitch_dumper_{ nullptr };
+
+    } // namespace
+
+    //------------------------------------------------------------------------------
+    // 1) Enable / disable
+    //------------------------------------------------------------------------------
+    void FlightRecorder::enable() noexcept {
+        enable(Config{});
+    }
+
+    void FlightRecorder::enable(const Config& config) noexcept {
+        disable();
+
+        std::lock_guard<std::mutex> lock(enable_mutex_);
+
+        std::size_t length = std::min(config.crash_path.size(), sizeof(crash_path_) - 1);
+        std::memcpy(crash_path_, config.crash_path.data(), length);
+        crash_path_[length] = '\0';
+        crash_dumped_.store(false);
+
+        frame_budget_ms_.store(config.frame_budget_ms, std::memory_order_relaxed);
+        hitch_cooldown_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(config.hitch_cooldown).count(), std::memory_order_relaxed);
+
+        try {
+            hitch_dumper_.store(new HitchDumper(config.hitch_path_prefix), std::memory_order_release);
+        }
+        catch (const std::exception& e) {
+            Logger::error("[FlightRecorder] Failed to start the hitch dump thread: {}", e.what());
+        }
+
+        if (config.install_crash_handlers) {
+            installCrashHandlers();
+            handlers_installed_ = true;
+        }
+    }
+
+    void FlightRecorder::disable() noexcept {
+        std::lock_guard<std::mutex> lock(enable_mutex_);
+
+        if (handlers_installed_) {
+            removeCrashHandlers();
+            handlers_installed_ = false;
+        }
+
+        frame_budget_ms_.store(0.0, std::memory_order_relaxed);
+        delete hitch_dumper_.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    void FlightRecorder::setFrameBudget(double budget_ms) noexcept {
+        frame_budget_ms_.store(budget_ms, std::memory_order_relaxed);
+    }
+
+    void FlightRecorder::setLogLevel(Logger::LogLevel level) noexcept {
+        Logger::record_min_log_level_.store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    Logger::LogLevel FlightRecorder::getLogLevel() noexcept {
+        return static_cast<Logger::LogLevel>(std::max(Logger::record_min_log_level_.load(std::memory_order_relaxed), GEMENGINE_FLIGHT_RECORDER_LOG_LEVEL));
+    }
+
+    //------------------------------------------------------------------------------
+    // 2) Recording
+    //------------------------------------------------------------------------------
+    void FlightRecorder::recordLog(Logger::LogLevel level, std::string_view message) noexcept {
+        record(Kind::Log, static_cast<std::uint8_t>(level), 0.0, message);
+    }
+
+    void FlightRecorder::recordFrame(double frame_ms) noexcept {
+        record(Kind::Frame, 0, frame_ms, {});
+
+        double budget_ms = frame_budget_ms_.load(std::memory_order_relaxed);
+        if (budget_ms <= 0.0 || frame_ms <= budget_ms) {
+            return;
+        }
+
+        // At most one dump per cooldown, whichever thread wins the exchange
+        std::int64_t now = nowNanoseconds();
+        std::int64_t last = last_hitch_ns_.load(std::memory_order_relaxed);
+        if (now - last < hitch_cooldown_ns_.load(std::memory_order_relaxed)
+            || !last_hitch_ns_.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(enable_mutex_);
+        if (HitchDumper* dumper = hitch_dumper_.load(std::memory_order_acquire)) {
+            try {
+                dumper->request(frame_ms, budget_ms);
+            }
+            catch (...) {
+                // A missed hitch dump is not worth failing the frame over
+            }
+        }
+    }
+
+    void FlightRecorder::recordTimer(std::string_view name, double elapsed_ms) noexcept {
+        record(Kind::Timer, 0, elapsed_ms, name);
+    }
+
+    //------------------------------------------------------------------------------
+    // 3) Dumping
+    //------------------------------------------------------------------------------
+    bool FlightRecorder::dump(const std::string& path, std::string_view reason) noexcept {
+        return dumpRing(path.c_str(), reason);
+    }
+
+} // namespace Gem
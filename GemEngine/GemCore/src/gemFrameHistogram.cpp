@@ -0,0 +1,176 @@
+#include <Gem/Core/FrameHistogram.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+
+#pragma warning( disable : 4996 ) // Disable warning about std::fopen being unsafe
+
+namespace Gem {
+
+    namespace {
+
+        constexpr std::uint64_t MAX_VALUE_US = (std::uint64_t(1) << FrameHistogram::MAX_VALUE_BITS) - 1;
+
+        std::uint64_t toMicroseconds(double frame_ms) noexcept {
+            if (!(frame_ms > 0.0)) {
+                return 0;   // Also catches NaN
+            }
+            double value_us = std::round(frame_ms * 1000.0);
+            return value_us >= static_cast<double>(MAX_VALUE_US) ? MAX_VALUE_US : static_cast<std::uint64_t>(value_us);
+        }
+
+    } // namespace
+
+    FrameHistogram::FrameHistogram() noexcept {
+        reset();
+    }
+
+    void FrameHistogram::record(double frame_ms) noexcept {
+        buckets_[bucketIndex(toMicroseconds(frame_ms))]++;
+        count_++;
+        sum_ms_ += frame_ms;
+        min_ms_ = std::min(min_ms_, frame_ms);
+        max_ms_ = std::max(max_ms_, frame_ms);
+    }
+
+    void FrameHistogram::merge(const FrameHistogram& other) noexcept {
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            buckets_[i] += other.buckets_[i];
+        }
+        count_ += other.count_;
+        sum_ms_ += other.sum_ms_;
+        min_ms_ = std::min(min_ms_, other.min_ms_);
+        max_ms_ = std::max(max_ms_, other.max_ms_);
+    }
+
+    void FrameHistogram::reset() noexcept {
+        buckets_.fill(0);
+        count_ = 0;
+        sum_ms_ = 0.0;
+        min_ms_ = std::numeric_limits<double>::infinity();
+        max_ms_ = 0.0;
+    }
+
+    double FrameHistogram::getPercentile(double percentile) const noexcept {
+        if (count_ == 0) {
+            return 0.0;
+        }
+
+        // Rank of the sample at this percentile (1-based)
+        double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+        std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count_)));
+        rank = std::clamp<std::uint64_t>(rank, 1, count_);
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += buckets_[i];
+            if (seen >= rank) {
+                return std::min(static_cast<double>(bucketHigh(i)) / 1000.0, max_ms_);
+            }
+        }
+        return max_ms_;
+    }
+
+    double FrameHistogram::getMin() const noexcept {
+        return count_ > 0 ? min_ms_ : 0.0;
+    }
+
+    double FrameHistogram::getMax() const noexcept {
+        return max_ms_;
+    }
+
+    double FrameHistogram::getMean() const noexcept {
+        return count_ > 0 ? sum_ms_ / static_cast<double>(count_) : 0.0;
+    }
+
+    FrameHistogram::Summary FrameHistogram::summarize() const noexcept {
+        Summary summary;
+        summary.frames = count_;
+        summary.mean_ms = getMean();
+        summary.max_ms = max_ms_;
+        if (count_ == 0) {
+            return summary;
+        }
+
+        // Percentiles in increasing order, so a single walk finds them all
+        constexpr double PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+        double* outputs[] = { &summary.p50_ms, &summary.p90_ms, &summary.p99_ms, &summary.p999_ms };
+
+        std::size_t next = 0;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT && next < std::size(PERCENTILES); ++i) {
+            seen += buckets_[i];
+            while (next < std::size(PERCENTILES)) {
+                std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(PERCENTILES[next] / 100.0 * static_cast<double>(count_)));
+                if (seen < std::clamp<std::uint64_t>(rank, 1, count_)) {
+                    break;
+                }
+                *outputs[next++] = std::min(static_cast<double>(bucketHigh(i)) / 1000.0, max_ms_);
+            }
+        }
+        return summary;
+    }
+
+    bool FrameHistogram::exportCsv(const std::string& path) const noexcept {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) {
+            return false;
+        }
+
+        std::fprintf(file, "bucket_low_ms,bucket_high_ms,count,cumulative_percent\n");
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKET_COUNT; ++i) {
+            if (buckets_[i] == 0) {
+                continue;
+            }
+            seen += buckets_[i];
+            std::fprintf(file, "%.3f,%.3f,%u,%.4f\n",
+                static_cast<double>(bucketLow(i)) / 1000.0,
+                static_cast<double>(bucketHigh(i)) / 1000.0,
+                static_cast<unsigned int>(buckets_[i]),
+                100.0 * static_cast<double>(seen) / static_cast<double>(count_));
+        }
+
+        bool ok = std::ferror(file) == 0;
+        ok = std::fclose(file) == 0 && ok;
+        return ok;
+    }
+
+    std::size_t FrameHistogram::bucketIndex(std::uint64_t value_us) noexcept {
+        if (value_us < 2 * SUB_BUCKET_COUNT) {
+            return static_cast<std::size_t>(value_us);  // Exact below 64 us
+        }
+
+        // 32 linear sub-buckets per power of two
+        int msb = static_cast<int>(std::bit_width(value_us)) - 1;
+        int shift = msb - SUB_BUCKET_BITS;
+        std::size_t top = static_cast<std::size_t>(value_us >> shift);    // In [32, 64)
+        return 2 * SUB_BUCKET_COUNT + static_cast<std::size_t>(shift - 1) * SUB_BUCKET_COUNT + (top - SUB_BUCKET_COUNT);
+    }
+
+    std::uint64_t FrameHistogram::bucketLow(std::size_t index) noexcept {
+        if (index < 2 * SUB_BUCKET_COUNT) {
+            return index;
+        }
+        std::size_t offset = index - 2 * SUB_BUCKET_COUNT;
+        int shift = static_cast<int>(offset / SUB_BUCKET_COUNT) + 1;
+        std::uint64_t top = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return top << shift;
+    }
+
+    std::uint64_t FrameHistogram::bucketHigh(std::size_t index) noexcept {
+        if (index < 2 * SUB_BUCKET_COUNT) {
+            return index;
+        }
+        std::size_t offset = index - 2 * SUB_BUCKET_COUNT;
+        int shift = static_cast<int>(offset / SUB_BUCKET_COUNT) + 1;
+        std::uint64_t top = offset % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+        return ((top + 1) << shift) - 1;
+    }
+
+} // namespace Gem
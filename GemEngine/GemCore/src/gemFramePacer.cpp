@@ -0,0 +1,216 @@
+#include <Gem/Core/FramePacer.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define GEM_CPU_RELAX() _mm_pause()
+#else
+    #define GEM_CPU_RELAX() std::this_thread::yield()
+#endif
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+    #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace Gem {
+
+    namespace {
+
+        constexpr double INITIAL_MARGIN_NS = 1'000'000.0;   // 1 ms until the first latencies are measured
+        constexpr double MIN_MARGIN_NS = 50'000.0;
+        constexpr double MAX_MARGIN_NS = 4'000'000.0;
+        constexpr double LATENCY_SMOOTHING = 1.0 / 16.0;
+        constexpr double DEVIATION_FACTOR = 4.0;
+
+        double toMicroseconds(std::chrono::nanoseconds duration) noexcept {
+            return static_cast<double>(duration.count()) / 1000.0;
+        }
+
+    } // namespace
+
+    FramePacer::FramePacer() noexcept
+        : deadline_()
+        , period_(0)
+        , has_deadline_(false)
+        , margin_ns_(INITIAL_MARGIN_NS)
+        , latency_mean_ns_(0.0)
+        , latency_dev_ns_(0.0)
+        , frames_(0)
+        , missed_frames_(0)
+        , error_sum_(0.0)
+        , error_square_sum_(0.0)
+        , error_max_(0.0)
+        , spin_sum_(0.0)
+        , timer_handle_(nullptr)
+    {
+#ifdef _WIN32
+        // High-resolution timers exist since Windows 10 1803; fall back to a regular one
+        HANDLE timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!timer) {
+            timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+        }
+        timer_handle_ = timer;
+#endif
+    }
+
+    FramePacer::~FramePacer() {
+#ifdef _WIN32
+        if (timer_handle_) {
+            CloseHandle(static_cast<HANDLE>(timer_handle_));
+        }
+#endif
+    }
+
+    void FramePacer::wait(double period_seconds) noexcept {
+        auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(period_seconds));
+        TimePoint now = ClockType::now();
+
+        if (!has_deadline_ || period != period_ || now - deadline_ > 2 * period) {
+            // New schedule (first call, new period, or more than a period behind the next
+            // deadline): the first frame is paced from now
+            deadline_ = now + period;
+            period_ = period;
+            has_deadline_ = true;
+        }
+        else {
+            deadline_ += period;
+        }
+
+        if (now >= deadline_) {
+            // Late, but less than a period behind: run immediately and keep the schedule.
+            // The lateness is an error sample too, or the statistics would only show on-time frames
+            double error_us = toMicroseconds(now - deadline_);
+
+            std::lock_guard<std::mutex> lock(stats_mutex_);
+            missed_frames_++;
+            error_sum_ += error_us;
+            error_square_sum_ += error_us * error_us;
+            error_max_ = std::max(error_max_, error_us);
+            return;
+        }
+
+        // Sleep until the margin, then spin to the deadline
+        TimePoint wake_target = deadline_ - std::chrono::nanoseconds(static_cast<std::int64_t>(margin_ns_));
+        if (wake_target > now) {
+            sleepUntil(wake_target);
+            TimePoint woke = ClockType::now();
+            adaptMargin(static_cast<double>((woke - wake_target).count()));
+        }
+
+        TimePoint spin_start = ClockType::now();
+        TimePoint end = spin_start;
+        while (end < deadline_) {
+            GEM_CPU_RELAX();
+            end = ClockType::now();
+        }
+
+        double error_us = toMicroseconds(end - deadline_);
+        double spin_us = spin_start < deadline_ ? toMicroseconds(deadline_ - spin_start) : 0.0;
+
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        frames_++;
+        error_sum_ += error_us;
+        error_square_sum_ += error_us * error_us;
+        error_max_ = std::max(error_max_, error_us);
+        spin_sum_ += spin_us;
+    }
+
+    void FramePacer::reset() noexcept {
+        has_deadline_ = false;
+    }
+
+    FramePacer::Stats FramePacer::getStats() const noexcept {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+
+        Stats stats;
+        stats.frames = frames_;
+        stats.missed_frames = missed_frames_;
+        stats.max_error_us = error_max_;
+        stats.margin_us = margin_ns_ / 1000.0;
+
+        if (frames_ + missed_frames_ > 0) {
+            double count = static_cast<double>(frames_ + missed_frames_);
+            stats.mean_error_us = error_sum_ / count;
+            stats.stddev_error_us = std::sqrt(std::max(0.0, error_square_sum_ / count - stats.mean_error_us * stats.mean_error_us));
+        }
+        if (frames_ > 0) {
+            stats.mean_spin_us = spin_sum_ / static_cast<double>(frames_);
+        }
+        return stats;
+    }
+
+    void FramePacer::resetStats() noexcept {
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+        frames_ = 0;
+        missed_frames_ = 0;
+        error_sum_ = 0.0;
+        error_square_sum_ = 0.0;
+        error_max_ = 0.0;
+        spin_sum_ = 0.0;
+    }
+
+    void FramePacer::sleepUntil(TimePoint wake_time) noexcept {
+#if defined(_WIN32)
+        if (timer_handle_) {
+            // Relative due time in 100 ns units (negative = relative)
+            auto remaining = wake_time - ClockType::now();
+            LARGE_INTEGER due;
+            due.QuadPart = -static_cast<LONGLONG>(std::max<std::int64_t>(remaining.count() / 100, 1));
+            if (SetWaitableTimer(static_cast<HANDLE>(timer_handle_), &due, 0, nullptr, nullptr, FALSE)) {
+                WaitForSingleObject(static_cast<HANDLE>(timer_handle_), INFINITE);
+                return;
+            }
+        }
+        std::this_thread::sleep_until(wake_time);
+
+#elif defined(__linux__)
+        // steady_clock is CLOCK_MONOTONIC on Linux: sleep to the absolute time
+        auto since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(wake_time.time_since_epoch()).count();
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(since_epoch / 1'000'000'000);
+        ts.tv_nsec = static_cast<long>(since_epoch % 1'000'000'000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+        }
+
+#else
+        std::this_thread::sleep_until(wake_time);
+
+#endif
+    }
+
+    void FramePacer::adaptMargin(double latency_ns) noexcept {
+        if (latency_mean_ns_ <= 0.0) {
+            latency_mean_ns_ = latency_ns;  // First sample
+        }
+
+        double deviation = std::abs(latency_ns - latency_mean_ns_);
+        latency_mean_ns_ += (latency_ns - latency_mean_ns_) * LATENCY_SMOOTHING;
+        latency_dev_ns_ += (deviation - latency_dev_ns_) * LATENCY_SMOOTHING;
+
+        double margin = latency_mean_ns_ + DEVIATION_FACTOR * latency_dev_ns_;
+        if (latency_ns > margin_ns_) {
+            // Overslept the deadline: widen at once instead of waiting for the average to follow
+            margin = std::max(margin, latency_ns * 1.25);
+        }
+
+        std::lock_guard<std::mutex> lock(stats_mutex_);  // getStats() reports the margin
+        margin_ns_ = std::clamp(margin, MIN_MARGIN_NS, MAX_MARGIN_NS);
+    }
+
+} // namespace Gem
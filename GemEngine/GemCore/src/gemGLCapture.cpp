@@ -0,0 +1,173 @@
+#include <Gem/Core/GLCapture.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace Gem {
+
+    namespace {
+
+        Metrics::Counter capture_bytes_("gl.capture_bytes");
+
+        constexpr std::size_t FLUSH_SIZE = 4 * 1024 * 1024;   ///< Records are batched into fwrite calls this large.
+
+        std::mutex mutex_;                      ///< Guards everything below.
+        std::FILE* file_ = nullptr;
+        std::vector<std::byte> buffer_;
+        std::uint32_t generation_ = 0;          ///< Bumped by begin(), so context numbers restart per file.
+        std::uint8_t next_context_ = 0;
+        std::uint32_t frame_limit_ = 0;
+        std::atomic<std::uint32_t> frame_count_{ 0 };
+        std::atomic<std::uint64_t> byte_count_{ 0 };
+        std::chrono::steady_clock::time_point frame_start_;
+
+        /**
+         * Context number of the calling thread in the current capture.
+         */
+        struct ThreadContext {
+            std::uint32_t generation = 0;
+            std::uint8_t context = 0;
+        };
+        thread_local ThreadContext thread_context_;
+
+        std::uint8_t contextOfThisThread() noexcept {
+            if (thread_context_.generation != generation_) {
+                thread_context_.generation = generation_;
+                thread_context_.context = next_context_ < 0xFF ? next_context_++ : 0xFF;
+            }
+            return thread_context_.context;
+        }
+
+        void flushBuffer() noexcept {
+            if (!buffer_.empty()) {
+                std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+                buffer_.clear();
+            }
+        }
+
+        void write(const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const std::byte*>(data);
+            buffer_.insert(buffer_.end(), bytes, bytes + size);
+        }
+
+        std::int64_t nanosecondsSinceEpoch(auto time_point) noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+        }
+
+    } // namespace
+
+    std::atomic<bool> GLCapture::capturing_{ false };
+
+    bool GLCapture::begin(const std::string& path, std::uint32_t frame_limit) {
+        end();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        file_ = std::fopen(path.c_str(), "wb");
+        if (!file_) {
+            GEM_LOG_ERROR(Logger::Channel::Core, "GLCapture: cannot create '{}'.", path);
+            return false;
+        }
+
+        GLCaptureFormat::FileHeader header{};
+        std::memcpy(header.magic, GLCaptureFormat::MAGIC, sizeof(header.magic));
+        header.version = GLCaptureFormat::VERSION;
+        header.header_size = sizeof(GLCaptureFormat::FileHeader);
+        header.system_time_ns = nanosecondsSinceEpoch(std::chrono::system_clock::now());
+
+        buffer_.clear();
+        buffer_.reserve(FLUSH_SIZE + 64 * 1024);
+        write(&header, sizeof(header));
+
+        generation_++;
+        next_context_ = 0;
+        contextOfThisThread();  // The calling (render) thread is context 0
+
+        frame_limit_ = frame_limit;
+        frame_count_.store(0, std::memory_order_relaxed);
+        byte_count_.store(sizeof(header), std::memory_order_relaxed);
+        frame_start_ = std::chrono::steady_clock::now();
+
+        capturing_.store(true, std::memory_order_release);
+        GEM_LOG_INFO(Logger::Channel::Core, "GLCapture: recording GL calls to '{}'.", path);
+        return true;
+    }
+
+    void GLCapture::end() {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!file_) {
+            return;
+        }
+        capturing_.store(false, std::memory_order_release);
+
+        flushBuffer();
+        std::fclose(file_);
+        file_ = nullptr;
+        buffer_.shrink_to_fit();
+
+        GEM_LOG_INFO(Logger::Channel::Core, "GLCapture: {} frames, {} bytes captured.",
+            frame_count_.load(std::memory_order_relaxed), byte_count_.load(std::memory_order_relaxed));
+    }
+
+    void GLCapture::endFrame() {
+        if (!isCapturing()) {
+            return;
+        }
+
+        bool limit_reached = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!file_) {
+                return;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            std::int64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - frame_start_).count();
+            frame_start_ = now;
+
+            GLCaptureFormat::RecordHeader header{ static_cast<std::uint16_t>(GLCaptureFormat::Call::EndFrame), contextOfThisThread(), 0, sizeof(duration) };
+            write(&header, sizeof(header));
+            write(&duration, sizeof(duration));
+            byte_count_.fetch_add(sizeof(header) + sizeof(duration), std::memory_order_relaxed);
+
+            std::uint32_t frames = frame_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+            limit_reached = frame_limit_ != 0 && frames >= frame_limit_;
+        }
+
+        if (limit_reached) {
+            end();
+        }
+    }
+
+    std::uint32_t GLCapture::getFrameCount() noexcept {
+        return frame_count_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t GLCapture::getByteCount() noexcept {
+        return byte_count_.load(std::memory_order_relaxed);
+    }
+
+    void GLCapture::append(GLCaptureFormat::Call call, const std::byte* payload, std::size_t size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!file_) {
+            return;     // Ended between the wrapper's check and now
+        }
+
+        GLCaptureFormat::RecordHeader header{ static_cast<std::uint16_t>(call), contextOfThisThread(), 0, static_cast<std::uint32_t>(size) };
+        write(&header, sizeof(header));
+        write(payload, size);
+        byte_count_.fetch_add(sizeof(header) + size, std::memory_order_relaxed);
+        capture_bytes_.add(sizeof(header) + size);
+
+        if (buffer_.size() >= FLUSH_SIZE) {
+            flushBuffer();
+        }
+    }
+
+} // namespace Gem
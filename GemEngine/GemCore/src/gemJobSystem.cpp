@@ -0,0 +1,309 @@
+#include <Gem/Core/JobSystem.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
+#include <WorkStealingDeque.h>
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace Gem {
+
+    /**
+     * Worker state and scheduling, kept out of the header.
+     */
+    struct JobSystemInternal {
+        using Job = JobSystem::Job;
+
+        static constexpr int SPIN_ATTEMPTS = 64;   ///< Failed searches before a worker goes to sleep.
+
+        /**
+         * Deque and job ring of one participating thread.
+         */
+        struct ThreadState {
+            ThreadState(unsigned int thread_index, std::size_t capacity)
+                : index(thread_index), deque(capacity), pool(std::make_unique<Job[]>(capacity)),
+                pool_mask(capacity - 1), random(thread_index * 2654435761u + 1) {}
+
+            unsigned int index;
+            WorkStealingDeque<Job> deque;
+            std::unique_ptr<Job[]> pool;
+            std::size_t pool_mask;
+            std::size_t pool_cursor = 0;
+            std::uint32_t random;   ///< xorshift state for victim selection
+        };
+
+        static inline std::vector<std::unique_ptr<ThreadState>> states_;    ///< 0 = init() thread
+        static inline std::vector<std::thread> workers_;
+        static inline std::atomic<bool> initialized_{ false };
+        static inline std::atomic<bool> running_{ false };
+
+        // Jobs submitted by threads outside the system
+        static inline std::mutex injection_mutex_;
+        static inline std::deque<Job*> injection_;
+        static inline std::atomic<std::size_t> injection_size_{ 0 };
+
+        // Sleeping workers wait for epoch_ to change
+        static inline std::atomic<std::uint32_t> epoch_{ 0 };
+        static inline std::atomic<std::uint32_t> sleepers_{ 0 };
+
+        static inline thread_local ThreadState* local_ = nullptr;
+
+        static inline Metrics::Counter executed_{ "jobs.executed" };
+        static inline Metrics::Counter stolen_{ "jobs.stolen" };
+
+        static void pause() noexcept {
+#if defined(_MSC_VER)
+            _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#else
+            std::this_thread::yield();
+#endif
+        }
+
+        static std::size_t roundUpToPowerOfTwo(std::size_t value) noexcept {
+            std::size_t size = 2;
+            while (size < value) {
+                size <<= 1;
+            }
+            return size;
+        }
+
+        static void execute(Job* job) noexcept {
+            try {
+                job->invoke(*job);
+            }
+            catch (const std::exception& e) {
+                GEM_LOG_ERROR(Logger::Channel::Core, "JobSystem: job threw an exception: {}", e.what());
+            }
+            catch (...) {
+                GEM_LOG_ERROR(Logger::Channel::Core, "JobSystem: job threw an unknown exception.");
+            }
+
+            executed_.add();
+
+            if (job->counter) {
+                job->counter->pending_.fetch_sub(1, std::memory_order_release);
+            }
+            if (job->pooled) {
+                job->finished.store(true, std::memory_order_release);
+            }
+            else {
+                delete job;
+            }
+        }
+
+        /**
+         * Own deque first, then the shared queue, then a steal from a random victim.
+         */
+        static Job* findJob(ThreadState* self) noexcept {
+            if (self) {
+                if (Job* job = self->deque.pop()) {
+                    return job;
+                }
+            }
+
+            if (injection_size_.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(injection_mutex_);
+                if (!injection_.empty()) {
+                    Job* job = injection_.front();
+                    injection_.pop_front();
+                    injection_size_.fetch_sub(1, std::memory_order_relaxed);
+                    return job;
+                }
+            }
+
+            std::size_t count = states_.size();
+            std::size_t start = 0;
+            if (self) {
+                self->random ^= self->random << 13;
+                self->random ^= self->random >> 17;
+                self->random ^= self->random << 5;
+                start = self->random % count;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                ThreadState* victim = states_[(start + i) % count].get();
+                if (victim == self) {
+                    continue;
+                }
+                if (Job* job = victim->deque.steal()) {
+                    stolen_.add();
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        static void wake() noexcept {
+            // Pairs with the fence in WorkStealingDeque::steal: either this sees the sleeper,
+            // or the sleeper's last search sees the job
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_relaxed) > 0) {
+                epoch_.fetch_add(1, std::memory_order_release);
+                epoch_.notify_one();
+            }
+        }
+
+        static void workerMain(ThreadState* self) {
+            local_ = self;
+            Profiler::setThreadName("Job worker " + std::to_string(self->index));
+
+            while (running_.load(std::memory_order_acquire)) {
+                Job* job = nullptr;
+                for (int attempt = 0; attempt < SPIN_ATTEMPTS && !job; ++attempt) {
+                    job = findJob(self);
+                    if (!job) {
+                        pause();
+                    }
+                }
+
+                if (!job) {
+                    std::uint32_t seen = epoch_.load(std::memory_order_acquire);
+                    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+                    job = findJob(self);
+                    if (!job && running_.load(std::memory_order_acquire)) {
+                        epoch_.wait(seen, std::memory_order_acquire);
+                    }
+                    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                if (job) {
+                    execute(job);
+                }
+            }
+
+            local_ = nullptr;
+        }
+    };
+
+    using Internal = JobSystemInternal;
+
+    void JobSystem::init() {
+        init(Config{});
+    }
+
+    void JobSystem::init(const Config& config) {
+        if (Internal::initialized_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        unsigned int workers = config.worker_count;
+        if (workers == 0) {
+            unsigned int hardware = std::thread::hardware_concurrency();
+            workers = hardware > 1 ? hardware - 1 : 1;
+        }
+        std::size_t capacity = Internal::roundUpToPowerOfTwo(config.jobs_per_thread);
+
+        Internal::states_.clear();
+        for (unsigned int i = 0; i <= workers; ++i) {
+            Internal::states_.push_back(std::make_unique<Internal::ThreadState>(i, capacity));
+        }
+        Internal::local_ = Internal::states_[0].get();
+
+        Internal::running_.store(true, std::memory_order_release);
+        Internal::initialized_.store(true, std::memory_order_release);
+        for (unsigned int i = 1; i <= workers; ++i) {
+            Internal::workers_.emplace_back(&Internal::workerMain, Internal::states_[i].get());
+        }
+
+        GEM_LOG_INFO(Logger::Channel::Core, "JobSystem: {} workers, {} jobs per thread.", workers, capacity);
+    }
+
+    void JobSystem::shutdown() {
+        if (!Internal::initialized_.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // Finish what is queued; jobs may still be submitting more
+        while (Internal::Job* job = Internal::findJob(Internal::local_)) {
+            Internal::execute(job);
+        }
+
+        Internal::running_.store(false, std::memory_order_release);
+        Internal::epoch_.fetch_add(1, std::memory_order_release);
+        Internal::epoch_.notify_all();
+        for (std::thread& worker : Internal::workers_) {
+            worker.join();
+        }
+        Internal::workers_.clear();
+
+        // A worker may have queued a job after the drain above
+        while (Internal::Job* job = Internal::findJob(Internal::local_)) {
+            Internal::execute(job);
+        }
+
+        Internal::initialized_.store(false, std::memory_order_release);
+        Internal::local_ = nullptr;
+        Internal::states_.clear();
+        GEM_LOG_DEBUG(Logger::Channel::Core, "JobSystem: shut down.");
+    }
+
+    bool JobSystem::isInitialized() noexcept {
+        return Internal::initialized_.load(std::memory_order_acquire);
+    }
+
+    unsigned int JobSystem::getWorkerCount() noexcept {
+        return static_cast<unsigned int>(Internal::workers_.size());
+    }
+
+    void JobSystem::wait(const Counter& counter) {
+        int idle = 0;
+        while (!counter.isDone()) {
+            if (Job* job = Internal::findJob(Internal::local_)) {
+                Internal::execute(job);
+                idle = 0;
+            }
+            else if (++idle < Internal::SPIN_ATTEMPTS) {
+                Internal::pause();
+            }
+            else {
+                std::this_thread::yield();  // The remaining jobs are running elsewhere
+            }
+        }
+    }
+
+    JobSystem::Job* JobSystem::allocate() {
+        Internal::ThreadState* self = Internal::local_;
+
+        // The ring wrapped onto a job that is still queued or running, possibly further up
+        // this thread's stack (nested waits): waiting for it could deadlock, use the heap
+        Job* job = self ? &self->pool[self->pool_cursor++ & self->pool_mask] : nullptr;
+        if (!job || !job->finished.load(std::memory_order_acquire)) {
+            job = new Job;
+            job->pooled = false;
+        }
+
+        job->finished.store(false, std::memory_order_relaxed);
+        job->counter = nullptr;
+        return job;
+    }
+
+    void JobSystem::submit(Job* job) {
+        Internal::ThreadState* self = Internal::local_;
+        if (self) {
+            if (!self->deque.push(job)) {
+                Internal::execute(job);     // Full (only with heap jobs): run it now
+                return;
+            }
+        }
+        else {
+            std::lock_guard<std::mutex> lock(Internal::injection_mutex_);
+            Internal::injection_.push_back(job);
+            Internal::injection_size_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Internal::wake();
+    }
+
+} // namespace Gem
@@ -0,0 +1,141 @@
+#include <LogSink.h>
+
+#include <filesystem>
+#include <system_error>
+
+#pragma warning( disable : 4996 ) // Disable warning about std::fopen being unsafe
+
+namespace Gem {
+
+    namespace LogFormat {
+
+        const char* level_string(Logger::LogLevel level) noexcept {
+            switch (level) {
+            case Logger::LogLevel::Debug:   return "DEBUG";
+            case Logger::LogLevel::Info:    return "INFO";
+            case Logger::LogLevel::Warning: return "WARN";
+            case Logger::LogLevel::Error:   return "ERROR";
+            }
+            return "UNKNOWN";
+        }
+
+        const char* level_color(Logger::LogLevel level) noexcept {
+            switch (level) {
+            case Logger::LogLevel::Debug:   return "\033[36m"; // cyan
+            case Logger::LogLevel::Info:    return "\033[32m"; // green
+            case Logger::LogLevel::Warning: return "\033[33m"; // yellow
+            case Logger::LogLevel::Error:   return "\033[31m"; // red
+            }
+            return "";
+        }
+
+    } // namespace LogFormat
+
+    //------------------------------------------------------------------------------
+    // ConsoleSink
+    //------------------------------------------------------------------------------
+    void ConsoleSink::write(Logger::LogLevel level, std::string_view timestamp, std::string_view message) {
+        batch_ += LogFormat::level_color(level);
+        batch_ += '[';
+        batch_ += timestamp;
+        batch_ += "] [";
+        batch_ += LogFormat::level_string(level);
+        batch_ += "] ";
+        batch_ += message;
+        batch_ += LogFormat::RESET_COLOR;
+        batch_ += '\n';
+    }
+
+    void ConsoleSink::flush() {
+        if (!batch_.empty()) {
+            std::fwrite(batch_.data(), 1, batch_.size(), stdout);
+            batch_.clear(); // Keeps capacity for the next batch
+        }
+        std::fflush(stdout);
+    }
+
+    //------------------------------------------------------------------------------
+    // RotatingFileSink
+    //------------------------------------------------------------------------------
+    RotatingFileSink::RotatingFileSink(std::string path, std::size_t max_file_size, std::size_t max_files)
+        : path_(std::move(path))
+        , max_file_size_(max_file_size)
+        , max_files_(max_files)
+    {
+        file_ = std::fopen(path_.c_str(), "ab");
+        if (file_) {
+            std::error_code ec;
+            auto size = std::filesystem::file_size(path_, ec);
+            file_size_ = ec ? 0 : static_cast<std::size_t>(size);
+        }
+    }
+
+    RotatingFileSink::~RotatingFileSink() {
+        flush();
+        if (file_) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    void RotatingFileSink::write(Logger::LogLevel level, std::string_view timestamp, std::string_view message) {
+        batch_ += '[';
+        batch_ += timestamp;
+        batch_ += "] [";
+        batch_ += LogFormat::level_string(level);
+        batch_ += "] ";
+        batch_ += message;
+        batch_ += '\n';
+    }
+
+    void RotatingFileSink::flush() {
+        if (!file_) {
+            batch_.clear();
+            return;
+        }
+
+        if (!batch_.empty()) {
+            if (max_file_size_ > 0 && file_size_ + batch_.size() > max_file_size_ && file_size_ > 0) {
+                rotate();
+                if (!file_) {
+                    batch_.clear();
+                    return;
+                }
+            }
+
+            std::fwrite(batch_.data(), 1, batch_.size(), file_);
+            file_size_ += batch_.size();
+            batch_.clear();
+        }
+        std::fflush(file_);
+    }
+
+    bool RotatingFileSink::is_open() const noexcept {
+        return file_ != nullptr;
+    }
+
+    void RotatingFileSink::rotate() {
+        std::fclose(file_);
+        file_ = nullptr;
+
+        std::error_code ec;
+        if (max_files_ == 0) {
+            std::filesystem::remove(path_, ec);
+        }
+        else {
+            // Shift "path.N-1" -> "path.N", ..., "path" -> "path.1"; the oldest one is overwritten
+            for (std::size_t i = max_files_; i > 1; --i) {
+                std::string from = path_ + "." + std::to_string(i - 1);
+                std::string to = path_ + "." + std::to_string(i);
+                std::filesystem::remove(to, ec); // rename() does not overwrite on Windows
+                std::filesystem::rename(from, to, ec);
+            }
+            std::filesystem::remove(path_ + ".1", ec);
+            std::filesystem::rename(path_, path_ + ".1", ec);
+        }
+
+        file_ = std::fopen(path_.c_str(), "wb");
+        file_size_ = 0;
+    }
+
+} // namespace Gem
@@ -1,30 +1,380 @@
 #include <Gem/Core/Logger.h>
+#include <Gem/Core/FlightRecorder.h>
+#include <LogSink.h>
+#include <MPSCQueue.h>
+
+#include <atomic>
 #include <ctime>   // for std::time_t, localtime, strftime
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #pragma warning( disable : 4996 ) // Disable warning about std::localtime being unsafe
 
 namespace Gem {
 
+    namespace {
+
+        //--------------------------------------------------------------------------
+        // Async backend
+        //--------------------------------------------------------------------------
+        struct LogRecord {
+            Logger::LogLevel level = Logger::LogLevel::Info;
+            std::chrono::system_clock::time_point time;
+            std::string message; ///< Slot strings keep their capacity between uses.
+            bool lost = false;   ///< The message could not be copied (out of memory), skipped by the drain thread.
+        };
+
+        /**
+         * Owns the MPSC queue, the sinks and the drain thread.
+         * Producers only touch the queue and a few atomics.
+         */
+        class AsyncBackend {
+        public:
+            explicit AsyncBackend(const Logger::AsyncConfig& config)
+                : config_(config)
+                , queue_(config.queue_capacity)
+            {
+                if (config_.console) {
+                    sinks_.push_back(std::make_unique<ConsoleSink>());
+                }
+                if (!config_.file_path.empty()) {
+                    auto file = std::make_unique<RotatingFileSink>(config_.file_path, config_.max_file_size, config_.max_files);
+                    if (file->is_open()) {
+                        sinks_.push_back(std::move(file));
+                    }
+                    else {
+                        std::cerr << "[Logger] Failed to open log file '" << config_.file_path << "', file sink disabled." << std::endl;
+                    }
+                }
+
+                worker_ = std::thread(&AsyncBackend::run, this);
+            }
+
+            ~AsyncBackend() {
+                running_.store(false, std::memory_order_release);
+                if (worker_.joinable()) {
+                    worker_.join();
+                }
+            }
+
+            void push(Logger::LogLevel level, std::string_view message) noexcept {
+                auto now = std::chrono::system_clock::now();
+                auto writer = [&](LogRecord& record) {
+                    record.level = level;
+                    record.time = now;
+                    record.lost = false;
+                    try {
+                        record.message.assign(message);
+                    }
+                    catch (...) {
+                        // The slot is already claimed and must still be published: publish it empty
+                        record.message.clear();
+                        record.lost = true;
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                };
+
+                while (!queue_.try_produce(writer)) {
+                    if (config_.overflow_policy != Logger::OverflowPolicy::Block) {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        return;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+
+            void flush() noexcept {
+                std::uint64_t ticket = flush_requested_.fetch_add(1, std::memory_order_acq_rel) + 1;
+                while (flush_completed_.load(std::memory_order_acquire) < ticket) {
+                    std::this_thread::yield();
+                }
+            }
+
+            [[nodiscard]] std::uint64_t dropped() const noexcept {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+        private:
+            void run() {
+                using SteadyClock = std::chrono::steady_clock;
+
+                auto last_flush = SteadyClock::now();
+                std::size_t pending_bytes = 0;
+                std::uint64_t reported_drops = 0;
+
+                std::time_t cached_second = 0;
+                char timestamp[20] = {};
+
+                auto write_record = [&](LogRecord& record) {
+                    if (record.lost) {
+                        return false;
+                    }
+
+                    // Records arrive in time order, so most of them reuse the cached second.
+                    std::time_t second = std::chrono::system_clock::to_time_t(record.time);
+                    if (second != cached_second || timestamp[0] == '\0') {
+                        cached_second = second;
+                        std::tm* timeinfo = std::localtime(&second);
+                        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", timeinfo);
+                    }
+
+                    for (auto& sink : sinks_) {
+                        sink->write(record.level, timestamp, record.message);
+                    }
+                    pending_bytes += record.message.size() + 32;
+                    return record.level == Logger::LogLevel::Error;
+                };
+
+                auto flush_sinks = [&]() {
+                    for (auto& sink : sinks_) {
+                        sink->flush();
+                    }
+                    pending_bytes = 0;
+                    last_flush = SteadyClock::now();
+                };
+
+                for (;;) {
+                    bool stopping = !running_.load(std::memory_order_acquire);
+                    std::uint64_t flush_ticket = flush_requested_.load(std::memory_order_acquire);
+
+                    bool urgent = false;
+                    std::size_t drained = 0;
+                    while (queue_.try_consume([&](LogRecord& record) { urgent |= write_record(record); })) {
+                        ++drained;
+                        if (pending_bytes >= config_.flush_bytes) {
+                            flush_sinks();
+                        }
+                    }
+
+                    if (config_.overflow_policy == Logger::OverflowPolicy::DropAndReport) {
+                        std::uint64_t drops = dropped_.load(std::memory_order_relaxed);
+                        if (drops != reported_drops) {
+                            LogRecord report;
+                            report.level = Logger::LogLevel::Warning;
+                            report.time = std::chrono::system_clock::now();
+                            report.message = "[Logger] " + std::to_string(drops - reported_drops) + " log records dropped (queue full or out of memory)";
+                            write_record(report);
+                            reported_drops = drops;
+                        }
+                    }
+
+                    bool flush_pending = flush_ticket > flush_completed_.load(std::memory_order_relaxed);
+                    bool interval_elapsed = SteadyClock::now() - last_flush >= config_.flush_interval;
+                    if (pending_bytes > 0 && (urgent || interval_elapsed || flush_pending)) {
+                        flush_sinks();
+                    }
+
+                    if (flush_pending) {
+                        flush_completed_.store(flush_ticket, std::memory_order_release);
+                    }
+
+                    if (stopping) {
+                        // running_ was cleared before this pass started, so every record
+                        // pushed before disableAsync() has been drained.
+                        flush_sinks();
+                        flush_completed_.store(flush_requested_.load(std::memory_order_acquire), std::memory_order_release);
+                        return;
+                    }
+
+                    if (drained == 0) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+            }
+
+            Logger::AsyncConfig config_;
+            MPSCQueue<LogRecord> queue_;
+            std::vector<std::unique_ptr<LogSink>> sinks_;
+            std::thread worker_;
+
+            std::atomic<bool> running_{ true };
+            std::atomic<std::uint64_t> dropped_{ 0 };
+            std::atomic<std::uint64_t> flush_requested_{ 0 };
+            std::atomic<std::uint64_t> flush_completed_{ 0 };
+        };
+
+        std::atomic<AsyncBackend*> async_backend_{ nullptr };
+        std::atomic<int> async_users_{ 0 };            ///< Producers currently inside the backend.
+        std::atomic<std::uint64_t> retired_drops_{ 0 }; ///< Drops counted by previous backends.
+
+        /**
+         * Pins the backend while a producer uses it, so disableAsync() cannot delete it underneath.
+         */
+        class AsyncGuard {
+        public:
+            // Sequentially consistent on purpose: pairs with detachBackend() (store-then-load on both sides).
+            AsyncGuard() noexcept {
+                async_users_.fetch_add(1);
+                backend_ = async_backend_.load();
+            }
+
+            ~AsyncGuard() {
+                async_users_.fetch_sub(1);
+            }
+
+            [[nodiscard]] AsyncBackend* get() const noexcept { return backend_; }
+
+        private:
+            AsyncBackend* backend_;
+        };
+
+        AsyncBackend* detachBackend() noexcept {
+            AsyncBackend* backend = async_backend_.exchange(nullptr);
+            // Wait for producers that loaded the old pointer
+            while (async_users_.load() != 0) {
+                std::this_thread::yield();
+            }
+            return backend;
+        }
+
+        /**
+         * Drains the async queue when the program exits.
+         */
+        struct AsyncShutdown {
+            ~AsyncShutdown() {
+                Logger::disableAsync();
+            }
+        } async_shutdown_;
+
+        //--------------------------------------------------------------------------
+        // Channel registry
+        //--------------------------------------------------------------------------
+        std::mutex channel_mutex_; ///< Guards registration only; lookups by id are lock-free.
+        std::deque<std::string> user_channel_names_; ///< Backing storage for registered names (never shrinks).
+
+        // Constant-initialized, so logging from other static constructors sees the built-in names
+        std::array<std::string_view, Logger::MAX_CHANNELS> channel_names_ = {
+            "Core", "Window", "Input", "Graphics", "Shader", "Texture"
+        };
+        std::atomic<std::size_t> channel_count_{ 6 };
+
+    } // namespace
+
     std::mutex Logger::log_mutex_;
-    Logger::LogLevel Logger::min_log_level_ = Logger::LogLevel::Debug;
+    std::atomic<int> Logger::min_log_level_{ static_cast<int>(Logger::LogLevel::Debug) };
+    std::atomic<int> Logger::record_min_log_level_{ static_cast<int>(Logger::LogLevel::Debug) };
+    std::array<std::atomic<int>, Logger::MAX_CHANNELS> Logger::channel_levels_{};
 
     //------------------------------------------------------------------------------
     // 1) Set/Get runtime log level
     //------------------------------------------------------------------------------
     void Logger::setMinLogLevel(LogLevel level) noexcept {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        min_log_level_ = level;
+        min_log_level_.store(static_cast<int>(level), std::memory_order_relaxed);
     }
 
     Logger::LogLevel Logger::getMinLogLevel() noexcept {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        return min_log_level_;
+        return static_cast<LogLevel>(min_log_level_.load(std::memory_order_relaxed));
+    }
+
+    //------------------------------------------------------------------------------
+    // 1a) Channels
+    //------------------------------------------------------------------------------
+    Logger::Channel Logger::registerChannel(std::string_view name) noexcept {
+        std::lock_guard<std::mutex> lock(channel_mutex_);
+
+        std::size_t count = channel_count_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (channel_names_[i] == name) {
+                return static_cast<Channel>(i);
+            }
+        }
+
+        if (count == MAX_CHANNELS) {
+            std::cerr << "[Logger] Too many log channels, '" << name << "' is mapped to Core." << std::endl;
+            return Channel::Core;
+        }
+
+        try {
+            channel_names_[count] = user_channel_names_.emplace_back(name);
+        }
+        catch (...) {
+            return Channel::Core;
+        }
+        channel_levels_[count].store(static_cast<int>(LogLevel::Debug), std::memory_order_relaxed);
+        channel_count_.store(count + 1, std::memory_order_release);
+        return static_cast<Channel>(count);
+    }
+
+    void Logger::setChannelLevel(Channel channel, LogLevel level) noexcept {
+        channel_levels_[static_cast<std::size_t>(channel) % MAX_CHANNELS].store(static_cast<int>(level), std::memory_order_relaxed);
+    }
+
+    Logger::LogLevel Logger::getChannelLevel(Channel channel) noexcept {
+        return static_cast<LogLevel>(channel_levels_[static_cast<std::size_t>(channel) % MAX_CHANNELS].load(std::memory_order_relaxed));
+    }
+
+    std::string_view Logger::getChannelName(Channel channel) noexcept {
+        std::size_t index = static_cast<std::size_t>(channel);
+        if (index >= channel_count_.load(std::memory_order_acquire)) {
+            return "Unknown";
+        }
+        return channel_names_[index];
+    }
+
+    //------------------------------------------------------------------------------
+    // 1b) Asynchronous mode
+    //------------------------------------------------------------------------------
+    void Logger::enableAsync() noexcept {
+        enableAsync(AsyncConfig{});
+    }
+
+    void Logger::enableAsync(const AsyncConfig& config) noexcept {
+        disableAsync();
+
+        try {
+            async_backend_.store(new AsyncBackend(config), std::memory_order_release);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[Logger] Failed to start async logging, staying synchronous: " << e.what() << std::endl;
+        }
+    }
+
+    void Logger::disableAsync() noexcept {
+        AsyncBackend* backend = detachBackend();
+        if (backend) {
+            retired_drops_.fetch_add(backend->dropped(), std::memory_order_relaxed);
+            delete backend; // Joins the drain thread after it empties the queue
+        }
+    }
+
+    void Logger::flush() noexcept {
+        AsyncGuard guard;
+        if (guard.get()) {
+            guard.get()->flush();
+        }
+    }
+
+    bool Logger::isAsync() noexcept {
+        return async_backend_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    std::uint64_t Logger::getDroppedCount() noexcept {
+        AsyncGuard guard;
+        std::uint64_t dropped = retired_drops_.load(std::memory_order_relaxed);
+        if (guard.get()) {
+            dropped += guard.get()->dropped();
+        }
+        return dropped;
     }
 
     //------------------------------------------------------------------------------
     // 2) logImpl() - Actual printing
     //------------------------------------------------------------------------------
-    void Logger::logImpl(LogLevel level, const std::string& message) noexcept {
+    void Logger::logImpl(LogLevel level, std::string_view message) noexcept {
+        if (isRecorded(level)) {
+            FlightRecorder::recordLog(level, message);
+        }
+
+        {
+            AsyncGuard guard;
+            if (guard.get()) {
+                guard.get()->push(level, message);
+                return;
+            }
+        }
+
         // Acquire the lock to ensure thread-safe printing
         std::lock_guard<std::mutex> lock(log_mutex_);
 
@@ -32,26 +382,27 @@ namespace Gem {
         std::string timeStr = getCurrentTime();
         std::string levelStr = logLevelToString(level);
 
-        // (Optional) Add color codes if you like:
-        // e.g., for ANSI terminals:
-        std::string colorCode;
-        switch (level) {
-        case LogLevel::Debug:   colorCode = "\033[36m"; break; // cyan
-        case LogLevel::Info:    colorCode = "\033[32m"; break; // green
-        case LogLevel::Warning: colorCode = "\033[33m"; break; // yellow
-        case LogLevel::Error:   colorCode = "\033[31m"; break; // red
-        }
-        const std::string resetCode = "\033[0m";
+        // ANSI color codes for the console
+        const char* colorCode = LogFormat::level_color(level);
 
         // Print to standard output (you could also print to a file, etc.)
         std::cout << colorCode
             << "[" << timeStr << "] "
             << "[" << levelStr << "] "
             << message
-            << resetCode
+            << LogFormat::RESET_COLOR
             << std::endl;
     }
 
+    void Logger::recordImpl(LogLevel level, std::string_view message) noexcept {
+        FlightRecorder::recordLog(level, message);
+    }
+
+    std::string& Logger::formatBuffer() noexcept {
+        thread_local std::string buffer;
+        return buffer;
+    }
+
     //------------------------------------------------------------------------------
     // 3) getCurrentTime()
     //------------------------------------------------------------------------------
@@ -72,13 +423,7 @@ namespace Gem {
     // 4) logLevelToString()
     //------------------------------------------------------------------------------
     std::string Logger::logLevelToString(LogLevel level) noexcept {
-        switch (level) {
-        case LogLevel::Debug:   return "DEBUG";
-        case LogLevel::Info:    return "INFO";
-        case LogLevel::Warning: return "WARN";
-        case LogLevel::Error:   return "ERROR";
-        }
-        return "UNKNOWN";
+        return LogFormat::level_string(level);
     }
 
 } // namespace Gem
@@ -0,0 +1,352 @@
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Logger.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <limits>
+#include <mutex>
+
+namespace Gem {
+
+    namespace {
+
+        constexpr std::uint32_t INVALID_ID = std::numeric_limits<std::uint32_t>::max();
+
+        using HistogramBuckets = std::array<std::uint64_t, Metrics::HISTOGRAM_BUCKETS>;
+
+        //--------------------------------------------------------------------------
+        // Per-thread shards
+        //--------------------------------------------------------------------------
+        /**
+         * Written only by its owner thread (plain relaxed load + store, no RMW),
+         * read by newFrame() under the registry mutex.
+         */
+        struct Shard {
+            std::array<std::atomic<std::uint64_t>, Metrics::MAX_COUNTERS> counters{};
+            std::array<std::array<std::atomic<std::uint64_t>, Metrics::HISTOGRAM_BUCKETS>, Metrics::MAX_HISTOGRAMS> histograms{};
+        };
+
+        inline void bump(std::atomic<std::uint64_t>& value, std::uint64_t amount) noexcept {
+            value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        //--------------------------------------------------------------------------
+        // Registry
+        //--------------------------------------------------------------------------
+        struct Registry {
+            std::mutex mutex;                                   ///< Guards every non-atomic member.
+
+            std::vector<std::string> counter_names;
+            std::vector<std::string> gauge_names;
+            std::vector<std::string> histogram_names;
+
+            std::vector<Shard*> shards;
+
+            // Counters
+            std::array<std::uint64_t, Metrics::MAX_COUNTERS> retired_counters{};    ///< Shards of exited threads.
+            std::array<std::uint64_t, Metrics::MAX_COUNTERS> previous_totals{};
+            std::array<std::uint64_t, Metrics::MAX_COUNTERS> interval_sums{};
+            std::array<std::atomic<std::uint64_t>, Metrics::MAX_COUNTERS> frame_values{};
+            std::array<std::atomic<std::uint64_t>, Metrics::MAX_COUNTERS> totals{};
+
+            // Gauges
+            std::array<std::atomic<std::int64_t>, Metrics::MAX_GAUGES> gauges{};
+
+            // Histograms
+            std::array<HistogramBuckets, Metrics::MAX_HISTOGRAMS> retired_histograms{};
+            std::array<HistogramBuckets, Metrics::MAX_HISTOGRAMS> previous_histograms{};
+            std::array<HistogramBuckets, Metrics::MAX_HISTOGRAMS> frame_histograms{};
+            std::array<HistogramBuckets, Metrics::MAX_HISTOGRAMS> interval_histograms{};
+            std::array<std::uint64_t, Metrics::MAX_HISTOGRAMS> histogram_totals{};
+
+            // Periodic dump
+            std::atomic<double> dump_interval{ 0.0 };
+            std::chrono::steady_clock::time_point last_dump = std::chrono::steady_clock::now();
+            std::uint64_t interval_frames = 0;
+        };
+
+        /**
+         * Never destroyed: threads may still exit (and retire their shard) during static destruction.
+         */
+        Registry& registry() noexcept {
+            static Registry* instance = new Registry();
+            return *instance;
+        }
+
+        /**
+         * Creates the calling thread's shard on first use; folds it into the retired totals on exit.
+         */
+        struct ShardHolder {
+            Shard* shard;
+
+            ShardHolder() : shard(new Shard()) {
+                Registry& reg = registry();
+                std::lock_guard<std::mutex> lock(reg.mutex);
+                reg.shards.push_back(shard);
+            }
+
+            ~ShardHolder() {
+                Registry& reg = registry();
+                std::lock_guard<std::mutex> lock(reg.mutex);
+
+                for (std::size_t i = 0; i < Metrics::MAX_COUNTERS; ++i) {
+                    reg.retired_counters[i] += shard->counters[i].load(std::memory_order_relaxed);
+                }
+                for (std::size_t h = 0; h < Metrics::MAX_HISTOGRAMS; ++h) {
+                    for (std::size_t b = 0; b < Metrics::HISTOGRAM_BUCKETS; ++b) {
+                        reg.retired_histograms[h][b] += shard->histograms[h][b].load(std::memory_order_relaxed);
+                    }
+                }
+
+                reg.shards.erase(std::remove(reg.shards.begin(), reg.shards.end(), shard), reg.shards.end());
+                delete shard;
+            }
+        };
+
+        Shard& localShard() noexcept {
+            thread_local ShardHolder holder;
+            return *holder.shard;
+        }
+
+        std::uint32_t registerName(std::vector<std::string>& names, std::string_view name, std::size_t capacity) noexcept {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                if (names[i] == name) {
+                    return static_cast<std::uint32_t>(i);
+                }
+            }
+            if (names.size() >= capacity) {
+                return INVALID_ID;  // Registry full: the handle records nothing
+            }
+            names.emplace_back(name);
+            return static_cast<std::uint32_t>(names.size() - 1);
+        }
+
+        //--------------------------------------------------------------------------
+        // Histogram helpers
+        //--------------------------------------------------------------------------
+        std::uint64_t bucketHigh(std::size_t bucket) noexcept {
+            if (bucket == 0) {
+                return 0;
+            }
+            if (bucket >= 64) {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+            return (std::uint64_t(1) << bucket) - 1;
+        }
+
+        std::uint64_t bucketPercentile(const HistogramBuckets& buckets, std::uint64_t count, double percentile) noexcept {
+            if (count == 0) {
+                return 0;
+            }
+            std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(percentile / 100.0 * static_cast<double>(count) + 0.5));
+            std::uint64_t seen = 0;
+            for (std::size_t b = 0; b < buckets.size(); ++b) {
+                seen += buckets[b];
+                if (seen >= rank) {
+                    return bucketHigh(b);
+                }
+            }
+            return bucketHigh(buckets.size() - 1);
+        }
+
+        std::uint64_t bucketMax(const HistogramBuckets& buckets) noexcept {
+            for (std::size_t b = buckets.size(); b-- > 0;) {
+                if (buckets[b] != 0) {
+                    return bucketHigh(b);
+                }
+            }
+            return 0;
+        }
+
+        std::uint64_t bucketCount(const HistogramBuckets& buckets) noexcept {
+            std::uint64_t count = 0;
+            for (std::uint64_t value : buckets) {
+                count += value;
+            }
+            return count;
+        }
+
+        /**
+         * Registry mutex must be held.
+         */
+        void dumpLocked(Registry& reg) noexcept {
+            double frames = static_cast<double>(std::max<std::uint64_t>(reg.interval_frames, 1));
+
+            for (std::size_t i = 0; i < reg.counter_names.size(); ++i) {
+                GEM_LOG_INFO(Logger::Channel::Core, "[Metrics] {}: {} per frame (total {})",
+                    reg.counter_names[i], static_cast<double>(reg.interval_sums[i]) / frames, reg.totals[i].load(std::memory_order_relaxed));
+                reg.interval_sums[i] = 0;
+            }
+
+            for (std::size_t i = 0; i < reg.gauge_names.size(); ++i) {
+                GEM_LOG_INFO(Logger::Channel::Core, "[Metrics] {}: {}", reg.gauge_names[i], reg.gauges[i].load(std::memory_order_relaxed));
+            }
+
+            for (std::size_t i = 0; i < reg.histogram_names.size(); ++i) {
+                HistogramBuckets& buckets = reg.interval_histograms[i];
+                std::uint64_t count = bucketCount(buckets);
+                GEM_LOG_INFO(Logger::Channel::Core, "[Metrics] {}: {} per frame, p50 <= {}, p99 <= {}, max <= {}",
+                    reg.histogram_names[i], static_cast<double>(count) / frames,
+                    bucketPercentile(buckets, count, 50.0), bucketPercentile(buckets, count, 99.0), bucketMax(buckets));
+                buckets.fill(0);
+            }
+
+            reg.interval_frames = 0;
+            reg.last_dump = std::chrono::steady_clock::now();
+        }
+
+    } // namespace
+
+    //--------------------------------------------------------------------------
+    // Handles
+    //--------------------------------------------------------------------------
+    Metrics::Counter::Counter(std::string_view name) noexcept
+        : id_(registerName(registry().counter_names, name, MAX_COUNTERS))
+    {
+    }
+
+    void Metrics::Counter::add(std::uint64_t amount) noexcept {
+        if (id_ != INVALID_ID) {
+            bump(localShard().counters[id_], amount);
+        }
+    }
+
+    std::uint64_t Metrics::Counter::getFrameValue() const noexcept {
+        return id_ != INVALID_ID ? registry().frame_values[id_].load(std::memory_order_relaxed) : 0;
+    }
+
+    std::uint64_t Metrics::Counter::getTotal() const noexcept {
+        return id_ != INVALID_ID ? registry().totals[id_].load(std::memory_order_relaxed) : 0;
+    }
+
+    Metrics::Gauge::Gauge(std::string_view name) noexcept
+        : id_(registerName(registry().gauge_names, name, MAX_GAUGES))
+    {
+    }
+
+    void Metrics::Gauge::set(std::int64_t value) noexcept {
+        if (id_ != INVALID_ID) {
+            registry().gauges[id_].store(value, std::memory_order_relaxed);
+        }
+    }
+
+    void Metrics::Gauge::add(std::int64_t delta) noexcept {
+        if (id_ != INVALID_ID) {
+            registry().gauges[id_].fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    std::int64_t Metrics::Gauge::get() const noexcept {
+        return id_ != INVALID_ID ? registry().gauges[id_].load(std::memory_order_relaxed) : 0;
+    }
+
+    Metrics::Histogram::Histogram(std::string_view name) noexcept
+        : id_(registerName(registry().histogram_names, name, MAX_HISTOGRAMS))
+    {
+    }
+
+    void Metrics::Histogram::record(std::uint64_t value) noexcept {
+        if (id_ != INVALID_ID) {
+            bump(localShard().histograms[id_][std::bit_width(value)], 1);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Frame merge
+    //--------------------------------------------------------------------------
+    void Metrics::newFrame() noexcept {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+
+        for (std::size_t i = 0; i < reg.counter_names.size(); ++i) {
+            std::uint64_t total = reg.retired_counters[i];
+            for (const Shard* shard : reg.shards) {
+                total += shard->counters[i].load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t frame_value = total - reg.previous_totals[i];
+            reg.previous_totals[i] = total;
+            reg.interval_sums[i] += frame_value;
+            reg.frame_values[i].store(frame_value, std::memory_order_relaxed);
+            reg.totals[i].store(total, std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < reg.histogram_names.size(); ++i) {
+            std::uint64_t total = 0;
+            for (std::size_t b = 0; b < HISTOGRAM_BUCKETS; ++b) {
+                std::uint64_t bucket = reg.retired_histograms[i][b];
+                for (const Shard* shard : reg.shards) {
+                    bucket += shard->histograms[i][b].load(std::memory_order_relaxed);
+                }
+
+                std::uint64_t frame_value = bucket - reg.previous_histograms[i][b];
+                reg.previous_histograms[i][b] = bucket;
+                reg.frame_histograms[i][b] = frame_value;
+                reg.interval_histograms[i][b] += frame_value;
+                total += bucket;
+            }
+            reg.histogram_totals[i] = total;
+        }
+
+        reg.interval_frames++;
+
+        double interval = reg.dump_interval.load(std::memory_order_relaxed);
+        if (interval > 0.0 && std::chrono::duration<double>(std::chrono::steady_clock::now() - reg.last_dump).count() >= interval) {
+            dumpLocked(reg);
+        }
+    }
+
+    std::vector<Metrics::Sample> Metrics::snapshot() {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+
+        std::vector<Sample> samples;
+        samples.reserve(reg.counter_names.size() + reg.gauge_names.size() + reg.histogram_names.size());
+
+        for (std::size_t i = 0; i < reg.counter_names.size(); ++i) {
+            Sample& sample = samples.emplace_back();
+            sample.name = reg.counter_names[i];
+            sample.kind = Kind::Counter;
+            sample.frame_value = reg.frame_values[i].load(std::memory_order_relaxed);
+            sample.total = reg.totals[i].load(std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < reg.gauge_names.size(); ++i) {
+            Sample& sample = samples.emplace_back();
+            sample.name = reg.gauge_names[i];
+            sample.kind = Kind::Gauge;
+            sample.gauge = reg.gauges[i].load(std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < reg.histogram_names.size(); ++i) {
+            const HistogramBuckets& buckets = reg.frame_histograms[i];
+            Sample& sample = samples.emplace_back();
+            sample.name = reg.histogram_names[i];
+            sample.kind = Kind::Histogram;
+            sample.frame_value = bucketCount(buckets);
+            sample.total = reg.histogram_totals[i];
+            sample.p50 = bucketPercentile(buckets, sample.frame_value, 50.0);
+            sample.p99 = bucketPercentile(buckets, sample.frame_value, 99.0);
+            sample.max = bucketMax(buckets);
+        }
+
+        return samples;
+    }
+
+    void Metrics::setDumpInterval(double interval_seconds) noexcept {
+        registry().dump_interval.store(std::max(interval_seconds, 0.0), std::memory_order_relaxed);
+    }
+
+    void Metrics::dump() noexcept {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        dumpLocked(reg);
+    }
+
+} // namespace Gem
@@ -0,0 +1,771 @@
+#include <NullBackend.h>
+#include <Gem/Core/Logger.h>
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Gem {
+
+    namespace {
+
+        //|========================================================= Objects =========================================================================================
+
+        /**
+         * GL name spaces. Shaders and programs share one, as in GL.
+         */
+        enum class Kind : std::uint8_t { Buffer, Texture, VertexArray, Framebuffer, Renderbuffer, Query, ShaderProgram, Count };
+
+        // What a name refers to
+        constexpr std::uint8_t DEAD = 0;
+        constexpr std::uint8_t ALIVE = 1;
+        constexpr std::uint8_t SHADER = 2;
+        constexpr std::uint8_t PROGRAM = 3;
+
+        /**
+         * Names of one kind, indexed by name. Names are handed out in order and never reused, so
+         * a stale name is caught instead of aliasing a newer object. Name 0 is never generated.
+         */
+        struct Names {
+            std::vector<std::uint8_t> objects{ DEAD };
+            std::size_t live = 0;
+        };
+
+        /**
+         * Data store of a buffer. Only mapped buffers get memory, allocated at the first map.
+         */
+        struct Storage {
+            GLsizeiptr size = 0;
+            std::unique_ptr<std::byte[]> memory;
+        };
+
+        struct Program {
+            std::unordered_map<std::string, GLint> uniforms;
+            std::unordered_map<std::string, GLuint> blocks;
+        };
+
+        std::mutex mutex_;                      ///< Guards everything below.
+        Names names_[static_cast<int>(Kind::Count)];
+        std::unordered_map<GLuint, GLenum> shader_types_;
+        std::unordered_map<GLuint, Program> programs_;
+        std::unordered_map<GLuint, Storage> buffer_storage_;
+        std::unordered_set<std::uintptr_t> syncs_;
+        std::uintptr_t next_sync_ = 1;
+        std::unordered_map<GLFWwindow*, std::unique_ptr<NullBackend::Window>> windows_;
+        std::uint32_t frame_limit_ = 0;
+
+        thread_local GLenum error_ = GL_NO_ERROR;  ///< One context per thread, one error flag per context
+        thread_local GLFWwindow* current_window_ = nullptr;
+        thread_local std::unordered_map<GLenum, GLuint> bound_buffers_;    ///< Generic binding points, for map_buffer_range
+
+        void setError(GLenum error) noexcept {
+            if (error_ == GL_NO_ERROR) {
+                error_ = error;     // GL keeps the first error until glGetError
+            }
+        }
+
+        Names& names(Kind kind) noexcept {
+            return names_[static_cast<int>(kind)];
+        }
+
+        GLuint create(Kind kind, std::uint8_t object) {
+            Names& table = names(kind);
+            table.objects.push_back(object);
+            table.live++;
+            return static_cast<GLuint>(table.objects.size() - 1);
+        }
+
+        std::uint8_t objectOf(Kind kind, GLuint name) noexcept {
+            const Names& table = names(kind);
+            return name < table.objects.size() ? table.objects[name] : DEAD;
+        }
+
+        void destroy(Kind kind, GLuint name) noexcept {
+            Names& table = names(kind);
+            table.objects[name] = DEAD;
+            table.live--;
+        }
+
+        void genNames(Kind kind, GLsizei n, GLuint* out) {
+            if (n < 0) {
+                setError(GL_INVALID_VALUE);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (GLsizei i = 0; i < n; ++i) {
+                out[i] = create(kind, ALIVE);
+            }
+        }
+
+        void deleteNames(Kind kind, GLsizei n, const GLuint* in) {
+            if (n < 0) {
+                setError(GL_INVALID_VALUE);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (GLsizei i = 0; i < n; ++i) {
+                if (objectOf(kind, in[i]) != DEAD) {
+                    destroy(kind, in[i]);       // Unknown names and 0 are silently ignored
+                    if (kind == Kind::Buffer) {
+                        buffer_storage_.erase(in[i]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Binding a name that was never generated, or was deleted, is GL_INVALID_OPERATION.
+         */
+        void checkBind(Kind kind, GLuint name) {
+            if (name == 0) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (objectOf(kind, name) == DEAD) {
+                setError(GL_INVALID_OPERATION);
+            }
+        }
+
+        /**
+         * Shader and program arguments: GL_INVALID_VALUE if not a name, GL_INVALID_OPERATION if the
+         * other kind. Called with the mutex held.
+         */
+        bool isObject(GLuint name, std::uint8_t expected) noexcept {
+            std::uint8_t object = objectOf(Kind::ShaderProgram, name);
+            if (object != expected) {
+                setError(object == DEAD ? GL_INVALID_VALUE : GL_INVALID_OPERATION);
+                return false;
+            }
+            return true;
+        }
+
+        bool checkObject(GLuint name, std::uint8_t expected) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return isObject(name, expected);
+        }
+
+        //|========================================================= GL entry points =========================================================================================
+
+        /**
+         * Entry points with nothing to emulate: accept the arguments, return a zero value.
+         */
+        template <typename Proc>
+        struct Discard;
+
+        template <typename Result, typename... Args>
+        struct Discard<Result (APIENTRYP)(Args...)> {
+            static Result APIENTRY call(Args...) {
+                return Result();
+            }
+        };
+
+        void APIENTRY genBuffers(GLsizei n, GLuint* buffers)                { genNames(Kind::Buffer, n, buffers); }
+        void APIENTRY genTextures(GLsizei n, GLuint* textures)              { genNames(Kind::Texture, n, textures); }
+        void APIENTRY genVertexArrays(GLsizei n, GLuint* arrays)            { genNames(Kind::VertexArray, n, arrays); }
+        void APIENTRY genFramebuffers(GLsizei n, GLuint* framebuffers)      { genNames(Kind::Framebuffer, n, framebuffers); }
+        void APIENTRY genRenderbuffers(GLsizei n, GLuint* renderbuffers)    { genNames(Kind::Renderbuffer, n, renderbuffers); }
+        void APIENTRY genQueries(GLsizei n, GLuint* ids)                    { genNames(Kind::Query, n, ids); }
+        void APIENTRY createBuffers(GLsizei n, GLuint* buffers)             { genNames(Kind::Buffer, n, buffers); }
+        void APIENTRY createVertexArrays(GLsizei n, GLuint* arrays)         { genNames(Kind::VertexArray, n, arrays); }
+        void APIENTRY createTextures(GLenum, GLsizei n, GLuint* textures)   { genNames(Kind::Texture, n, textures); }
+
+        void APIENTRY deleteBuffers(GLsizei n, const GLuint* buffers)               { deleteNames(Kind::Buffer, n, buffers); }
+        void APIENTRY deleteTextures(GLsizei n, const GLuint* textures)             { deleteNames(Kind::Texture, n, textures); }
+        void APIENTRY deleteVertexArrays(GLsizei n, const GLuint* arrays)           { deleteNames(Kind::VertexArray, n, arrays); }
+        void APIENTRY deleteFramebuffers(GLsizei n, const GLuint* framebuffers)     { deleteNames(Kind::Framebuffer, n, framebuffers); }
+        void APIENTRY deleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)   { deleteNames(Kind::Renderbuffer, n, renderbuffers); }
+        void APIENTRY deleteQueries(GLsizei n, const GLuint* ids)                   { deleteNames(Kind::Query, n, ids); }
+
+        void APIENTRY bindBuffer(GLenum target, GLuint buffer)                                          { checkBind(Kind::Buffer, buffer); bound_buffers_[target] = buffer; }
+        void APIENTRY bindBufferBase(GLenum target, GLuint, GLuint buffer)                              { checkBind(Kind::Buffer, buffer); bound_buffers_[target] = buffer; }
+        void APIENTRY bindBufferRange(GLenum target, GLuint, GLuint buffer, GLintptr, GLsizeiptr)       { checkBind(Kind::Buffer, buffer); bound_buffers_[target] = buffer; }
+        void APIENTRY bindTexture(GLenum, GLuint texture)                                       { checkBind(Kind::Texture, texture); }
+        void APIENTRY bindTextureUnit(GLuint, GLuint texture)                                   { checkBind(Kind::Texture, texture); }
+        void APIENTRY bindVertexArray(GLuint array)                                             { checkBind(Kind::VertexArray, array); }
+        void APIENTRY bindFramebuffer(GLenum, GLuint framebuffer)                               { checkBind(Kind::Framebuffer, framebuffer); }
+        void APIENTRY bindRenderbuffer(GLenum, GLuint renderbuffer)                             { checkBind(Kind::Renderbuffer, renderbuffer); }
+        void APIENTRY framebufferRenderbuffer(GLenum, GLenum, GLenum, GLuint renderbuffer)      { checkBind(Kind::Renderbuffer, renderbuffer); }
+        void APIENTRY beginQuery(GLenum, GLuint id)                                             { checkBind(Kind::Query, id); }
+        void APIENTRY queryCounter(GLuint id, GLenum)                                           { checkBind(Kind::Query, id); }
+
+        // Buffer data stores
+
+        /**
+         * Store of the buffer bound to @p target, or nullptr (GL_INVALID_OPERATION) if none is.
+         * Called with the mutex held.
+         */
+        Storage* boundStorage(GLenum target) {
+            auto bound = bound_buffers_.find(target);
+            if (bound == bound_buffers_.end() || bound->second == 0 || objectOf(Kind::Buffer, bound->second) == DEAD) {
+                setError(GL_INVALID_OPERATION);
+                return nullptr;
+            }
+            return &buffer_storage_[bound->second];
+        }
+
+        void APIENTRY bufferData(GLenum target, GLsizeiptr size, const void*, GLenum) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (Storage* storage = boundStorage(target)) {
+                storage->size = size;
+                storage->memory.reset();    // A new store: the contents are not kept
+            }
+        }
+
+        void APIENTRY bufferStorage(GLenum target, GLsizeiptr size, const void*, GLbitfield) {
+            bufferData(target, size, nullptr, 0);
+        }
+
+        void APIENTRY namedBufferData(GLuint buffer, GLsizeiptr size, const void*, GLenum) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (objectOf(Kind::Buffer, buffer) == DEAD) {
+                setError(GL_INVALID_OPERATION);
+                return;
+            }
+            Storage& storage = buffer_storage_[buffer];
+            storage.size = size;
+            storage.memory.reset();
+        }
+
+        void APIENTRY namedBufferStorage(GLuint buffer, GLsizeiptr size, const void*, GLbitfield) {
+            namedBufferData(buffer, size, nullptr, 0);
+        }
+
+        void* APIENTRY mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            Storage* storage = boundStorage(target);
+            if (!storage) {
+                return nullptr;
+            }
+            if (offset < 0 || length <= 0 || offset + length > storage->size) {
+                setError(GL_INVALID_VALUE);
+                return nullptr;
+            }
+
+            if (!storage->memory) {
+                storage->memory = std::make_unique<std::byte[]>(static_cast<std::size_t>(storage->size));
+            }
+            return storage->memory.get() + offset;
+        }
+
+        GLboolean APIENTRY unmapBuffer(GLenum) {
+            return GL_TRUE;     // The memory stays until the store is replaced or deleted
+        }
+
+        GLenum APIENTRY checkFramebufferStatus(GLenum) {
+            return GL_FRAMEBUFFER_COMPLETE;
+        }
+
+        void APIENTRY getQueryObjectiv(GLuint, GLenum pname, GLint* params) {
+            *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;     // No GPU work: nothing took any time
+        }
+
+        void APIENTRY getQueryObjectui64v(GLuint, GLenum pname, GLuint64* params) {
+            *params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+        }
+
+        // Shaders and programs
+
+        GLuint APIENTRY createShader(GLenum type) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            GLuint shader = create(Kind::ShaderProgram, SHADER);
+            shader_types_[shader] = type;
+            return shader;
+        }
+
+        GLuint APIENTRY createProgram() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            GLuint program = create(Kind::ShaderProgram, PROGRAM);
+            programs_[program];
+            return program;
+        }
+
+        void APIENTRY shaderSource(GLuint shader, GLsizei, const GLchar* const*, const GLint*)  { checkObject(shader, SHADER); }
+        void APIENTRY compileShader(GLuint shader)                                              { checkObject(shader, SHADER); }
+        void APIENTRY linkProgram(GLuint program)                                               { checkObject(program, PROGRAM); }
+        void APIENTRY validateProgram(GLuint program)                                           { checkObject(program, PROGRAM); }
+
+        void APIENTRY attachShader(GLuint program, GLuint shader) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (isObject(program, PROGRAM)) {
+                isObject(shader, SHADER);
+            }
+        }
+
+        void APIENTRY useProgram(GLuint program) {
+            if (program != 0) {
+                checkObject(program, PROGRAM);
+            }
+        }
+
+        void APIENTRY deleteShader(GLuint shader) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (shader != 0 && isObject(shader, SHADER)) {
+                destroy(Kind::ShaderProgram, shader);
+                shader_types_.erase(shader);
+            }
+        }
+
+        void APIENTRY deleteProgram(GLuint program) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (program != 0 && isObject(program, PROGRAM)) {
+                destroy(Kind::ShaderProgram, program);
+                programs_.erase(program);
+            }
+        }
+
+        void APIENTRY getShaderiv(GLuint shader, GLenum pname, GLint* params) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!isObject(shader, SHADER)) {
+                return;
+            }
+
+            switch (pname) {
+                case GL_SHADER_TYPE:        *params = static_cast<GLint>(shader_types_[shader]); break;
+                case GL_COMPILE_STATUS:     *params = GL_TRUE; break;
+                default:                    *params = 0; break;     // GL_DELETE_STATUS, GL_INFO_LOG_LENGTH, GL_SHADER_SOURCE_LENGTH
+            }
+        }
+
+        void APIENTRY getProgramiv(GLuint program, GLenum pname, GLint* params) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!isObject(program, PROGRAM)) {
+                return;
+            }
+
+            switch (pname) {
+                case GL_LINK_STATUS:
+                case GL_VALIDATE_STATUS:    *params = GL_TRUE; break;
+                default:                    *params = 0; break;
+            }
+        }
+
+        void APIENTRY getInfoLog(GLuint, GLsizei size, GLsizei* length, GLchar* log) {
+            if (length) {
+                *length = 0;
+            }
+            if (log && size > 0) {
+                log[0] = '\0';
+            }
+        }
+
+        /**
+         * Every name is an active uniform; a name keeps its location for the program's lifetime.
+         */
+        GLint APIENTRY getUniformLocation(GLuint program, const GLchar* name) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!isObject(program, PROGRAM)) {
+                return -1;
+            }
+
+            auto& uniforms = programs_[program].uniforms;
+            return uniforms.try_emplace(name, static_cast<GLint>(uniforms.size())).first->second;
+        }
+
+        GLuint APIENTRY getUniformBlockIndex(GLuint program, const GLchar* name) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!isObject(program, PROGRAM)) {
+                return GL_INVALID_INDEX;
+            }
+
+            auto& blocks = programs_[program].blocks;
+            return blocks.try_emplace(name, static_cast<GLuint>(blocks.size())).first->second;
+        }
+
+        // Sync objects: the GPU never has anything left to do
+
+        GLsync APIENTRY fenceSync(GLenum, GLbitfield) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            std::uintptr_t sync = next_sync_++;
+            syncs_.insert(sync);
+            return reinterpret_cast<GLsync>(sync);
+        }
+
+        GLenum APIENTRY clientWaitSync(GLsync sync, GLbitfield, GLuint64) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!syncs_.contains(reinterpret_cast<std::uintptr_t>(sync))) {
+                setError(GL_INVALID_VALUE);
+                return GL_WAIT_FAILED;
+            }
+            return GL_ALREADY_SIGNALED;
+        }
+
+        void APIENTRY deleteSync(GLsync sync) {
+            if (!sync) {
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (syncs_.erase(reinterpret_cast<std::uintptr_t>(sync)) == 0) {
+                setError(GL_INVALID_VALUE);
+            }
+        }
+
+        // Queries of the context itself
+
+        GLenum APIENTRY getError() {
+            return std::exchange(error_, static_cast<GLenum>(GL_NO_ERROR));
+        }
+
+        const GLubyte* APIENTRY getString(GLenum name) {
+            const char* value = nullptr;
+            switch (name) {
+                case GL_VENDOR:                     value = "GemEngine"; break;
+                case GL_RENDERER:                   value = "Null backend"; break;
+                case GL_VERSION:                    value = "4.6.0 GemEngine null backend"; break;
+                case GL_SHADING_LANGUAGE_VERSION:   value = "4.60"; break;
+                default:                            setError(GL_INVALID_ENUM); break;
+            }
+            return reinterpret_cast<const GLubyte*>(value);
+        }
+
+        const GLubyte* APIENTRY getStringi(GLenum, GLuint) {
+            setError(GL_INVALID_VALUE);     // No extensions: every index is out of range
+            return nullptr;
+        }
+
+        /**
+         * Limits of a typical desktop GL 4.6 driver, for code that sizes itself from them.
+         */
+        GLint64 integerValue(GLenum pname) noexcept {
+            switch (pname) {
+                case GL_MAJOR_VERSION:                          return 4;
+                case GL_MINOR_VERSION:                          return 6;
+                case GL_NUM_EXTENSIONS:                         return 0;
+                case GL_CONTEXT_PROFILE_MASK:                   return GL_CONTEXT_CORE_PROFILE_BIT;
+                case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:        return 256;
+                case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT: return 16;
+                case GL_MAX_UNIFORM_BLOCK_SIZE:                 return 65536;
+                case GL_MAX_UNIFORM_BUFFER_BINDINGS:            return 84;
+                case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS:     return 16;
+                case GL_MAX_TEXTURE_SIZE:                       return 16384;
+                case GL_MAX_3D_TEXTURE_SIZE:                    return 2048;
+                case GL_MAX_ARRAY_TEXTURE_LAYERS:               return 2048;
+                case GL_MAX_RENDERBUFFER_SIZE:                  return 16384;
+                case GL_MAX_TEXTURE_IMAGE_UNITS:                return 32;
+                case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:       return 192;
+                case GL_MAX_VERTEX_ATTRIBS:                     return 16;
+                case GL_MAX_DRAW_BUFFERS:                       return 8;
+                case GL_MAX_COLOR_ATTACHMENTS:                  return 8;
+                case GL_MAX_SAMPLES:                            return 8;
+                default:                                        return 0;   // Including GL_TIMESTAMP: no GPU clock
+            }
+        }
+
+        void APIENTRY getIntegerv(GLenum pname, GLint* data) {
+            *data = static_cast<GLint>(integerValue(pname));
+        }
+
+        void APIENTRY getInteger64v(GLenum pname, GLint64* data) {
+            *data = integerValue(pname);
+        }
+
+        /**
+         * Fills @p pixels with zeros (the default GL_PACK_ALIGNMENT of 4), so read-backs are defined.
+         */
+        void APIENTRY readPixels(GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels) {
+            std::size_t components = 4;
+            switch (format) {
+                case GL_RED: case GL_GREEN: case GL_BLUE: case GL_ALPHA:
+                case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:    components = 1; break;
+                case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:                  components = 2; break;
+                case GL_RGB: case GL_BGR: case GL_RGB_INTEGER:                          components = 3; break;
+                default:                                                                components = 4; break;
+            }
+
+            std::size_t component_size = 1;
+            switch (type) {
+                case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:              component_size = 2; break;
+                case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:                       component_size = 4; break;
+                case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_8_8_8_8:                component_size = 4; components = 1; break;
+                default:                                                                component_size = 1; break;
+            }
+
+            if (pixels && width > 0 && height > 0) {
+                std::size_t row = (static_cast<std::size_t>(width) * components * component_size + 3) & ~std::size_t{ 3 };
+                std::memset(pixels, 0, row * static_cast<std::size_t>(height));
+            }
+        }
+
+        //|========================================================= Proc table =========================================================================================
+
+        struct Entry {
+            const char* name;
+            void* address;
+        };
+
+        // decltype(glX) is GLAD's pointer type for glX: the static_cast checks each signature
+        #define GEM_NULL_GL(name, implementation) Entry{ #name, reinterpret_cast<void*>(static_cast<decltype(name)>(&implementation)) }
+        #define GEM_NULL_GL_DISCARD(name) Entry{ #name, reinterpret_cast<void*>(&Discard<decltype(name)>::call) }
+
+        const Entry PROC_TABLE[] = {
+            GEM_NULL_GL(glGenBuffers, genBuffers),
+            GEM_NULL_GL(glGenTextures, genTextures),
+            GEM_NULL_GL(glGenVertexArrays, genVertexArrays),
+            GEM_NULL_GL(glGenFramebuffers, genFramebuffers),
+            GEM_NULL_GL(glGenRenderbuffers, genRenderbuffers),
+            GEM_NULL_GL(glGenQueries, genQueries),
+            GEM_NULL_GL(glCreateBuffers, createBuffers),
+            GEM_NULL_GL(glCreateVertexArrays, createVertexArrays),
+            GEM_NULL_GL(glCreateTextures, createTextures),
+            GEM_NULL_GL(glDeleteBuffers, deleteBuffers),
+            GEM_NULL_GL(glDeleteTextures, deleteTextures),
+            GEM_NULL_GL(glDeleteVertexArrays, deleteVertexArrays),
+            GEM_NULL_GL(glDeleteFramebuffers, deleteFramebuffers),
+            GEM_NULL_GL(glDeleteRenderbuffers, deleteRenderbuffers),
+            GEM_NULL_GL(glDeleteQueries, deleteQueries),
+            GEM_NULL_GL(glBindBuffer, bindBuffer),
+            GEM_NULL_GL(glBindBufferBase, bindBufferBase),
+            GEM_NULL_GL(glBindBufferRange, bindBufferRange),
+            GEM_NULL_GL(glBindTexture, bindTexture),
+            GEM_NULL_GL(glBindTextureUnit, bindTextureUnit),
+            GEM_NULL_GL(glBindVertexArray, bindVertexArray),
+            GEM_NULL_GL(glBindFramebuffer, bindFramebuffer),
+            GEM_NULL_GL(glBindRenderbuffer, bindRenderbuffer),
+            GEM_NULL_GL(glFramebufferRenderbuffer, framebufferRenderbuffer),
+            GEM_NULL_GL(glCheckFramebufferStatus, checkFramebufferStatus),
+            GEM_NULL_GL(glBeginQuery, beginQuery),
+            GEM_NULL_GL(glQueryCounter, queryCounter),
+            GEM_NULL_GL(glGetQueryObjectiv, getQueryObjectiv),
+            GEM_NULL_GL(glGetQueryObjectui64v, getQueryObjectui64v),
+            GEM_NULL_GL(glCreateShader, createShader),
+            GEM_NULL_GL(glCreateProgram, createProgram),
+            GEM_NULL_GL(glShaderSource, shaderSource),
+            GEM_NULL_GL(glCompileShader, compileShader),
+            GEM_NULL_GL(glAttachShader, attachShader),
+            GEM_NULL_GL(glLinkProgram, linkProgram),
+            GEM_NULL_GL(glValidateProgram, validateProgram),
+            GEM_NULL_GL(glUseProgram, useProgram),
+            GEM_NULL_GL(glDeleteShader, deleteShader),
+            GEM_NULL_GL(glDeleteProgram, deleteProgram),
+            GEM_NULL_GL(glGetShaderiv, getShaderiv),
+            GEM_NULL_GL(glGetProgramiv, getProgramiv),
+            GEM_NULL_GL(glGetShaderInfoLog, getInfoLog),
+            GEM_NULL_GL(glGetProgramInfoLog, getInfoLog),
+            GEM_NULL_GL(glGetUniformLocation, getUniformLocation),
+            GEM_NULL_GL(glGetUniformBlockIndex, getUniformBlockIndex),
+            GEM_NULL_GL(glFenceSync, fenceSync),
+            GEM_NULL_GL(glClientWaitSync, clientWaitSync),
+            GEM_NULL_GL(glDeleteSync, deleteSync),
+            GEM_NULL_GL(glGetError, getError),
+            GEM_NULL_GL(glGetString, getString),
+            GEM_NULL_GL(glGetStringi, getStringi),
+            GEM_NULL_GL(glGetIntegerv, getIntegerv),
+            GEM_NULL_GL(glGetInteger64v, getInteger64v),
+            GEM_NULL_GL(glReadPixels, readPixels),
+            GEM_NULL_GL(glBufferData, bufferData),
+            GEM_NULL_GL(glBufferStorage, bufferStorage),
+            GEM_NULL_GL(glMapBufferRange, mapBufferRange),
+            GEM_NULL_GL(glUnmapBuffer, unmapBuffer),
+            GEM_NULL_GL(glNamedBufferData, namedBufferData),
+            GEM_NULL_GL(glNamedBufferStorage, namedBufferStorage),
+
+            GEM_NULL_GL_DISCARD(glEndQuery),
+            GEM_NULL_GL_DISCARD(glActiveTexture),
+            GEM_NULL_GL_DISCARD(glTexParameteri),
+            GEM_NULL_GL_DISCARD(glGenerateMipmap),
+            GEM_NULL_GL_DISCARD(glTexImage1D),
+            GEM_NULL_GL_DISCARD(glTexImage2D),
+            GEM_NULL_GL_DISCARD(glTexImage3D),
+            GEM_NULL_GL_DISCARD(glTexSubImage2D),
+            GEM_NULL_GL_DISCARD(glTexSubImage3D),
+            GEM_NULL_GL_DISCARD(glTexStorage2D),
+            GEM_NULL_GL_DISCARD(glTexStorage3D),
+            GEM_NULL_GL_DISCARD(glBufferSubData),
+            GEM_NULL_GL_DISCARD(glVertexAttribPointer),
+            GEM_NULL_GL_DISCARD(glEnableVertexAttribArray),
+            GEM_NULL_GL_DISCARD(glNamedBufferSubData),
+            GEM_NULL_GL_DISCARD(glCopyBufferSubData),
+            GEM_NULL_GL_DISCARD(glCopyNamedBufferSubData),
+            GEM_NULL_GL_DISCARD(glVertexArrayVertexBuffer),
+            GEM_NULL_GL_DISCARD(glVertexArrayElementBuffer),
+            GEM_NULL_GL_DISCARD(glVertexArrayAttribFormat),
+            GEM_NULL_GL_DISCARD(glVertexArrayAttribBinding),
+            GEM_NULL_GL_DISCARD(glEnableVertexArrayAttrib),
+            GEM_NULL_GL_DISCARD(glTextureParameteri),
+            GEM_NULL_GL_DISCARD(glTextureStorage1D),
+            GEM_NULL_GL_DISCARD(glTextureStorage2D),
+            GEM_NULL_GL_DISCARD(glTextureStorage3D),
+            GEM_NULL_GL_DISCARD(glTextureSubImage1D),
+            GEM_NULL_GL_DISCARD(glTextureSubImage2D),
+            GEM_NULL_GL_DISCARD(glTextureSubImage3D),
+            GEM_NULL_GL_DISCARD(glGenerateTextureMipmap),
+            GEM_NULL_GL_DISCARD(glRenderbufferStorage),
+            GEM_NULL_GL_DISCARD(glClearColor),
+            GEM_NULL_GL_DISCARD(glClear),
+            GEM_NULL_GL_DISCARD(glViewport),
+            GEM_NULL_GL_DISCARD(glEnable),
+            GEM_NULL_GL_DISCARD(glDisable),
+            GEM_NULL_GL_DISCARD(glCullFace),
+            GEM_NULL_GL_DISCARD(glFrontFace),
+            GEM_NULL_GL_DISCARD(glBlendFunc),
+            GEM_NULL_GL_DISCARD(glDrawElements),
+            GEM_NULL_GL_DISCARD(glDrawElementsBaseVertex),
+            GEM_NULL_GL_DISCARD(glFlush),
+            GEM_NULL_GL_DISCARD(glFinish),
+            GEM_NULL_GL_DISCARD(glUniformBlockBinding),
+            GEM_NULL_GL_DISCARD(glUniform1i),
+            GEM_NULL_GL_DISCARD(glUniform2i),
+            GEM_NULL_GL_DISCARD(glUniform3i),
+            GEM_NULL_GL_DISCARD(glUniform4i),
+            GEM_NULL_GL_DISCARD(glUniform1ui),
+            GEM_NULL_GL_DISCARD(glUniform2ui),
+            GEM_NULL_GL_DISCARD(glUniform3ui),
+            GEM_NULL_GL_DISCARD(glUniform4ui),
+            GEM_NULL_GL_DISCARD(glUniform1f),
+            GEM_NULL_GL_DISCARD(glUniform2f),
+            GEM_NULL_GL_DISCARD(glUniform3f),
+            GEM_NULL_GL_DISCARD(glUniform4f),
+            GEM_NULL_GL_DISCARD(glUniform1iv),
+            GEM_NULL_GL_DISCARD(glUniform2iv),
+            GEM_NULL_GL_DISCARD(glUniform3iv),
+            GEM_NULL_GL_DISCARD(glUniform4iv),
+            GEM_NULL_GL_DISCARD(glUniform1uiv),
+            GEM_NULL_GL_DISCARD(glUniform2uiv),
+            GEM_NULL_GL_DISCARD(glUniform3uiv),
+            GEM_NULL_GL_DISCARD(glUniform4uiv),
+            GEM_NULL_GL_DISCARD(glUniform1fv),
+            GEM_NULL_GL_DISCARD(glUniform2fv),
+            GEM_NULL_GL_DISCARD(glUniform3fv),
+            GEM_NULL_GL_DISCARD(glUniform4fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix2fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix3fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix4fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix2x3fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix3x2fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix2x4fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix4x2fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix3x4fv),
+            GEM_NULL_GL_DISCARD(glUniformMatrix4x3fv),
+        };
+
+        #undef GEM_NULL_GL
+        #undef GEM_NULL_GL_DISCARD
+
+        GLFWwindow* handleOf(NullBackend::Window* window) noexcept {
+            return reinterpret_cast<GLFWwindow*>(window);
+        }
+
+    } // namespace
+
+    std::atomic<bool> NullBackend::enabled_{ false };
+
+    void NullBackend::enable(std::uint32_t frame_limit) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            frame_limit_ = frame_limit;
+        }
+        enabled_.store(true, std::memory_order_release);
+
+        if (frame_limit != 0) {
+            GEM_LOG_INFO(Logger::Channel::Core, "NullBackend: enabled, windows close after {} frames.", frame_limit);
+        }
+        else {
+            GEM_LOG_INFO(Logger::Channel::Core, "NullBackend: enabled.");
+        }
+    }
+
+    void* NullBackend::getProcAddress(const char* name) {
+        for (const Entry& entry : PROC_TABLE) {
+            if (std::strcmp(entry.name, name) == 0) {
+                return entry.address;
+            }
+        }
+        return nullptr;
+    }
+
+    std::size_t NullBackend::getLiveObjectCount() {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        std::size_t count = syncs_.size();
+        for (const Names& table : names_) {
+            count += table.live;
+        }
+        return count;
+    }
+
+    //|========================================================= Windows =========================================================================================
+
+    GLFWwindow* NullBackend::createWindow(int width, int height, const char* title) {
+        auto window = std::make_unique<Window>();
+        window->title = title ? title : "";
+        window->width = width;
+        window->height = height;
+
+        GLFWwindow* handle = handleOf(window.get());
+        std::lock_guard<std::mutex> lock(mutex_);
+        windows_.emplace(handle, std::move(window));
+        return handle;
+    }
+
+    void NullBackend::destroyWindow(GLFWwindow* window) {
+        if (current_window_ == window) {
+            current_window_ = nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        windows_.erase(window);
+    }
+
+    NullBackend::Window* NullBackend::getWindow(GLFWwindow* window) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = windows_.find(window);
+        return it != windows_.end() ? it->second.get() : nullptr;
+    }
+
+    void NullBackend::makeContextCurrent(GLFWwindow* window) noexcept {
+        current_window_ = window;
+    }
+
+    GLFWwindow* NullBackend::getCurrentContext() noexcept {
+        return current_window_;
+    }
+
+    void NullBackend::swapBuffers(GLFWwindow* window) {
+        if (Window* state = getWindow(window)) {
+            state->frames++;
+        }
+    }
+
+    void NullBackend::pollEvents() {
+        std::vector<std::pair<GLFWwindow*, Window*>> resized;
+        std::vector<std::pair<GLFWwindow*, Window*>> closed;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& [handle, window] : windows_) {
+                if (window->resized) {
+                    window->resized = false;
+                    resized.emplace_back(handle, window.get());
+                }
+                if (frame_limit_ != 0 && window->frames >= frame_limit_ && !window->should_close) {
+                    window->should_close = GLFW_TRUE;     // As if the user had closed it
+                    closed.emplace_back(handle, window.get());
+                }
+            }
+        }
+
+        // Outside the lock: callbacks call the Gem::GLFW wrappers
+        for (auto& [handle, window] : resized) {
+            if (window->window_size_callback) {
+                window->window_size_callback(handle, window->width, window->height);
+            }
+            if (window->framebuffer_size_callback) {
+                window->framebuffer_size_callback(handle, window->width, window->height);
+            }
+        }
+        for (auto& [handle, window] : closed) {
+            if (window->window_close_callback) {
+                window->window_close_callback(handle);
+            }
+        }
+    }
+
+} // namespace Gem
@@ -0,0 +1,467 @@
+#include <Gem/Core/Profiler.h>
+#include <Gem/Core/Logger.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Gem {
+
+    namespace {
+
+        //--------------------------------------------------------------------------
+        // Per-thread buffers
+        //--------------------------------------------------------------------------
+        struct ZoneEvent {
+            const Profiler::ZoneDesc* zone;
+            std::int64_t start_ns;
+            std::int64_t end_ns;
+            std::uint32_t depth;
+        };
+
+        /**
+         * Tiny spinlock: only contended for the instant the frame collector swaps buffers.
+         */
+        class SpinLock {
+        public:
+            void lock() noexcept {
+                while (flag_.test_and_set(std::memory_order_acquire)) {
+                    while (flag_.test(std::memory_order_relaxed)) {}
+                }
+            }
+            void unlock() noexcept {
+                flag_.clear(std::memory_order_release);
+            }
+
+        private:
+            std::atomic_flag flag_;
+        };
+
+        struct ThreadBuffer {
+            std::uint32_t index = 0;
+            std::string name;
+            std::uint32_t depth = 0;            ///< Owner thread only.
+            SpinLock lock;
+            std::vector<ZoneEvent> events;      ///< Completed zones of the current frame.
+            std::atomic<bool> alive{ true };
+        };
+
+        const std::chrono::steady_clock::time_point start_time_ = std::chrono::steady_clock::now();
+
+        std::int64_t nowNanoseconds() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count();
+        }
+
+        std::int64_t toProfilerNanoseconds(std::chrono::steady_clock::time_point time) noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time - start_time_).count();
+        }
+
+        std::atomic<bool> enabled_{ true };
+
+        std::mutex registry_mutex_;                               ///< Guards every variable below.
+        std::vector<std::shared_ptr<ThreadBuffer>> threads_;
+        std::vector<std::shared_ptr<ThreadBuffer>> external_tracks_;  ///< Also listed in threads_.
+        std::uint32_t next_thread_index_ = 0;
+
+        std::uint64_t frame_index_ = 0;
+        std::int64_t frame_start_ns_ = 0;
+        Profiler::FrameProfile last_frame_;
+        std::vector<ZoneEvent> frame_events_;                     ///< Scratch, reused each frame.
+
+        struct CapturedFrame {
+            std::int64_t start_ns;
+            std::int64_t end_ns;
+            std::vector<std::pair<std::uint32_t, ZoneEvent>> events;   ///< (thread index, zone)
+        };
+        std::vector<CapturedFrame> captured_frames_;
+        std::size_t capture_frames_left_ = 0;
+
+        /**
+         * Registers the thread on first use and unregisters it (lazily) on exit.
+         */
+        struct ThreadHandle {
+            std::shared_ptr<ThreadBuffer> buffer;
+
+            ThreadHandle() {
+                buffer = std::make_shared<ThreadBuffer>();
+                buffer->events.reserve(1024);
+
+                std::lock_guard<std::mutex> lock(registry_mutex_);
+                buffer->index = next_thread_index_++;
+                threads_.push_back(buffer);
+            }
+
+            ~ThreadHandle() {
+                // Zones still pending are collected by the next frame, then the buffer is dropped
+                buffer->alive.store(false, std::memory_order_release);
+            }
+        };
+
+        ThreadBuffer& threadBuffer() {
+            thread_local ThreadHandle handle;
+            return *handle.buffer;
+        }
+
+        //--------------------------------------------------------------------------
+        // Frame tree
+        //--------------------------------------------------------------------------
+        /**
+         * Key of a merged node: the same zone under the same parent (which also fixes the depth).
+         */
+        struct NodeKey {
+            int parent;
+            const Profiler::ZoneDesc* zone;
+
+            bool operator==(const NodeKey& other) const noexcept {
+                return parent == other.parent && zone == other.zone;
+            }
+        };
+
+        struct NodeKeyHash {
+            std::size_t operator()(const NodeKey& key) const noexcept {
+                return std::hash<const void*>{}(key.zone) ^ (static_cast<std::size_t>(key.parent) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        /**
+         * Appends one thread's zones to @p nodes, merging repeated calls of a zone under
+         * the same parent. @p events must be sorted by start time. Linear in the number of events.
+         */
+        void buildThreadTree(std::vector<Profiler::Node>& nodes, std::uint32_t thread, const std::vector<ZoneEvent>& events) {
+            std::vector<int> stack;                 // open nodes, indexed by depth
+            std::size_t first = nodes.size();
+
+            // Per node of this thread (index - first): time spent in direct children, and its
+            // children in creation order as a linked list
+            std::vector<std::int64_t> child_ns;
+            std::vector<int> first_child;
+            std::vector<int> last_child;
+            std::vector<int> next_sibling;
+            int first_root = -1;
+            int last_root = -1;
+            std::unordered_map<NodeKey, int, NodeKeyHash> lookup;
+            lookup.reserve(events.size());
+
+            for (const ZoneEvent& event : events) {
+                // A zone whose parent ended in a previous frame is attached at the deepest open level
+                std::size_t depth = std::min<std::size_t>(event.depth, stack.size());
+                stack.resize(depth);
+                int parent = stack.empty() ? -1 : stack.back();
+
+                auto [found, created] = lookup.try_emplace(NodeKey{ parent, event.zone }, static_cast<int>(nodes.size()));
+                int node = found->second;
+                if (created) {
+                    Profiler::Node added;
+                    added.zone = event.zone;
+                    added.thread = thread;
+                    added.parent = parent;
+                    added.depth = static_cast<int>(depth);
+                    nodes.push_back(added);
+
+                    int local = node - static_cast<int>(first);
+                    child_ns.push_back(0);
+                    first_child.push_back(-1);
+                    last_child.push_back(-1);
+                    next_sibling.push_back(-1);
+
+                    int& tail = parent < 0 ? last_root : last_child[parent - first];
+                    if (tail < 0) {
+                        (parent < 0 ? first_root : first_child[parent - first]) = local;
+                    }
+                    else {
+                        next_sibling[tail] = local;
+                    }
+                    tail = local;
+                }
+
+                std::int64_t duration = event.end_ns - event.start_ns;
+                nodes[node].calls++;
+                nodes[node].total_ns += duration;
+                if (parent >= 0) {
+                    child_ns[parent - first] += duration;
+                }
+                stack.push_back(node);
+            }
+
+            for (std::size_t i = first; i < nodes.size(); ++i) {
+                nodes[i].self_ns = nodes[i].total_ns - child_ns[i - first];
+            }
+
+            // Merged calls can append a child after unrelated nodes: restore depth-first order
+            std::vector<Profiler::Node> ordered;
+            ordered.reserve(nodes.size() - first);
+
+            auto visit = [&](auto& self, int local, int parent) -> void {
+                for (; local >= 0; local = next_sibling[local]) {
+                    int index = static_cast<int>(first + ordered.size());
+                    ordered.push_back(nodes[first + local]);
+                    ordered.back().parent = parent;
+                    self(self, first_child[local], index);
+                }
+            };
+            visit(visit, first_root, -1);
+
+            std::copy(ordered.begin(), ordered.end(), nodes.begin() + static_cast<std::ptrdiff_t>(first));
+        }
+
+        void appendJsonString(std::string& out, const char* text) {
+            out += '"';
+            for (; *text; ++text) {
+                char c = *text;
+                if (c == '"' || c == '\\') {
+                    out += '\\';
+                    out += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20) {
+                    out += ' ';
+                }
+                else {
+                    out += c;
+                }
+            }
+            out += '"';
+        }
+
+    } // namespace
+
+    //------------------------------------------------------------------------------
+    // 1) Zones
+    //------------------------------------------------------------------------------
+    Profiler::Zone::Zone(const ZoneDesc& desc) noexcept
+        : desc_(&desc)
+        , start_ns_(-1)
+    {
+        if (enabled_.load(std::memory_order_relaxed)) {
+            threadBuffer().depth++;
+            start_ns_ = nowNanoseconds();
+        }
+    }
+
+    Profiler::Zone::~Zone() {
+        if (start_ns_ < 0) {
+            return;
+        }
+
+        std::int64_t end_ns = nowNanoseconds();
+        ThreadBuffer& buffer = threadBuffer();
+        buffer.depth--;
+
+        buffer.lock.lock();
+        try {
+            buffer.events.push_back({ desc_, start_ns_, end_ns, buffer.depth });
+        }
+        catch (...) {
+            // Out of memory: lose the sample rather than the frame
+        }
+        buffer.lock.unlock();
+    }
+
+    //------------------------------------------------------------------------------
+    // 2) Frames
+    //------------------------------------------------------------------------------
+    void Profiler::newFrame() noexcept {
+        std::int64_t now = nowNanoseconds();
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+
+        try {
+            FrameProfile frame;
+            frame.frame_index = frame_index_++;
+            frame.start_ns = frame_start_ns_;
+            frame.end_ns = now;
+            frame_start_ns_ = now;
+
+            CapturedFrame* captured = nullptr;
+            if (capture_frames_left_ > 0) {
+                --capture_frames_left_;
+                captured = &captured_frames_.emplace_back();
+                captured->start_ns = frame.start_ns;
+                captured->end_ns = frame.end_ns;
+            }
+
+            for (auto& thread : threads_) {
+                frame_events_.clear();
+                thread->lock.lock();
+                frame_events_.swap(thread->events);
+                thread->lock.unlock();
+
+                if (frame_events_.empty()) {
+                    continue;
+                }
+
+                // Zones are recorded when they end; parents come before children once sorted by start
+                std::sort(frame_events_.begin(), frame_events_.end(), [](const ZoneEvent& a, const ZoneEvent& b) {
+                    return a.start_ns != b.start_ns ? a.start_ns < b.start_ns : a.depth < b.depth;
+                });
+                buildThreadTree(frame.nodes, thread->index, frame_events_);
+
+                if (captured) {
+                    for (const ZoneEvent& event : frame_events_) {
+                        captured->events.emplace_back(thread->index, event);
+                    }
+                }
+            }
+
+            // Threads that exited have handed in their last zones
+            std::erase_if(threads_, [](const auto& thread) {
+                return !thread->alive.load(std::memory_order_acquire);
+            });
+
+            last_frame_ = std::move(frame);
+        }
+        catch (const std::exception& e) {
+            Logger::error("[Profiler] Failed to collect frame: {}", e.what());
+        }
+    }
+
+    Profiler::FrameProfile Profiler::getLastFrame() {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        return last_frame_;
+    }
+
+    void Profiler::logLastFrame() noexcept {
+        FrameProfile frame;
+        try {
+            frame = getLastFrame();
+        }
+        catch (...) {
+            return;
+        }
+
+        Logger::info("[Profiler] Frame #{} ~ {} ms", frame.frame_index, static_cast<double>(frame.end_ns - frame.start_ns) / 1e6);
+        for (const Node& node : frame.nodes) {
+            Logger::info("[Profiler] {}{} ~ total: {} ms, self: {} ms, calls: {} (thread {})",
+                std::string(static_cast<std::size_t>(node.depth) * 2, ' '), node.zone->name,
+                static_cast<double>(node.total_ns) / 1e6, static_cast<double>(node.self_ns) / 1e6, node.calls, node.thread);
+        }
+    }
+
+    void Profiler::recordExternalZone(const char* track, const ZoneDesc& desc, std::uint32_t depth,
+        std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) noexcept {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        try {
+            std::shared_ptr<ThreadBuffer> buffer;
+            for (const auto& existing : external_tracks_) {
+                if (existing->name == track) {
+                    buffer = existing;
+                    break;
+                }
+            }
+            if (!buffer) {
+                buffer = std::make_shared<ThreadBuffer>();
+                buffer->index = next_thread_index_++;
+                buffer->name = track;
+                external_tracks_.push_back(buffer);
+                threads_.push_back(buffer);
+            }
+
+            buffer->lock.lock();
+            try {
+                buffer->events.push_back({ &desc, toProfilerNanoseconds(start), toProfilerNanoseconds(end), depth });
+            }
+            catch (...) {
+            }
+            buffer->lock.unlock();
+        }
+        catch (...) {
+            // Out of memory: lose the sample
+        }
+    }
+
+    void Profiler::setThreadName(const std::string& name) noexcept {
+        ThreadBuffer& buffer = threadBuffer();
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        try {
+            buffer.name = name;
+        }
+        catch (...) {
+        }
+    }
+
+    void Profiler::setEnabled(bool enabled) noexcept {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool Profiler::isEnabled() noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    // 3) Capture / export
+    //------------------------------------------------------------------------------
+    void Profiler::startCapture(std::size_t max_frames) noexcept {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        captured_frames_.clear();
+        capture_frames_left_ = max_frames;
+    }
+
+    void Profiler::stopCapture() noexcept {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        capture_frames_left_ = 0;
+    }
+
+    bool Profiler::exportChromeTrace(const std::string& path) noexcept {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+
+        try {
+            std::string json;
+            json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+            auto append_event = [&json](const char* name, const char* category, std::uint32_t thread, std::int64_t start_ns, std::int64_t end_ns) {
+                json += "{\"name\":";
+                appendJsonString(json, name);
+                json += ",\"cat\":\"";
+                json += category;
+                json += "\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+                json += std::to_string(thread);
+                json += ",\"ts\":";
+                json += std::to_string(static_cast<double>(start_ns) / 1000.0);
+                json += ",\"dur\":";
+                json += std::to_string(static_cast<double>(end_ns - start_ns) / 1000.0);
+                json += "},\n";
+            };
+
+            for (const auto& thread : threads_) {
+                if (!thread->name.empty()) {
+                    json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+                    json += std::to_string(thread->index);
+                    json += ",\"args\":{\"name\":";
+                    appendJsonString(json, thread->name.c_str());
+                    json += "}},\n";
+                }
+            }
+
+            for (const CapturedFrame& frame : captured_frames_) {
+                append_event("Frame", "frame", 0, frame.start_ns, frame.end_ns);
+                for (const auto& [thread, event] : frame.events) {
+                    append_event(event.zone->name, "zone", thread, event.start_ns, event.end_ns);
+                }
+            }
+
+            // Chrome's parser rejects a trailing comma
+            if (json.size() >= 2 && json[json.size() - 2] == ',') {
+                json.erase(json.size() - 2, 1);
+            }
+            json += "]}\n";
+
+            std::ofstream file(path, std::ios::binary);
+            if (!file) {
+                Logger::error("[Profiler] Failed to open '{}' for the trace export", path);
+                return false;
+            }
+            file.write(json.data(), static_cast<std::streamsize>(json.size()));
+            return static_cast<bool>(file);
+        }
+        catch (const std::exception& e) {
+            Logger::error("[Profiler] Trace export failed: {}", e.what());
+            return false;
+        }
+    }
+
+} // namespace Gem
@@ -1,4 +1,5 @@
 #include <Gem/Core/ScopedTimer.h>
+#include <Gem/Core/FlightRecorder.h>
 
 namespace Gem {
 
@@ -27,6 +28,7 @@ namespace Gem {
     ScopedTimer::~ScopedTimer() {
         timer_.stop();
         double elapsed_ms = timer_.getElapsedTimeInMilliseconds();
+        FlightRecorder::recordTimer(name_, elapsed_ms);
 
         if (useCallback_ && callback_) {
             // Call custom callback
@@ -2,7 +2,8 @@
 
 namespace Gem {
 
-    Timer::Timer() noexcept
+    template <typename Policy, typename ClockSource>
+    BasicTimer<Policy, ClockSource>::BasicTimer() noexcept
         : start_time_(ClockType::now())
         , pause_time_(ClockType::now())
         , accumulated_time_(0.0)
@@ -11,97 +12,109 @@ namespace Gem {
     {
     }
 
-    void Timer::start() noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicTimer<Policy, ClockSource>::start() noexcept {
+        WriteGuard guard(policy_);
 
-        is_running_ = true;
-        is_paused_ = false;
-        accumulated_time_ = 0.0;  // Reset any previous elapsed
-        start_time_ = ClockType::now();
+        is_running_.store(true);
+        is_paused_.store(false);
+        accumulated_time_.store(0.0);  // Reset any previous elapsed
+        start_time_.store(ClockType::now());
     }
 
-    void Timer::stop() noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicTimer<Policy, ClockSource>::stop() noexcept {
+        WriteGuard guard(policy_);
 
-        if (is_running_) {
+        if (is_running_.load()) {
             // If we're paused, 'accumulated_time_' already holds the final elapsed.
             // If we're running and not paused, we finalize it now.
-            if (!is_paused_) {
+            if (!is_paused_.load()) {
                 auto now = ClockType::now();
-                std::chrono::duration<double> delta = now - start_time_;
-                accumulated_time_ += delta.count();
+                std::chrono::duration<double> delta = now - start_time_.load();
+                accumulated_time_.store(accumulated_time_.load() + delta.count());
             }
-            is_running_ = false;
-            is_paused_ = false;
+            is_running_.store(false);
+            is_paused_.store(false);
         }
     }
 
-    void Timer::pause() noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicTimer<Policy, ClockSource>::pause() noexcept {
+        WriteGuard guard(policy_);
 
-        if (is_running_ && !is_paused_) {
+        if (is_running_.load() && !is_paused_.load()) {
             // Accumulate time so far
             auto now = ClockType::now();
-            std::chrono::duration<double> delta = now - start_time_;
-            accumulated_time_ += delta.count();
+            std::chrono::duration<double> delta = now - start_time_.load();
+            accumulated_time_.store(accumulated_time_.load() + delta.count());
             // Mark paused
-            pause_time_ = now;
-            is_paused_ = true;
+            pause_time_.store(now);
+            is_paused_.store(true);
         }
     }
 
-    void Timer::unpause() noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (is_running_ && is_paused_) {
+    template <typename Policy, typename ClockSource>
+    void BasicTimer<Policy, ClockSource>::unpause() noexcept {
+        WriteGuard guard(policy_);
+        if (is_running_.load() && is_paused_.load()) {
             // Resume from now
-            is_paused_ = false;
-            start_time_ = ClockType::now();
+            is_paused_.store(false);
+            start_time_.store(ClockType::now());
         }
     }
 
-    void Timer::reset(bool keepRunning) noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
+    template <typename Policy, typename ClockSource>
+    void BasicTimer<Policy, ClockSource>::reset(bool keepRunning) noexcept {
+        WriteGuard guard(policy_);
 
-        accumulated_time_ = 0.0;
-        start_time_ = ClockType::now();
-        pause_time_ = start_time_;
-        is_paused_ = false;
-
-        if (keepRunning) {
-            is_running_ = true;
-        }
-        else {
-            is_running_ = false;
-        }
+        TimePoint now = ClockType::now();
+        accumulated_time_.store(0.0);
+        start_time_.store(now);
+        pause_time_.store(now);
+        is_paused_.store(false);
+        is_running_.store(keepRunning);
     }
 
-    double Timer::getElapsedTimeInSeconds() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        if (!is_running_) {
-            // Timer is stopped => just return whatever was accumulated
-            return accumulated_time_;
-        }
+    template <typename Policy, typename ClockSource>
+    double BasicTimer<Policy, ClockSource>::getElapsedTimeInSeconds() const noexcept {
+        return policy_.read([this]() noexcept {
+            if (!is_running_.load()) {
+                // Timer is stopped => just return whatever was accumulated
+                return accumulated_time_.load();
+            }
 
-        if (is_paused_) {
-            // Timer is paused => also return the accumulated time
-            return accumulated_time_;
-        }
+            if (is_paused_.load()) {
+                // Timer is paused => also return the accumulated time
+                return accumulated_time_.load();
+            }
 
-        // Timer is running and not paused => calculate
-        auto now = ClockType::now();
-        std::chrono::duration<double> delta = now - start_time_;
-        return accumulated_time_ + delta.count();
+            // Timer is running and not paused => calculate
+            auto now = ClockType::now();
+            std::chrono::duration<double> delta = now - start_time_.load();
+            return accumulated_time_.load() + delta.count();
+        });
     }
 
-    bool Timer::isRunning() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return is_running_ && !is_paused_;
+    template <typename Policy, typename ClockSource>
+    bool BasicTimer<Policy, ClockSource>::isRunning() const noexcept {
+        return policy_.read([this]() noexcept {
+            return is_running_.load() && !is_paused_.load();
+        });
     }
 
-    bool Timer::isPaused() const noexcept {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return is_paused_;
+    template <typename Policy, typename ClockSource>
+    bool BasicTimer<Policy, ClockSource>::isPaused() const noexcept {
+        return policy_.read([this]() noexcept {
+            return is_paused_.load();
+        });
     }
 
+    template class BasicTimer<ThreadPolicy::SingleThread, std::chrono::steady_clock>;
+    template class BasicTimer<ThreadPolicy::Locked, std::chrono::steady_clock>;
+    template class BasicTimer<ThreadPolicy::AtomicRead, std::chrono::steady_clock>;
+    template class BasicTimer<ThreadPolicy::SingleThread, TscClock>;
+    template class BasicTimer<ThreadPolicy::Locked, TscClock>;
+    template class BasicTimer<ThreadPolicy::AtomicRead, TscClock>;
+
 } // namespace Gem
@@ -0,0 +1,140 @@
+#include <Gem/Core/TscClock.h>
+
+#include <thread>
+
+#if GEM_TSC_X86 && !defined(_MSC_VER)
+    #include <cpuid.h>
+#endif
+
+namespace Gem {
+
+    namespace {
+
+        using SteadyClock = std::chrono::steady_clock;
+
+        struct Calibration {
+            bool use_tsc = false;
+            std::uint64_t base_tsc = 0;
+            std::int64_t base_ns = 0;       ///< steady_clock time at base_tsc.
+            double ns_per_tick = 0.0;
+            double frequency = 0.0;
+        };
+
+        std::int64_t steadyNanoseconds() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(SteadyClock::now().time_since_epoch()).count();
+        }
+
+#if GEM_TSC_X86
+        inline std::uint64_t readTsc() noexcept {
+            return __rdtsc();
+        }
+
+        /**
+         * @brief CPUID 0x80000007 EDX bit 8: the TSC runs at a constant rate in every P/C-state.
+         */
+        bool hasInvariantTsc() noexcept {
+#ifdef _MSC_VER
+            int regs[4] = {};
+            __cpuid(regs, 0x80000000);
+            if (static_cast<unsigned int>(regs[0]) < 0x80000007u) {
+                return false;
+            }
+            __cpuid(regs, 0x80000007);
+            return (regs[3] & (1 << 8)) != 0;
+#else
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {
+                return false;
+            }
+            __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx);
+            return (edx & (1u << 8)) != 0;
+#endif
+        }
+
+        /**
+         * @brief Reads steady_clock and the TSC as close together as possible:
+         *        the TSC value is the midpoint of two reads around the steady_clock read.
+         */
+        void samplePair(std::uint64_t& tsc, std::int64_t& ns) noexcept {
+            std::uint64_t best_window = ~0ull;
+            for (int i = 0; i < 5; ++i) {
+                std::uint64_t before = readTsc();
+                std::int64_t steady = steadyNanoseconds();
+                std::uint64_t after = readTsc();
+
+                if (after - before < best_window) {
+                    best_window = after - before;
+                    tsc = before + (after - before) / 2;
+                    ns = steady;
+                }
+            }
+        }
+#endif
+
+        Calibration runCalibration() noexcept {
+            Calibration result;
+
+#if GEM_TSC_X86
+            if (!hasInvariantTsc()) {
+                return result;
+            }
+
+            std::uint64_t tsc_begin = 0, tsc_end = 0;
+            std::int64_t ns_begin = 0, ns_end = 0;
+
+            samplePair(tsc_begin, ns_begin);
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            samplePair(tsc_end, ns_end);
+
+            if (tsc_end <= tsc_begin || ns_end <= ns_begin) {
+                return result;
+            }
+
+            result.frequency = static_cast<double>(tsc_end - tsc_begin) * 1e9 / static_cast<double>(ns_end - ns_begin);
+            result.ns_per_tick = 1e9 / result.frequency;
+            result.base_tsc = tsc_end;
+            result.base_ns = ns_end;
+            result.use_tsc = true;
+#endif
+
+            return result;
+        }
+
+        const Calibration& calibration() noexcept {
+            static const Calibration instance = runCalibration();
+            return instance;
+        }
+
+    } // namespace
+
+    TscClock::time_point TscClock::now() noexcept {
+#if GEM_TSC_X86
+        const Calibration& cal = calibration();
+        if (cal.use_tsc) {
+            // Signed delta: a thread on another core may read a TSC slightly behind base_tsc
+            std::int64_t ticks = static_cast<std::int64_t>(readTsc() - cal.base_tsc);
+            return time_point(duration(cal.base_ns + static_cast<std::int64_t>(static_cast<double>(ticks) * cal.ns_per_tick)));
+        }
+#endif
+        return time_point(duration(steadyNanoseconds()));
+    }
+
+    void TscClock::calibrate() noexcept {
+        bool use_tsc = calibration().use_tsc;
+        counter_source_.store(use_tsc ? CounterSource::Tsc : CounterSource::Steady, std::memory_order_relaxed);
+    }
+
+    bool TscClock::isUsingTsc() noexcept {
+        return calibration().use_tsc;
+    }
+
+    double TscClock::getFrequency() noexcept {
+        return calibration().frequency;
+    }
+
+    double TscClock::getTicksPerSecond() noexcept {
+        const Calibration& cal = calibration();
+        return cal.use_tsc ? cal.frequency : 1e9;
+    }
+
+} // namespace Gem
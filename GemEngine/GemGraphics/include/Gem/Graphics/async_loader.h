@@ -0,0 +1,141 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+#include <../../GemCore/include-protected/EGL_Manager.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief Completion of one AsyncLoader upload.
+         *
+         * Ready once the loader thread has run the upload and the GPU has executed it (its fence is
+         * signaled). Until then the objects it fills must not be used. Copies share the same upload.
+         */
+        class UploadHandle {
+        public:
+            /**
+             * @brief An empty handle, always ready.
+             */
+            UploadHandle() = default;
+
+            /**
+             * @brief Checks, without blocking, whether the upload has landed. GL thread only.
+             */
+            [[nodiscard]] bool is_ready() const;
+
+            /**
+             * @brief Blocks until the upload has landed. GL thread only.
+             */
+            void wait() const;
+
+            /**
+             * @brief Checks if the handle refers to an upload.
+             */
+            [[nodiscard]] bool is_valid() const noexcept;
+
+        private:
+            friend class AsyncLoader;
+
+            /**
+             * Shared by the handles and the loader thread.
+             */
+            struct State {
+                std::mutex mutex;
+                std::condition_variable uploaded_condition;
+                bool uploaded = false;      ///< The loader ran the upload and inserted the fence.
+                GLsync fence = nullptr;     ///< Deleted by whoever sees it signaled first.
+            };
+
+            explicit UploadHandle(std::shared_ptr<State> state) noexcept;
+
+            std::shared_ptr<State> state_;
+        };
+
+        /**
+         * @brief Background thread uploading buffers and textures through a shared OpenGL context.
+         *
+         * The loader owns a context sharing objects with the one current on the thread that
+         * constructs it: a hidden GLFW window, or a second EGL context when the engine runs
+         * headless. Uploads run on the loader thread in submission order; each one is followed
+         * by a glFenceSync, and the returned handle reports when that fence is signaled, so the
+         * render loop never blocks in glBufferData, glTexImage2D or image decoding.
+         *
+         * Object names (glGen*) may be created on either thread, but vertex array objects are not
+         * shared between contexts: set them up on the GL thread once the handle is ready.
+         */
+        class AsyncLoader {
+        public:
+            /**
+             * @brief Creates the shared context and starts the loader thread.
+             *
+             * Call on the GL thread, with its context current.
+             *
+             * @throws std::runtime_error if the shared context cannot be created.
+             */
+            AsyncLoader();
+
+            /**
+             * @brief Runs the queued uploads, then stops the thread and destroys its context.
+             */
+            ~AsyncLoader();
+
+            // No copy/move
+            AsyncLoader(const AsyncLoader&) = delete;
+            AsyncLoader& operator=(const AsyncLoader&) = delete;
+            AsyncLoader(AsyncLoader&&) = delete;
+            AsyncLoader& operator=(AsyncLoader&&) = delete;
+
+            /**
+             * @brief Queues @p upload to run on the loader thread, with the shared context current.
+             *
+             * @param upload Creates and fills GL objects. Whatever it references must stay alive
+             *               until the handle is ready.
+             * @return Handle to poll or wait on before first use of the uploaded objects.
+             */
+            UploadHandle submit(std::function<void()> upload);
+
+            /**
+             * @brief Number of uploads queued or running.
+             */
+            [[nodiscard]] std::size_t get_pending_count() const noexcept;
+
+        private:
+            struct Request {
+                std::function<void()> upload;
+                std::shared_ptr<UploadHandle::State> state;
+            };
+
+            void loaderMain();
+
+            /**
+             * Deletes the fences of uploads nobody holds a handle to anymore.
+             */
+            void retire();
+
+        private:
+            GLFWwindow* window_ = nullptr;             ///< Hidden window owning the shared context (windowed mode).
+            EGLManager::SharedContext egl_context_;    ///< Shared context in headless mode.
+
+            std::thread thread_;
+            std::mutex mutex_;                  ///< Guards requests_ and running_.
+            std::condition_variable condition_;
+            std::deque<Request> requests_;
+            bool running_ = true;
+            std::atomic<std::size_t> pending_{ 0 };
+
+            std::vector<std::shared_ptr<UploadHandle::State>> in_flight_;  ///< Loader thread only.
+        };
+
+    } // namespace Graphics
+} // namespace Gem
@@ -31,7 +31,7 @@ namespace Gem {
             /**
              * @brief Generates the buffer object.
              *
-             * Calls glGenBuffers to create a new OpenGL buffer object.
+             * Calls glCreateBuffers when the context has direct state access, glGenBuffers otherwise.
              * Must be called before binding or setting data.
              */
             void generate();
@@ -54,7 +54,8 @@ namespace Gem {
             /**
              * @brief Uploads data to the buffer.
              *
-             * Calls glBufferData to create and initialize the buffer object's data store.
+             * Calls glNamedBufferData to create and initialize the buffer object's data store. Without
+             * direct state access it binds the buffer and calls glBufferData, leaving it bound.
              * The buffer must be generated before calling this method.
              *
              * @param size The size in bytes of the data to be uploaded.
@@ -63,6 +64,42 @@ namespace Gem {
              */
             void set_data(GLsizeiptr size, const void* data, GLenum usage);
 
+            /**
+             * @brief Creates an immutable data store (glNamedBufferStorage, or bind + glBufferStorage).
+             *
+             * The size cannot change afterwards; drivers can place such stores better than
+             * glBufferData ones. Needs GL 4.4 or ARB_buffer_storage.
+             *
+             * @param size The size in bytes of the store.
+             * @param data A pointer to the data copied into the store, or nullptr.
+             * @param flags What the store allows (0 for data never updated, GL_DYNAMIC_STORAGE_BIT for buffer_sub_data...).
+             */
+            void set_storage(GLsizeiptr size, const void* data, GLbitfield flags = 0);
+
+            /**
+             * @brief Updates part of the data store (glNamedBufferSubData, or glBufferSubData).
+             *
+             * Without direct state access the buffer is bound to GL_COPY_WRITE_BUFFER rather than its
+             * own type, so no vertex array is modified (binding an element buffer changes the bound VAO).
+             *
+             * @param offset The offset in bytes where the update starts.
+             * @param size The size in bytes of the data.
+             * @param data A pointer to the data.
+             */
+            void set_sub_data(GLintptr offset, GLsizeiptr size, const void* data);
+
+            /**
+             * @brief Copies a range of another buffer into this one, on the GPU.
+             *
+             * Calls glCopyNamedBufferSubData, or binds both buffers to the copy targets and calls glCopyBufferSubData.
+             *
+             * @param source The buffer to read from. If it is this buffer, the ranges must not overlap.
+             * @param source_offset The offset in bytes of the range in @p source.
+             * @param offset The offset in bytes of the range in this buffer.
+             * @param size The size in bytes of the range.
+             */
+            void copy_sub_data(const Buffer& source, GLintptr source_offset, GLintptr offset, GLsizeiptr size);
+
             /**
              * @brief Deletes the buffer object.
              *
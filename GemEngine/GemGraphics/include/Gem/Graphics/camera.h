@@ -11,6 +11,9 @@
 #include <Gem/Graphics/shader.h>
 #include <../../GemWindow/include-protected/Inputs.h>
 #include <Gem/Graphics/buffer.h>
+#include <Gem/Graphics/stream_buffer.h>
+
+#include <memory>
 
 namespace Gem {
 
@@ -139,6 +142,25 @@ namespace Gem {
              */
             void update(GLFWwindow* window, float deltaTime);
 
+            /**
+             * @brief Advances the camera movement by one fixed simulation step.
+             *
+             * Call it once per fixed step given by Clock::getFixedSteps(), then call
+             * update_interpolated() once per frame.
+             *
+             * @param step Fixed step duration in seconds.
+             */
+            void fixed_update(float step);
+
+            /**
+             * @brief Processes mouse look and uploads the matrices, with the position
+             *        interpolated between the last two fixed steps.
+             *
+             * @param window Pointer to the GLFW window.
+             * @param alpha Interpolation factor from Clock::getInterpolationAlpha() (0 = previous step, 1 = last step).
+             */
+            void update_interpolated(GLFWwindow* window, float alpha);
+
             /**
              * @brief Equality operator.
              *
@@ -174,8 +196,11 @@ namespace Gem {
              * @brief Updates and sends the view and projection matrices to the shader.
              *
              * Calculates the view and projection matrices based on the camera's current state.
+             * Called once per frame: with a StreamBuffer, each call writes to the next frame's region.
+             *
+             * @param eye Position to render from (the current or an interpolated position).
              */
-            void update_matrices() const;
+            void update_matrices(const glm::vec3& eye);
 
             /**
              * @brief Handles camera input processing.
@@ -210,6 +235,7 @@ namespace Gem {
         private:
 
             glm::vec3 position_{ 0.0f, 0.0f, 0.0f };        ///< Camera position.
+            glm::vec3 previous_position_{ 0.0f, 0.0f, 0.0f }; ///< Position before the last fixed step.
             glm::vec3 orientation_{ 0.0f, 0.0f, -1.0f };    ///< Camera forward direction.
             glm::vec3 up_{ 0.0f, 1.0f, 0.0f };              ///< Camera up direction.
 
@@ -233,7 +259,8 @@ namespace Gem {
 
 			Gem::Graphics::Shader* shader_{ nullptr };      ///< Pointer to the Shader object.
 
-			Graphics::Buffer matrices_ubo_{ GL_UNIFORM_BUFFER }; ///< Buffer for matrices UBO
+			std::unique_ptr<StreamBuffer> matrices_stream_;      ///< Per-frame matrices, when buffer storage is supported.
+			Graphics::Buffer matrices_ubo_{ GL_UNIFORM_BUFFER }; ///< Buffer for matrices UBO (fallback without buffer storage)
 			const GLuint matrices_binding_point_ = 0;            ///< Binding point for the matrices UBO.
         };
 
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+#include <Gem/Graphics/buffer.h>
+#include <Gem/Graphics/vao.h>
+#include <Gem/Graphics/vertex_layout.h>
+#include <Gem/Graphics/offset_allocator.h>
+#include <Gem/Graphics/render_queue.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief Handle to a mesh stored in a GeometryPool.
+         *
+         * Only an index into the pool: the mesh's place in the shared buffers can change when the
+         * pool compacts, so ask the pool (get_mesh(), get_base_vertex()...) at draw time.
+         */
+        struct MeshAllocation {
+            static constexpr std::uint32_t INVALID = 0xFFFFFFFF;
+
+            std::uint32_t id = INVALID;
+
+            /**
+             * @brief False for an empty handle (failed allocation, or default constructed).
+             */
+            explicit operator bool() const noexcept { return id != INVALID; }
+        };
+
+        /**
+         * @brief Packs many meshes of one vertex format into a shared vertex buffer and index buffer.
+         *
+         * Each mesh gets a range of vertices and a range of indices from two OffsetAllocators.
+         * Indices stay relative to the mesh's first vertex and are drawn with glDrawElementsBaseVertex,
+         * so every mesh of the pool draws from the pool's single VAO: a RenderQueue sorting by VAO
+         * binds it once for all of them.
+         *
+         * Freed ranges are not reused before the GPU is done with the draws already issued: they
+         * are fenced by next_frame() and recycled once the fence has signaled. compact() packs the
+         * live meshes at the start of new buffers with glCopyBufferSubData, when fragmentation
+         * leaves free space that no single range can use.
+         *
+         * GL thread only. The pool must outlive the meshes allocated from it.
+         */
+        class GeometryPool {
+        public:
+            /**
+             * @brief Settings of a pool.
+             */
+            struct Config {
+                GLsizei vertex_stride = PositionNormalVertex::stride;   ///< Bytes per vertex.
+                std::vector<VertexAttribute> attributes = {             ///< Position and normal, like the shapes.
+                    PositionNormalVertex::attributes.begin(), PositionNormalVertex::attributes.end()
+                };
+                std::uint32_t vertex_capacity = 256 * 1024;        ///< Vertices the pool can hold.
+                std::uint32_t index_capacity = 1024 * 1024;        ///< Indices (GL_UNSIGNED_INT) the pool can hold.
+                bool compact_when_fragmented = false;              ///< Let allocate() call compact() when only fragmentation makes it fail (see compact()).
+
+                /**
+                 * @brief A config for the vertex format @p Layout (a VertexLayout), other settings at their defaults.
+                 */
+                template <typename Layout>
+                [[nodiscard]] static Config for_layout() {
+                    Config config;
+                    config.vertex_stride = Layout::stride;
+                    config.attributes.assign(Layout::attributes.begin(), Layout::attributes.end());
+                    return config;
+                }
+            };
+
+            /**
+             * @brief Usage of the pool.
+             */
+            struct Stats {
+                std::size_t meshes = 0;             ///< Live allocations.
+                std::uint32_t used_vertices = 0;    ///< Including ranges waiting for the GPU after free().
+                std::uint32_t used_indices = 0;
+                std::size_t pending_frees = 0;      ///< Freed meshes whose ranges are not reusable yet.
+                std::size_t compactions = 0;
+            };
+
+            GeometryPool();
+            explicit GeometryPool(const Config& config);
+            ~GeometryPool();
+
+            // No copy/move
+            GeometryPool(const GeometryPool&) = delete;
+            GeometryPool& operator=(const GeometryPool&) = delete;
+            GeometryPool(GeometryPool&&) = delete;
+            GeometryPool& operator=(GeometryPool&&) = delete;
+
+            /**
+             * @brief Reserves room for a mesh, to fill with write().
+             *
+             * @return The handle, or an empty one (logged) if the pool is full.
+             */
+            [[nodiscard]] MeshAllocation allocate(std::uint32_t vertex_count, std::uint32_t index_count);
+
+            /**
+             * @brief Reserves room for a mesh and uploads it.
+             *
+             * @param vertices vertex_count vertices in the pool's format.
+             * @param vertex_count Number of vertices.
+             * @param indices index_count indices, relative to the mesh's first vertex.
+             * @param index_count Number of indices.
+             * @return The handle, or an empty one (logged) if the pool is full.
+             */
+            [[nodiscard]] MeshAllocation upload(const void* vertices, std::uint32_t vertex_count, const GLuint* indices, std::uint32_t index_count);
+
+            /**
+             * @brief Fills a whole allocation.
+             *
+             * @param vertices As many vertices as allocated, in the pool's format.
+             * @param indices As many indices as allocated, relative to the mesh's first vertex.
+             */
+            void write(MeshAllocation mesh, const void* vertices, const GLuint* indices);
+
+            /**
+             * @brief Releases a mesh. The handle is invalid afterwards.
+             *
+             * Its ranges are reused once the GPU has finished the commands issued so far (see next_frame()).
+             */
+            void free(MeshAllocation mesh);
+
+            /**
+             * @brief Fences the ranges freed since the last call and recycles those the GPU is done with.
+             *
+             * Call it once per frame, after the frame's draws. Never blocks.
+             */
+            void next_frame();
+
+            /**
+             * @brief Moves every live mesh to the start of new buffers, removing all free gaps.
+             *
+             * The copies run on the GPU (glCopyBufferSubData). Ranges still waiting for the GPU are
+             * reclaimed at once: the old buffers stay alive for the commands that read them.
+             *
+             * Every mesh gets a new first index and base vertex, so DrawPackets built from get_mesh()
+             * and still queued in a RenderQueue would draw the wrong ranges: call it between frames,
+             * when no packet is queued. The same holds for allocate() when compact_when_fragmented is on.
+             *
+             * @return True if the pool was compacted, false if there was nothing to move.
+             */
+            bool compact();
+
+            /**
+             * @brief Describes a mesh for a RenderQueue (the pool's VAO, first index, base vertex).
+             *
+             * @return The mesh, or an empty one for an invalid handle.
+             */
+            [[nodiscard]] Mesh get_mesh(MeshAllocation mesh, GLenum mode = GL_TRIANGLES) const noexcept;
+
+            /**
+             * @brief Gets the index of a mesh's first vertex in the vertex buffer.
+             */
+            [[nodiscard]] GLint get_base_vertex(MeshAllocation mesh) const noexcept;
+
+            /**
+             * @brief Gets the index of a mesh's first index in the index buffer.
+             */
+            [[nodiscard]] std::uint32_t get_first_index(MeshAllocation mesh) const noexcept;
+
+            /**
+             * @brief Draws a mesh with the pool's VAO, leaving no VAO bound.
+             */
+            void draw(MeshAllocation mesh, GLenum mode = GL_TRIANGLES) const;
+
+            /**
+             * @brief Gets the VAO every mesh of the pool draws with.
+             */
+            [[nodiscard]] GLuint get_vao() const noexcept;
+
+            /**
+             * @brief Gets the size of a vertex, in bytes.
+             */
+            [[nodiscard]] GLsizei get_vertex_stride() const noexcept;
+
+            [[nodiscard]] Stats get_stats() const noexcept;
+
+        private:
+            struct Entry {
+                OffsetAllocator::Allocation vertices;
+                OffsetAllocator::Allocation indices;
+                std::uint32_t vertex_count = 0;
+                std::uint32_t index_count = 0;
+                bool live = false;
+            };
+
+            struct Ranges {
+                OffsetAllocator::Allocation vertices;
+                OffsetAllocator::Allocation indices;
+            };
+
+            struct Retired {
+                GLsync fence = nullptr;
+                std::vector<Ranges> ranges;
+            };
+
+            /**
+             * @brief Creates the buffers and links them to the VAO.
+             */
+            void create_buffers(std::unique_ptr<Buffer>& vertices, std::unique_ptr<Buffer>& indices) const;
+            void link_vao();
+
+            /**
+             * @brief Gets the live entry of a handle, or nullptr.
+             */
+            [[nodiscard]] const Entry* find(MeshAllocation mesh) const noexcept;
+
+            Config config_;
+
+            std::unique_ptr<Buffer> vertex_buffer_;
+            std::unique_ptr<Buffer> index_buffer_;
+            VAO vao_;
+
+            OffsetAllocator vertex_allocator_;
+            OffsetAllocator index_allocator_;
+
+            std::vector<Entry> entries_;                ///< Indexed by MeshAllocation::id.
+            std::vector<std::uint32_t> free_entries_;   ///< Ids to recycle.
+
+            std::vector<Ranges> pending_;               ///< Freed since the last next_frame().
+            std::deque<Retired> retiring_;              ///< Fenced, oldest first.
+
+            std::size_t meshes_ = 0;
+            std::size_t compactions_ = 0;
+        };
+
+    } // namespace Graphics
+} // namespace Gem
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+#include <Gem/Core/Profiler.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if GEMENGINE_PROFILING
+
+    /**
+     * @brief Times the GL commands issued in the rest of the enclosing scope under @p name.
+     */
+    #define GEM_GPU_ZONE(name)                                                                                  \
+        static const ::Gem::Profiler::ZoneDesc GEM_PROFILE_CONCAT(gem_gpu_zone_desc_, __LINE__){ name, __FILE__, __LINE__ }; \
+        ::Gem::Graphics::GpuProfiler::Zone GEM_PROFILE_CONCAT(gem_gpu_zone_, __LINE__)(GEM_PROFILE_CONCAT(gem_gpu_zone_desc_, __LINE__))
+
+    /**
+     * @brief CPU zone and GPU zone with the same name, so both show up side by side in traces.
+     */
+    #define GEM_PROFILE_GPU_ZONE(name)                                                                          \
+        static const ::Gem::Profiler::ZoneDesc GEM_PROFILE_CONCAT(gem_gpu_zone_desc_, __LINE__){ name, __FILE__, __LINE__ }; \
+        ::Gem::Profiler::Zone GEM_PROFILE_CONCAT(gem_cpu_zone_, __LINE__)(GEM_PROFILE_CONCAT(gem_gpu_zone_desc_, __LINE__)); \
+        ::Gem::Graphics::GpuProfiler::Zone GEM_PROFILE_CONCAT(gem_gpu_zone_, __LINE__)(GEM_PROFILE_CONCAT(gem_gpu_zone_desc_, __LINE__))
+
+#else
+
+    #define GEM_GPU_ZONE(name) static_cast<void>(0)
+    #define GEM_PROFILE_GPU_ZONE(name) static_cast<void>(0)
+
+#endif
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief GPU timer and pipeline-statistics queries, read back without stalling.
+         *
+         * Each frame uses its own set of query objects from a ring of frames in flight:
+         * a GL_TIME_ELAPSED query around the whole frame, a pair of GL_TIMESTAMP queries per
+         * zone (timestamps nest, elapsed-time queries do not) and, when available, the
+         * ARB_pipeline_statistics_query counters. Results are polled with
+         * GL_QUERY_RESULT_AVAILABLE a few frames later; a frame whose results are still not
+         * ready when its slot comes around again is dropped rather than waited for.
+         * A zone still open at end_frame() ends with its frame.
+         *
+         * GPU timestamps are converted to steady_clock time (calibrated with glGetInteger64v
+         * GL_TIMESTAMP) and forwarded to the CPU Profiler on a "GPU" track, so GPU zones line up
+         * with CPU zones in reports and Chrome traces.
+         *
+         * All functions must be called on the thread that owns the GL context.
+         */
+        class GpuProfiler {
+        public:
+            /**
+             * @brief Settings used by init().
+             */
+            struct Config {
+                std::size_t frames_in_flight = 4;       ///< Frames of latency before results are read.
+                std::size_t max_zones_per_frame = 256;  ///< Zones beyond this are not timed.
+                bool pipeline_statistics = true;        ///< Use ARB_pipeline_statistics_query if supported.
+            };
+
+            /**
+             * @brief Pipeline statistics of one frame.
+             */
+            struct PipelineStatistics {
+                std::uint64_t vertices_submitted = 0;
+                std::uint64_t primitives_submitted = 0;
+                std::uint64_t vertex_shader_invocations = 0;
+                std::uint64_t fragment_shader_invocations = 0;
+                std::uint64_t clipping_input_primitives = 0;
+                std::uint64_t clipping_output_primitives = 0;
+            };
+
+            /**
+             * @brief One timed zone, in CPU (steady_clock) time.
+             */
+            struct ZoneResult {
+                const Profiler::ZoneDesc* zone = nullptr;
+                std::uint32_t depth = 0;
+                std::chrono::steady_clock::time_point start;
+                std::chrono::steady_clock::time_point end;
+            };
+
+            /**
+             * @brief Results of one completed frame.
+             */
+            struct FrameResult {
+                std::uint64_t frame_index = 0;
+                double gpu_time_ms = 0.0;               ///< GL_TIME_ELAPSED between begin_frame() and end_frame().
+                std::vector<ZoneResult> zones;
+                bool has_statistics = false;
+                PipelineStatistics statistics;
+            };
+
+            /**
+             * @brief RAII GPU zone; use GEM_GPU_ZONE / GEM_PROFILE_GPU_ZONE rather than this directly.
+             */
+            class Zone {
+            public:
+                explicit Zone(const Profiler::ZoneDesc& desc) noexcept;
+                ~Zone();
+
+                // No copy/move
+                Zone(const Zone&) = delete;
+                Zone& operator=(const Zone&) = delete;
+                Zone(Zone&&) = delete;
+                Zone& operator=(Zone&&) = delete;
+
+            private:
+                std::int64_t index_;    ///< Zone index in its frame, -1 if not timed.
+                std::size_t slot_;      ///< Frame slot the zone was opened in.
+                std::uint64_t frame_;   ///< Frame the zone was opened in.
+            };
+
+            /**
+             * @brief Creates the query objects with the default configuration.
+             */
+            static bool init();
+
+            /**
+             * @brief Creates the query objects. Requires a current GL context with timer queries (GL 3.3).
+             * @return False if timer queries are not supported.
+             */
+            static bool init(const Config& config);
+
+            /**
+             * @brief Deletes the query objects. Requires the GL context to still be current.
+             */
+            static void shutdown();
+
+            [[nodiscard]] static bool is_initialized() noexcept;
+            [[nodiscard]] static bool has_pipeline_statistics() noexcept;
+
+            /**
+             * @brief Reads back every finished frame, then starts the queries of a new frame.
+             */
+            static void begin_frame();
+
+            /**
+             * @brief Ends the frame queries. Call before swapping buffers.
+             */
+            static void end_frame();
+
+            /**
+             * @brief Results of the most recent frame that has been read back.
+             */
+            [[nodiscard]] static const FrameResult& get_last_frame() noexcept;
+
+            /**
+             * @brief Frames whose results were not ready before their slot was reused.
+             */
+            [[nodiscard]] static std::uint64_t get_dropped_frames() noexcept;
+
+        private:
+            GpuProfiler() = delete;  // no instances
+            ~GpuProfiler() = delete;
+        };
+
+    } // namespace Graphics
+} // namespace Gem
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief Hands out ranges of an abstract space (vertices, indices, bytes...) in O(1).
+         *
+         * Two-level segregated fit: free ranges are kept in 256 size classes, each a float-like
+         * value with a 5-bit exponent and a 3-bit mantissa, so a class never spans more than
+         * 12.5% of its size. A bitmap of the non-empty classes (one bit per top-level exponent,
+         * one byte of mantissas under each) finds the first class large enough with two
+         * count-trailing-zeros. Only when every larger class is empty is the request's own class
+         * searched, so an allocation fails only if no free range can hold it. Freed ranges merge
+         * with free neighbours immediately.
+         *
+         * Only offsets are managed: no GL call, no memory behind them. Not thread-safe.
+         */
+        class OffsetAllocator {
+        public:
+            static constexpr std::uint32_t NO_SPACE = 0xFFFFFFFF;
+
+            /**
+             * @brief A range handed out by allocate(). Keep it to free() the range.
+             */
+            struct Allocation {
+                std::uint32_t offset = NO_SPACE;    ///< Start of the range, in units of the managed space.
+                std::uint32_t node = NO_SPACE;      ///< Internal, identifies the range for free().
+
+                /**
+                 * @brief False if the allocation failed.
+                 */
+                explicit operator bool() const noexcept { return offset != NO_SPACE; }
+            };
+
+            /**
+             * @brief Creates an allocator managing [0, size).
+             */
+            explicit OffsetAllocator(std::uint32_t size);
+
+            /**
+             * @brief Reserves @p size contiguous units.
+             *
+             * @return The allocation, or an empty one if no free range is large enough (or @p size is 0).
+             */
+            [[nodiscard]] Allocation allocate(std::uint32_t size);
+
+            /**
+             * @brief Releases a range from allocate(), merging it with its free neighbours.
+             */
+            void free(Allocation allocation);
+
+            /**
+             * @brief Frees every range at once.
+             */
+            void reset();
+
+            /**
+             * @brief Gets the size of an allocation, in units.
+             */
+            [[nodiscard]] std::uint32_t get_allocation_size(Allocation allocation) const noexcept;
+
+            /**
+             * @brief Gets the size of the managed space.
+             */
+            [[nodiscard]] std::uint32_t get_size() const noexcept;
+
+            /**
+             * @brief Gets the number of free units, in all ranges.
+             */
+            [[nodiscard]] std::uint32_t get_free_size() const noexcept;
+
+            /**
+             * @brief Gets the size of the largest free range: the largest allocation that would succeed now.
+             */
+            [[nodiscard]] std::uint32_t get_largest_free_size() const noexcept;
+
+        private:
+            static constexpr std::uint32_t TOP_BINS = 32;
+            static constexpr std::uint32_t BINS_PER_LEAF = 8;
+            static constexpr std::uint32_t LEAF_BINS = TOP_BINS * BINS_PER_LEAF;
+
+            struct Node {
+                std::uint32_t offset = 0;
+                std::uint32_t size = 0;
+                std::uint32_t bin_prev = NO_SPACE;          ///< Free list of the node's size class.
+                std::uint32_t bin_next = NO_SPACE;
+                std::uint32_t neighbor_prev = NO_SPACE;     ///< Adjacent ranges, free or not, in offset order.
+                std::uint32_t neighbor_next = NO_SPACE;
+                bool used = false;
+            };
+
+            /**
+             * @brief Creates a free node and pushes it on its size class's list.
+             */
+            std::uint32_t insert_free_node(std::uint32_t offset, std::uint32_t size);
+
+            /**
+             * @brief Unlinks a free node from its size class's list (the node itself is kept).
+             */
+            void remove_from_bin(std::uint32_t index);
+
+            std::uint32_t new_node();
+            void release_node(std::uint32_t index);
+
+            std::uint32_t size_;
+            std::uint32_t free_size_ = 0;
+            std::uint32_t used_top_bins_ = 0;               ///< Bit per top-level bin with a non-empty leaf.
+            std::uint8_t used_leaf_bins_[TOP_BINS] = {};    ///< Bit per non-empty size class.
+            std::uint32_t bin_heads_[LEAF_BINS];            ///< First free node of each size class.
+
+            std::vector<Node> nodes_;
+            std::vector<std::uint32_t> unused_nodes_;       ///< Indices in nodes_ to recycle.
+        };
+
+    } // namespace Graphics
+} // namespace Gem
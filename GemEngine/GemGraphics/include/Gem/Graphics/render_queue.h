@@ -0,0 +1,187 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+#include <Gem/Graphics/buffer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief What a draw needs to know about a mesh (see Shapes::*::get_mesh()).
+         */
+        struct Mesh {
+            GLuint vao = 0;
+            GLenum mode = GL_TRIANGLES;         ///< Primitive type.
+            GLsizei count = 0;                  ///< Number of indices.
+            GLenum index_type = GL_UNSIGNED_INT;
+            std::uint32_t index_offset = 0;     ///< Offset of the first index in the element buffer, in bytes.
+            GLint base_vertex = 0;              ///< Added to every index (meshes sharing a GeometryPool's buffers).
+        };
+
+        /**
+         * @brief One recorded draw, one cache line.
+         */
+        struct DrawPacket {
+            static constexpr unsigned int MAX_TEXTURES = 4;
+
+            std::uint64_t sort_key = 0;
+            GLuint program = 0;                             ///< Pipeline (shader program).
+            GLuint vao = 0;
+            GLuint textures[MAX_TEXTURES] = {};             ///< Texture per unit, 0 = leave the unit alone.
+            std::uint16_t texture_targets[MAX_TEXTURES] = {};
+            std::uint16_t mode = GL_TRIANGLES;              ///< GLenum, 16 bits are enough for primitive and index types
+            std::uint16_t index_type = GL_UNSIGNED_INT;
+            GLsizei count = 0;
+            std::uint32_t index_offset = 0;
+            GLint base_vertex = 0;
+            std::uint32_t uniform_offset = 0;               ///< Into the recording buffer's uniform data.
+            std::uint32_t uniform_size = 0;                 ///< 0 = no per-draw uniform block.
+
+            /**
+             * @brief Binds @p texture to @p unit for this draw.
+             */
+            void set_texture(unsigned int unit, GLenum target, GLuint texture) noexcept {
+                if (unit < MAX_TEXTURES) {
+                    textures[unit] = texture;
+                    texture_targets[unit] = static_cast<std::uint16_t>(target);
+                }
+            }
+        };
+
+        static_assert(sizeof(DrawPacket) == 64, "DrawPacket should stay one cache line");
+
+        /**
+         * @brief Linear buffer of draw packets recorded by a single thread.
+         *
+         * Recording only appends to vectors owned by this buffer: no lock, no GL call. The
+         * capacity is kept from one frame to the next, so steady-state recording does not allocate.
+         */
+        class CommandBuffer {
+        public:
+            /**
+             * @brief Records a draw.
+             *
+             * @param sort_key Submission order (see RenderQueue::make_sort_key).
+             * @param program Shader program to draw with.
+             * @param mesh Mesh to draw.
+             * @param uniforms Per-draw uniform block data (std140), copied now. May be nullptr.
+             * @param uniform_size Size of @p uniforms, in bytes.
+             * @return The packet, to set textures on.
+             */
+            DrawPacket& draw(std::uint64_t sort_key, GLuint program, const Mesh& mesh, const void* uniforms = nullptr, std::uint32_t uniform_size = 0);
+
+            [[nodiscard]] std::size_t size() const noexcept;
+
+            /**
+             * @brief Forgets the recorded packets, keeping the memory.
+             */
+            void reset() noexcept;
+
+        private:
+            friend class RenderQueue;
+
+            std::vector<DrawPacket> packets_;
+            std::vector<std::uint8_t> uniforms_;
+        };
+
+        /**
+         * @brief Collects command buffers recorded on any thread and submits them sorted on the GL thread.
+         *
+         * Each recording thread (or job) acquires its own CommandBuffer and fills it without
+         * synchronization. execute(), on the GL thread, merges every buffer acquired since the
+         * last call, radix-sorts the packets by their 64-bit key, uploads all per-draw uniform
+         * blocks into one uniform buffer and issues the draws, skipping redundant program, VAO
+         * and texture binds.
+         *
+         * Per-draw uniforms are bound with glBindBufferRange at Config::uniform_binding; shaders
+         * read them from a std140 block bound to that point.
+         */
+        class RenderQueue {
+        public:
+            /**
+             * @brief Settings of a queue.
+             */
+            struct Config {
+                GLuint uniform_binding = 1;                 ///< Binding point of the per-draw uniform block (0 is the camera's).
+                std::size_t packets_per_buffer = 1024;      ///< Initial capacity of each command buffer.
+            };
+
+            /**
+             * @brief Statistics of the last execute().
+             */
+            struct Stats {
+                std::size_t draws = 0;
+                std::size_t program_changes = 0;
+                std::size_t vao_changes = 0;
+                std::size_t texture_changes = 0;
+                std::size_t uniform_bytes = 0;
+            };
+
+            RenderQueue();
+            explicit RenderQueue(const Config& config);
+            ~RenderQueue();
+
+            // No copy/move
+            RenderQueue(const RenderQueue&) = delete;
+            RenderQueue& operator=(const RenderQueue&) = delete;
+            RenderQueue(RenderQueue&&) = delete;
+            RenderQueue& operator=(RenderQueue&&) = delete;
+
+            /**
+             * @brief Hands out an empty command buffer for the current frame. Thread-safe.
+             *
+             * The buffer belongs to the caller until the next execute(); record into it from one thread only.
+             */
+            [[nodiscard]] CommandBuffer& acquire_command_buffer();
+
+            /**
+             * @brief Sorts and submits every packet recorded since the last call. GL thread only.
+             *
+             * All recording into acquired buffers must be finished.
+             */
+            void execute();
+
+            [[nodiscard]] const Stats& get_stats() const noexcept;
+
+            /**
+             * @brief Builds a sort key: layer first, then program, then material, then depth.
+             *
+             * @param layer Coarse pass order (opaque, transparent, UI...).
+             * @param program Program index or id (12 bits used).
+             * @param material Texture/mesh grouping (20 bits used).
+             * @param depth Normalized view depth in [0, 1] (24 bits); flip it for back-to-front.
+             */
+            [[nodiscard]] static std::uint64_t make_sort_key(std::uint8_t layer, std::uint32_t program, std::uint32_t material, float depth) noexcept;
+
+        private:
+            Config config_;
+
+            std::mutex mutex_;                                      ///< Guards the buffer lists.
+            std::vector<std::unique_ptr<CommandBuffer>> buffers_;   ///< Every buffer ever created.
+            std::vector<CommandBuffer*> free_;                      ///< Not acquired this frame.
+            std::vector<CommandBuffer*> acquired_;                  ///< Acquired since the last execute().
+            std::vector<CommandBuffer*> executing_;                 ///< Being submitted by execute().
+
+            struct SortEntry {
+                std::uint64_t key;
+                std::uint32_t buffer;
+                std::uint32_t packet;
+            };
+            std::vector<SortEntry> entries_;                        ///< Reused between frames.
+            std::vector<SortEntry> scratch_;
+            std::vector<std::uint32_t> uniform_offsets_;            ///< Per sorted entry, into staging_.
+            std::vector<std::uint8_t> staging_;
+
+            Buffer uniform_buffer_{ GL_UNIFORM_BUFFER };
+            GLint uniform_alignment_ = 0;
+            Stats stats_;
+        };
+
+    } // namespace Graphics
+} // namespace Gem
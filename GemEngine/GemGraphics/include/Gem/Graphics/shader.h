@@ -74,6 +74,17 @@ namespace Gem {
              */
             void set_path(const std::string& path);
 
+            /**
+             * @brief Adds a folder searched for #include "file" after the shader folder.
+             *
+             * Shader sources may include other files after their #version line. Each file is
+             * included once per shader; the engine's folder (GemVertexCompression.glsl...) is
+             * searched by default.
+             *
+             * @param path Specifies the path to the folder
+             */
+            void add_include_path(const std::string& path);
+
             /**
              * @brief Gets the shader program ID.
              *
@@ -142,6 +153,15 @@ namespace Gem {
              */
             std::string get_file_contents(const std::string& filename) const;
 
+            /**
+             * @brief Replaces the #include "file" lines of a source with the files' contents.
+             *
+             * @param source The shader source.
+             * @param included The files already included in this shader, which are skipped.
+             * @return The source with its includes expanded, line numbers kept with #line.
+             */
+            std::string resolve_includes(const std::string& source, std::vector<std::string>& included) const;
+
             /**
              * @brief Retrieves the uniform location from the map.
              *
@@ -155,6 +175,7 @@ namespace Gem {
             GLuint ID_ = 0;                             ///< OpenGL shader program ID.
             std::vector<GLuint> shaders_;               ///< Container for shader object IDs.
             std::string path_ = "resources/shaders/";   ///< Path to the shader folder.
+            std::vector<std::string> include_paths_ = { "../GemEngine/Assets/Shaders/" };  ///< Searched for #include after path_.
             std::unordered_map<std::string, GLint> uniform_locations_; ///< Map of uniform names to locations.
 
         };
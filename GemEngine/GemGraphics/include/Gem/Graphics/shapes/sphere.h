@@ -3,6 +3,10 @@
 #include <../../GemCore/include-protected/function_overload.h>
 #include <Gem/Graphics/buffer.h>
 #include <Gem/Graphics/vao.h>
+#include <Gem/Graphics/render_queue.h>
+#include <Gem/Graphics/async_loader.h>
+#include <Gem/Graphics/geometry_pool.h>
+#include <Gem/Graphics/vertex_compression.h>
 #include <vector>
 
 namespace Gem {
@@ -17,7 +21,21 @@ namespace Gem {
 
             public:
 
-                Sphere( float radius = 1., unsigned int latitudeSegments = 32, unsigned int longitudeSegments = 32);
+                Sphere( float radius = 1., unsigned int latitudeSegments = 32, unsigned int longitudeSegments = 32, VertexCompression compression = VertexCompression::None);
+
+                /**
+                 * @brief Constructs a Sphere whose geometry is generated and uploaded on the loader thread.
+                 * @param loader The loader to run the upload on. Nothing is drawn until is_ready() returns true.
+                 * @param compression How the vertices are stored on the GPU. The compressed formats add UVs.
+                 */
+                Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments, AsyncLoader& loader, VertexCompression compression = VertexCompression::None);
+
+                /**
+                 * @brief Constructs a Sphere stored in a GeometryPool, drawn with the pool's VAO.
+                 * @param pool The pool to allocate from. Must outlive the sphere.
+                 * @param compression How the vertices are stored on the GPU. The compressed formats add UVs.
+                 */
+                Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments, GeometryPool& pool, VertexCompression compression = VertexCompression::None);
                 ~Sphere();
 
                 /**
@@ -36,6 +54,28 @@ namespace Gem {
                 * @brief Renders the sphere.
                 */
                 void render() const;
+
+                /**
+                 * @brief Describes the sphere's geometry, to record it in a RenderQueue instead of calling render().
+                 */
+                [[nodiscard]] Mesh get_mesh() const noexcept;
+
+                /**
+                 * @brief Gets how the vertices are stored on the GPU.
+                 */
+                [[nodiscard]] VertexCompression get_vertex_compression() const noexcept;
+
+                /**
+                 * @brief Gets the bounds the positions are quantized in, for gem_decode_position() in the vertex shader.
+                 * Center 0 and extent 1 (no change) for uncompressed vertices.
+                 */
+                [[nodiscard]] const PositionBounds& get_position_bounds() const noexcept;
+
+                /**
+                 * @brief Checks if the sphere can be drawn, finishing its setup once an asynchronous upload has landed.
+                 * GL thread only. Always true for spheres built without a loader.
+                 */
+                bool is_ready();
                 
                 private:
                 
@@ -43,6 +83,16 @@ namespace Gem {
                                  * @brief Initializes OpenGL buffers for the sphere.
                                  */
                                 void initialize();
+
+                /**
+                 * @brief Creates and fills the VBO and EBO without touching any VAO (loader thread).
+                 */
+                void uploadBuffers();
+
+                /**
+                 * @brief Links the vertex attributes to the bound VAO.
+                 */
+                void linkAttributes();
                 
                 /**
                 * @brief Generates vertex and index data for the sphere.
@@ -54,13 +104,22 @@ namespace Gem {
                 unsigned int latitudeSegments_;
                 unsigned int longitudeSegments_;
 				unsigned int radius_;
+                VertexCompression compression_;
 
                 std::vector<GLfloat> vertices_;
                 std::vector<GLuint> indices_;
+                PositionBounds bounds_;                 ///< Quantization bounds of the positions, if compressed.
+                std::vector<std::byte> packed_;         ///< vertices_ in compression_'s format, uploaded instead of them when compressed.
 
                 Gem::Graphics::VAO VAO_;
                 Gem::Graphics::Buffer VBO_, EBO_;
 
+                UploadHandle upload_;   ///< Pending asynchronous upload, if any.
+                bool ready_ = true;     ///< VAO set up and buffers filled.
+
+                GeometryPool* pool_ = nullptr;  ///< Pool holding the geometry instead of VAO_, VBO_ and EBO_, if any.
+                MeshAllocation allocation_;     ///< Where the geometry is in pool_.
+
             };
 
         } // namespace Shapes
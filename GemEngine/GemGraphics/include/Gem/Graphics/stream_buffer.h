@@ -0,0 +1,135 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief Persistently mapped buffer for data rewritten every frame (uniforms, instance data...).
+         *
+         * The store is created once with glBufferStorage and mapped for the buffer's whole life
+         * (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT). It is split into frame_count regions:
+         * each frame bump-allocates from one region, writing straight into the mapping, while the
+         * GPU may still be reading the regions of the previous frames. next_frame() fences the
+         * region just filled and waits for the fence of the one it moves to, so the CPU only stalls
+         * when it gets more than frame_count - 1 frames ahead.
+         *
+         * Needs GL 4.4 or ARB_buffer_storage: check is_supported() before constructing one.
+         * Writes are reported to GLCapture (GL::mark_mapped_write), so captures replay them.
+         */
+        class StreamBuffer {
+        public:
+            /**
+             * @brief Space handed out by allocate(): valid until the region is reused, frame_count frames later.
+             */
+            struct Allocation {
+                void* data = nullptr;       ///< Where to write, in the mapping.
+                GLintptr offset = 0;        ///< Offset of the same bytes in the buffer (for bind_range(), draw offsets...).
+                GLsizeiptr size = 0;        ///< Size in bytes.
+
+                /**
+                 * @brief False if the allocation failed (the region was full).
+                 */
+                explicit operator bool() const noexcept { return data != nullptr; }
+            };
+
+            /**
+             * @brief Creates and maps the buffer.
+             *
+             * @param frame_size Bytes available per frame. Rounded up to the target's offset alignment.
+             * @param frame_count Number of regions, i.e. frames the CPU may get ahead of the GPU + 1.
+             * @param target Target the buffer is mostly bound to. Sets the default allocation alignment
+             *        (GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT for GL_UNIFORM_BUFFER...).
+             * @throws std::runtime_error if buffer storage is not supported or the mapping fails.
+             */
+            explicit StreamBuffer(GLsizeiptr frame_size, unsigned int frame_count = 3, GLenum target = GL_UNIFORM_BUFFER);
+
+            /**
+             * @brief Unmaps and deletes the buffer and the pending fences.
+             */
+            ~StreamBuffer();
+
+            StreamBuffer(const StreamBuffer&) = delete;
+            StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+            /**
+             * @brief Checks if the current context can create a StreamBuffer (GL 4.4 or ARB_buffer_storage).
+             */
+            [[nodiscard]] static bool is_supported() noexcept;
+
+            /**
+             * @brief Moves to the next region, waiting until the GPU is done with it.
+             *
+             * Call it once per frame, before the frame's first allocate(). Allocations from the
+             * previous frames stay readable by the commands already issued.
+             */
+            void next_frame();
+
+            /**
+             * @brief Reserves @p size bytes in the current region, aligned to the target's offset alignment.
+             *
+             * @return The allocation, or an empty one (logged) if the region has no room left.
+             */
+            [[nodiscard]] Allocation allocate(GLsizeiptr size);
+
+            /**
+             * @brief Reserves @p size bytes in the current region with an explicit alignment.
+             *
+             * @param alignment Alignment of the offset in bytes (a power of two).
+             */
+            [[nodiscard]] Allocation allocate(GLsizeiptr size, GLsizeiptr alignment);
+
+            /**
+             * @brief Allocates @p size bytes and copies @p data into them.
+             *
+             * @return The allocation, or an empty one if the region has no room left.
+             */
+            Allocation write(const void* data, GLsizeiptr size);
+
+            /**
+             * @brief Binds an allocation to an indexed binding point (glBindBufferRange).
+             *
+             * @param target The indexed target (GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER...).
+             * @param index The binding point index.
+             * @param allocation An allocation from this buffer.
+             */
+            void bind_range(GLenum target, GLuint index, const Allocation& allocation) const;
+
+            /**
+             * @brief Gets the buffer ID.
+             */
+            [[nodiscard]] GLuint get_ID() const noexcept;
+
+            /**
+             * @brief Gets the size of one region in bytes (after alignment).
+             */
+            [[nodiscard]] GLsizeiptr get_frame_size() const noexcept;
+
+            /**
+             * @brief Gets the number of regions.
+             */
+            [[nodiscard]] unsigned int get_frame_count() const noexcept;
+
+            /**
+             * @brief Gets the bytes allocated in the current region so far.
+             */
+            [[nodiscard]] GLsizeiptr get_used() const noexcept;
+
+        private:
+            GLuint ID_ = 0;                         ///< OpenGL buffer ID.
+            GLenum target_;                         ///< Target used to create and map the buffer.
+            std::byte* mapping_ = nullptr;          ///< Start of the persistent mapping (whole buffer).
+            GLsizeiptr frame_size_;                 ///< Size of one region, a multiple of alignment_.
+            GLsizeiptr alignment_ = 16;             ///< Default allocation alignment.
+            unsigned int frame_count_;              ///< Number of regions.
+            unsigned int frame_ = 0;                ///< Region allocated from.
+            GLsizeiptr used_ = 0;                   ///< Bytes allocated in the current region.
+            std::vector<GLsync> fences_;            ///< Per region: signaled when the GPU is done with it, or nullptr.
+        };
+
+    } // namespace Graphics
+} // namespace Gem
@@ -48,9 +48,17 @@ namespace Gem {
              */
             void generate_mipmaps() const override;
 
+            /**
+             * @brief Gets the texture target (GL_TEXTURE_1D).
+             */
+            [[nodiscard]] GLenum get_target() const noexcept override;
+
             /**
              * @brief Loads a texture from an image file.
              *
+             * With direct state access, an image of another size than the loaded one replaces
+             * the texture (see recreate()), so get_texture_ID() changes.
+             *
              * @param texture_name The name of the texture file (with extension).
              */
             void load_texture(const std::string& texture_name);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Gem/Graphics/textures/texture.h>
+#include <Gem/Graphics/async_loader.h>
 #include <stb_image.h>
 
 namespace Gem {
@@ -48,13 +49,32 @@ namespace Gem {
              */
             void generate_mipmaps() const override;
 
+            /**
+             * @brief Gets the texture target (GL_TEXTURE_2D).
+             */
+            [[nodiscard]] GLenum get_target() const noexcept override;
+
             /**
              * @brief Loads a texture from an image file.
              *
+             * With direct state access, an image of another size than the loaded one replaces
+             * the texture (see recreate()), so get_texture_ID() changes.
+             *
              * @param texture_name The name of the texture file (with extension).
              */
             void load_texture(const std::string& texture_name);
 
+            /**
+             * @brief Decodes and uploads a texture on the loader thread.
+             *
+             * Do not use or modify the texture until the handle is ready.
+             *
+             * @param texture_name The name of the texture file (with extension).
+             * @param loader The loader to run the upload on.
+             * @return Handle to poll or wait on before binding the texture.
+             */
+            UploadHandle load_texture(const std::string& texture_name, AsyncLoader& loader);
+
             /**
              * @brief Sets texture Min Filter.
              *
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Gem/Graphics/textures/texture.h>
+#include <Gem/Graphics/async_loader.h>
 #include <stb_image.h>
 #include <vector>
 
@@ -53,6 +54,11 @@ namespace Gem {
              */
             void generate_mipmaps() const override;
 
+            /**
+             * @brief Gets the texture target (GL_TEXTURE_2D_ARRAY).
+             */
+            [[nodiscard]] GLenum get_target() const noexcept override;
+
             /**
              * @brief Adds a texture to the array from an image file.
              *
@@ -60,6 +66,17 @@ namespace Gem {
              */
             void add_texture(const std::string& texture_name);
 
+            /**
+             * @brief Decodes and uploads a layer on the loader thread.
+             *
+             * Layers are added in submission order. Do not use or modify the array until the handle is ready.
+             *
+             * @param texture_name The name of the texture file (with extension).
+             * @param loader The loader to run the upload on.
+             * @return Handle to poll or wait on before sampling the new layer.
+             */
+            UploadHandle add_texture(const std::string& texture_name, AsyncLoader& loader);
+
             /**
              * @brief Sets texture Min Filter.
              *
@@ -49,6 +49,11 @@ namespace Gem {
              */
             void generate_mipmaps() const override;
 
+            /**
+             * @brief Gets the texture target (GL_TEXTURE_3D).
+             */
+            [[nodiscard]] GLenum get_target() const noexcept override;
+
             /**
              * @brief Loads a 3D texture from a set of image files.
              *
@@ -2,7 +2,10 @@
 
 #include <../../GemCore/include-protected/function_overload.h>
 #include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <utility>
+#include <vector>
 #include <iostream>
 
 namespace Gem {
@@ -88,6 +91,11 @@ namespace Gem {
              */
             virtual void set_wrap_r(GLint param);
 
+            /**
+             * @brief Gets the texture target (e.g., GL_TEXTURE_2D).
+             */
+            [[nodiscard]] virtual GLenum get_target() const noexcept = 0;
+
             /**
              * @brief Sets the path to the texture folder.
              *
@@ -106,15 +114,53 @@ namespace Gem {
 
             /**
              * @brief Generates the texture.
+             *
+             * Calls glCreateTextures with get_target() when the context has direct state access,
+             * glGenTextures otherwise.
              */
             virtual void generate();
 
+            /**
+             * @brief Sets texture parameters.
+             *
+             * With direct state access each one is a glTextureParameteri and nothing is bound;
+             * otherwise the texture is bound to unit 0 once around the glTexParameteri calls.
+             * The values are kept, so recreate() can set them again.
+             *
+             * @param parameters Pairs of parameter name and value (e.g., { GL_TEXTURE_MIN_FILTER, GL_LINEAR }).
+             */
+            void set_parameters(std::initializer_list<std::pair<GLenum, GLint>> parameters);
+
+            /**
+             * @brief Replaces the texture with a new one that has the same parameters.
+             *
+             * Immutable storage (glTextureStorage*) cannot be resized: this is how a texture
+             * loaded with direct state access changes size. The texture ID changes.
+             */
+            void recreate();
+
+            /**
+             * @brief Gets the number of levels of a full mipmap chain.
+             *
+             * @param size The largest dimension of the base level.
+             */
+            [[nodiscard]] static GLsizei get_mip_levels(GLuint size) noexcept;
+
         protected:
 
             GLuint texture_ID_ = 0;                     ///< OpenGL texture ID.
             bool is_initialized_ = false;               ///< Flag indicating if the texture has been initialized.
             std::string path_ = "resources/textures/";  ///< Path to the texture folder.
 
+        private:
+
+            /**
+             * @brief Applies @p count parameters to the texture, without storing them.
+             */
+            void apply_parameters(const std::pair<GLenum, GLint>* parameters, std::size_t count);
+
+            std::vector<std::pair<GLenum, GLint>> parameters_; ///< Every parameter set so far, for recreate().
+
         };
 
     } // namespace Graphics
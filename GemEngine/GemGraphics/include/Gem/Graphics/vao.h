@@ -5,6 +5,9 @@
 
 
 #include <Gem/Graphics/buffer.h>
+#include <Gem/Graphics/vertex_layout.h>
+
+#include <cstddef>
 
 namespace Gem {
     namespace Graphics {
@@ -32,7 +35,7 @@ namespace Gem {
             /**
              * @brief Generates the VAO.
              *
-             * Calls glGenVertexArrays to create a new OpenGL VAO.
+             * Calls glCreateVertexArrays when the context has direct state access, glGenVertexArrays otherwise.
              * Must be called before binding or linking attributes.
              */
             void generate();
@@ -55,8 +58,9 @@ namespace Gem {
             /**
              * @brief Links a VBO to the VAO using a specified layout.
              *
-             * Sets up the vertex attribute pointers and enables the vertex attribute array.
-             * The VBO must be bound before calling this method.
+             * Sets up the vertex attribute and enables it. With direct state access the VBO is attached
+             * to the binding point of the same index and nothing is bound; otherwise the VAO is bound
+             * (and stays bound) and glVertexAttribPointer is used.
              *
              * @param VBO The VBO to link.
              * @param layout The layout location of the attribute.
@@ -68,6 +72,42 @@ namespace Gem {
              */
             void link_attrib(const Buffer& VBO, GLuint layout, GLint numComponents, GLenum type, GLsizei stride, const void* offset, GLboolean normalized = GL_FALSE);
 
+            /**
+             * @brief Links every attribute of a compile-time vertex format to a VBO.
+             *
+             * @tparam Layout A VertexLayout: locations, formats, offsets and stride come from it.
+             * @param VBO The VBO holding the vertices.
+             * @param binding The vertex buffer binding point (direct state access only): one per VBO.
+             */
+            template <typename Layout>
+            void link_layout(const Buffer& VBO, GLuint binding = 0) {
+                link_attributes(VBO, Layout::stride, Layout::attributes.data(), Layout::attributes.size(), binding);
+            }
+
+            /**
+             * @brief Links attributes interleaved in one VBO.
+             *
+             * With direct state access the VBO is attached once to @p binding and every attribute
+             * reads from it; otherwise the VAO is bound (and stays bound) and glVertexAttribPointer
+             * is called for each attribute.
+             *
+             * @param VBO The VBO holding the vertices.
+             * @param stride The size of a vertex, in bytes.
+             * @param attributes The attributes.
+             * @param count The number of attributes.
+             * @param binding The vertex buffer binding point (direct state access only).
+             */
+            void link_attributes(const Buffer& VBO, GLsizei stride, const VertexAttribute* attributes, std::size_t count, GLuint binding = 0);
+
+            /**
+             * @brief Attaches the element (index) buffer to the VAO.
+             *
+             * With direct state access nothing is bound; otherwise the VAO and then the EBO are bound.
+             *
+             * @param EBO The element buffer.
+             */
+            void link_element_buffer(const Buffer& EBO);
+
             /**
              * @brief Deletes the VAO.
              *
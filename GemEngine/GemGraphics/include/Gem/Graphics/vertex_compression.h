@@ -0,0 +1,104 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+#include <Gem/Graphics/buffer.h>
+#include <Gem/Graphics/vao.h>
+#include <Gem/Graphics/vertex_layout.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief How a mesh's vertices are stored on the GPU.
+         *
+         * The compressed modes quantize positions to 16 bits across the mesh's bounds (see
+         * PositionBounds), store normals octahedral-encoded and add half-float UVs. The vertex
+         * shader decodes them with the functions of GemVertexCompression.glsl, given the shape's
+         * get_position_bounds() (see GemProject/src/default_compressed.vert).
+         */
+        enum class VertexCompression : std::uint8_t {
+            None,           ///< PositionNormalVertex: float position and normal, 24 bytes, no UV.
+            Octahedral16,   ///< CompressedVertex16: 16 bytes, normals in 2x16 bits.
+            Octahedral8     ///< CompressedVertex8: 12 bytes, normals in 2x8 bits (at most 0.6 degrees of error).
+        };
+
+        /**
+         * @brief Compressed vertex with 16-bit octahedral normals.
+         *
+         * The position's w is stored as 1, so the attribute can be read as a vec4.
+         */
+        using CompressedVertex16 = VertexLayout<
+            Attribute<VertexLocation::Position, Snorm16x4>,
+            Attribute<VertexLocation::Normal, Snorm16x2>,
+            Attribute<VertexLocation::TexCoord, Half2>>;
+
+        /**
+         * @brief Compressed vertex with 8-bit octahedral normals.
+         */
+        using CompressedVertex8 = VertexLayout<
+            Attribute<VertexLocation::Position, Snorm16x3>,
+            Attribute<VertexLocation::Normal, Snorm8x2>,
+            Attribute<VertexLocation::TexCoord, Half2>>;
+
+        /**
+         * @brief Box the quantized positions of a mesh span: position = center + quantized * extent.
+         *
+         * Pass both to gem_decode_position() in the vertex shader, or fold them into the model
+         * matrix (translate by center, then scale by extent) and read the quantized position as is.
+         */
+        struct PositionBounds {
+            std::array<GLfloat, 3> center = { 0.0f, 0.0f, 0.0f };
+            std::array<GLfloat, 3> extent = { 1.0f, 1.0f, 1.0f };  ///< Half size on each axis.
+        };
+
+        /**
+         * @brief Gets the size of a vertex stored with @p compression, in bytes.
+         */
+        [[nodiscard]] GLsizei get_vertex_stride(VertexCompression compression) noexcept;
+
+        /**
+         * @brief Links the attributes of @p compression's vertex format to a VAO (see VAO::link_layout()).
+         */
+        void link_vertex_format(VAO& VAO, const Buffer& VBO, VertexCompression compression);
+
+        /**
+         * @brief Computes the bounds of interleaved vertices whose first 3 floats are the position.
+         *
+         * @param vertices vertex_count vertices of stride floats each.
+         * @param vertex_count Number of vertices.
+         * @param stride Floats per vertex (6 for position + normal).
+         */
+        [[nodiscard]] PositionBounds compute_position_bounds(const GLfloat* vertices, std::size_t vertex_count, std::size_t stride = 6);
+
+        /**
+         * @brief Encodes a unit vector on the octahedron, unfolded to the square [-1, 1]^2.
+         */
+        [[nodiscard]] std::array<GLfloat, 2> encode_octahedral(GLfloat x, GLfloat y, GLfloat z) noexcept;
+
+        /**
+         * @brief Decodes encode_octahedral(), as gem_decode_normal() does in the shaders.
+         */
+        [[nodiscard]] std::array<GLfloat, 3> decode_octahedral(GLfloat u, GLfloat v) noexcept;
+
+        /**
+         * @brief Converts position + normal vertices (6 floats each) to @p compression's format.
+         *
+         * Normals are quantized to the octahedral code that decodes closest to them, not just
+         * the rounded one. VertexCompression::None returns the floats unchanged, without UVs.
+         *
+         * @param vertices vertex_count vertices: position then normal.
+         * @param texcoords vertex_count UVs (2 floats each), or nullptr for (0, 0).
+         * @param vertex_count Number of vertices.
+         * @param bounds Bounds the positions are quantized in, usually compute_position_bounds().
+         * @return The vertices, get_vertex_stride(compression) bytes each.
+         */
+        [[nodiscard]] std::vector<std::byte> compress_vertices(VertexCompression compression, const GLfloat* vertices, const GLfloat* texcoords,
+            std::size_t vertex_count, const PositionBounds& bounds);
+
+    } // namespace Graphics
+} // namespace Gem
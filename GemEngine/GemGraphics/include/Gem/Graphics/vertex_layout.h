@@ -0,0 +1,173 @@
+#pragma once
+
+#include <../../GemCore/include-protected/function_overload.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Gem {
+    namespace Graphics {
+
+        /**
+         * @brief Attribute locations shared by the engine's vertex formats and shaders.
+         *
+         * Shaders declare their inputs at these locations (layout(location = ...)). An input
+         * no format provides (the shapes have no TexCoord) reads the constant (0, 0, 0, 1).
+         */
+        namespace VertexLocation {
+            inline constexpr GLuint Position = 0;
+            inline constexpr GLuint TexCoord = 1;
+            inline constexpr GLuint Normal = 2;
+        } // namespace VertexLocation
+
+        /**
+         * @brief One attribute of a vertex format, as VAO::link_attributes() needs it.
+         */
+        struct VertexAttribute {
+            GLuint location = 0;                ///< Attribute location in the shaders.
+            GLint components = 0;               ///< Number of components (1 to 4, 4 for the packed 2_10_10_10 types).
+            GLenum type = GL_FLOAT;             ///< Component type.
+            GLboolean normalized = GL_FALSE;    ///< Integer components are mapped to [0, 1] or [-1, 1].
+            GLuint offset = 0;                  ///< Offset in the vertex, in bytes.
+        };
+
+        /**
+         * @brief How an attribute is stored: GL type, component count, normalization and size.
+         *
+         * Use the aliases below (Float3, Half2, Snorm16x4...). A VertexLayout checks that each
+         * attribute starts at a multiple of its alignment (its component size, 4 bytes for the
+         * packed types) and that the whole vertex is a multiple of 4 bytes, as vertex fetch expects.
+         */
+        template <GLenum Type, GLint Components, GLboolean Normalized, GLuint Size>
+        struct AttributeFormat {
+            static_assert(Components >= 1 && Components <= 4, "Attributes have 1 to 4 components");
+
+            static constexpr GLenum type = Type;
+            static constexpr GLint components = Components;
+            static constexpr GLboolean normalized = Normalized;
+            static constexpr GLuint size = Size;
+            static constexpr GLuint alignment = (Type == GL_INT_2_10_10_10_REV || Type == GL_UNSIGNED_INT_2_10_10_10_REV) ? 4 : Size / Components;
+        };
+
+        using Float1 = AttributeFormat<GL_FLOAT, 1, GL_FALSE, 4>;
+        using Float2 = AttributeFormat<GL_FLOAT, 2, GL_FALSE, 8>;
+        using Float3 = AttributeFormat<GL_FLOAT, 3, GL_FALSE, 12>;
+        using Float4 = AttributeFormat<GL_FLOAT, 4, GL_FALSE, 16>;
+        using Half2 = AttributeFormat<GL_HALF_FLOAT, 2, GL_FALSE, 4>;                              ///< See pack_half().
+        using Half4 = AttributeFormat<GL_HALF_FLOAT, 4, GL_FALSE, 8>;
+        using Snorm16x2 = AttributeFormat<GL_SHORT, 2, GL_TRUE, 4>;                                ///< [-1, 1], see pack_snorm16().
+        using Snorm16x3 = AttributeFormat<GL_SHORT, 3, GL_TRUE, 6>;
+        using Snorm16x4 = AttributeFormat<GL_SHORT, 4, GL_TRUE, 8>;
+        using Unorm16x2 = AttributeFormat<GL_UNSIGNED_SHORT, 2, GL_TRUE, 4>;                       ///< [0, 1], see pack_unorm16().
+        using Unorm16x4 = AttributeFormat<GL_UNSIGNED_SHORT, 4, GL_TRUE, 8>;
+        using Snorm8x2 = AttributeFormat<GL_BYTE, 2, GL_TRUE, 2>;                                  ///< [-1, 1], see pack_snorm8().
+        using Snorm8x4 = AttributeFormat<GL_BYTE, 4, GL_TRUE, 4>;
+        using Unorm8x4 = AttributeFormat<GL_UNSIGNED_BYTE, 4, GL_TRUE, 4>;                         ///< [0, 1], colors.
+        using Snorm10_10_10_2 = AttributeFormat<GL_INT_2_10_10_10_REV, 4, GL_TRUE, 4>;             ///< xyz in 10 bits, w in 2, see pack_snorm_10_10_10_2().
+        using Unorm10_10_10_2 = AttributeFormat<GL_UNSIGNED_INT_2_10_10_10_REV, 4, GL_TRUE, 4>;
+
+        /**
+         * @brief An attribute of a VertexLayout: a location and a format.
+         */
+        template <GLuint Location, typename Format>
+        struct Attribute {
+            static constexpr GLuint location = Location;
+            using format = Format;
+        };
+
+        /**
+         * @brief A vertex format described at compile time, attributes packed in order.
+         *
+         * Strides and offsets are derived from the formats, so vertex setup needs no hand-written
+         * sizeof arithmetic:
+         *
+         *     using MyVertex = VertexLayout<
+         *         Attribute<VertexLocation::Position, Float3>,
+         *         Attribute<VertexLocation::Normal, Snorm10_10_10_2>,
+         *         Attribute<VertexLocation::TexCoord, Half2>>;
+         *
+         *     VAO.link_layout<MyVertex>(VBO);
+         *
+         * A C++ struct filled for the layout can be checked against it with
+         * static_assert(sizeof(S) == MyVertex::stride) and MyVertex::offset<I> == offsetof(S, member).
+         */
+        template <typename... Attributes>
+        struct VertexLayout {
+            static_assert(sizeof...(Attributes) > 0, "A vertex layout needs at least one attribute");
+
+            static constexpr std::size_t count = sizeof...(Attributes);
+            static constexpr GLsizei stride = static_cast<GLsizei>((Attributes::format::size + ...));
+
+            static constexpr std::array<VertexAttribute, count> attributes = [] {
+                std::array<VertexAttribute, count> result{};
+                std::size_t index = 0;
+                GLuint offset = 0;
+                ((result[index++] = { Attributes::location, Attributes::format::components, Attributes::format::type, Attributes::format::normalized, offset },
+                    offset += Attributes::format::size), ...);
+                return result;
+            }();
+
+            static_assert(stride % 4 == 0, "A vertex must be a multiple of 4 bytes");
+            static_assert([] {
+                constexpr GLuint alignments[] = { Attributes::format::alignment... };
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (attributes[i].offset % alignments[i] != 0) {
+                        return false;
+                    }
+                }
+                return true;
+            }(), "An attribute of a vertex layout is not aligned to its component size");
+
+            static_assert([] {
+                for (std::size_t i = 0; i < count; ++i) {
+                    for (std::size_t j = i + 1; j < count; ++j) {
+                        if (attributes[i].location == attributes[j].location) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }(), "Two attributes of a vertex layout share a location");
+
+            /**
+             * @brief Offset of the attribute @p I in the vertex, in bytes.
+             */
+            template <std::size_t I>
+            static constexpr GLuint offset = attributes[I].offset;
+        };
+
+        /**
+         * @brief The built-in shapes' format: position and normal, 24 bytes.
+         */
+        using PositionNormalVertex = VertexLayout<
+            Attribute<VertexLocation::Position, Float3>,
+            Attribute<VertexLocation::Normal, Float3>>;
+
+        /**
+         * @brief Converts a float to a half float (round to nearest even, overflow to infinity).
+         */
+        [[nodiscard]] std::uint16_t pack_half(float value) noexcept;
+
+        /**
+         * @brief Converts a value in [-1, 1] (clamped) to a normalized 16-bit integer.
+         */
+        [[nodiscard]] std::int16_t pack_snorm16(float value) noexcept;
+
+        /**
+         * @brief Converts a value in [0, 1] (clamped) to a normalized 16-bit unsigned integer.
+         */
+        [[nodiscard]] std::uint16_t pack_unorm16(float value) noexcept;
+
+        /**
+         * @brief Converts a value in [-1, 1] (clamped) to a normalized 8-bit integer.
+         */
+        [[nodiscard]] std::int8_t pack_snorm8(float value) noexcept;
+
+        /**
+         * @brief Packs a vector in [-1, 1] (clamped) for GL_INT_2_10_10_10_REV (Snorm10_10_10_2).
+         */
+        [[nodiscard]] std::uint32_t pack_snorm_10_10_10_2(float x, float y, float z, float w = 0.0f) noexcept;
+
+    } // namespace Graphics
+} // namespace Gem
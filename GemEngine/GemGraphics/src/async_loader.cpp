@@ -0,0 +1,247 @@
+#include <Gem/Graphics/async_loader.h>
+#include <Gem/Core/GemEngine.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
+
+#include <exception>
+#include <stdexcept>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            Metrics::Counter loader_uploads_("loader.uploads");
+
+            constexpr GLuint64 WAIT_SLICE_NS = 1000000;     // 1 ms per glClientWaitSync in wait()
+
+            bool isSignaled(GLenum result) noexcept {
+                return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+            }
+
+        } // namespace
+
+        //--------------------------------------------------------------------------
+        // UploadHandle
+        //--------------------------------------------------------------------------
+        UploadHandle::UploadHandle(std::shared_ptr<State> state) noexcept
+            : state_(std::move(state)) {
+        }
+
+        bool UploadHandle::is_ready() const {
+            if (!state_) {
+                return true;
+            }
+
+            std::lock_guard<std::mutex> lock(state_->mutex);
+            if (!state_->uploaded) {
+                return false;
+            }
+            if (!state_->fence) {
+                return true;
+            }
+
+            if (!isSignaled(GL::client_wait_sync(state_->fence, 0, 0))) {
+                return false;
+            }
+            GL::delete_sync(state_->fence);
+            state_->fence = nullptr;
+            return true;
+        }
+
+        void UploadHandle::wait() const {
+            if (!state_) {
+                return;
+            }
+
+            GEM_PROFILE_ZONE("UploadHandle::wait");
+
+            std::unique_lock<std::mutex> lock(state_->mutex);
+            state_->uploaded_condition.wait(lock, [this]() { return state_->uploaded; });
+            if (!state_->fence) {
+                return;
+            }
+
+            GLenum result = GL_TIMEOUT_EXPIRED;
+            while (!isSignaled(result)) {
+                result = GL::client_wait_sync(state_->fence, 0, WAIT_SLICE_NS);
+                if (result == GL_WAIT_FAILED) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "UploadHandle: glClientWaitSync failed.");
+                    break;
+                }
+            }
+            GL::delete_sync(state_->fence);
+            state_->fence = nullptr;
+        }
+
+        bool UploadHandle::is_valid() const noexcept {
+            return state_ != nullptr;
+        }
+
+        //--------------------------------------------------------------------------
+        // AsyncLoader
+        //--------------------------------------------------------------------------
+        AsyncLoader::AsyncLoader() {
+            if (GemEngine::getInstance().isHeadless()) {
+                if (!EGLManager::getInstance().createSharedContext(egl_context_)) {
+                    throw std::runtime_error("Failed to create the loader's shared EGL context!");
+                }
+            }
+            else {
+                GLFWwindow* share = GLFW::get_current_context();
+                if (!share) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "AsyncLoader: no OpenGL context is current on this thread.");
+                    throw std::runtime_error("AsyncLoader needs a current OpenGL context!");
+                }
+
+                // Never shown: it only carries the shared context
+                GLFW::window_hint(GLFW_VISIBLE, GLFW_FALSE);
+                window_ = GLFW::create_window(1, 1, "GemEngine loader", share);
+                GLFW::window_hint(GLFW_VISIBLE, GLFW_TRUE);
+
+                if (!window_) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "AsyncLoader: failed to create the shared context window.");
+                    throw std::runtime_error("Failed to create the loader's shared context!");
+                }
+            }
+
+            thread_ = std::thread(&AsyncLoader::loaderMain, this);
+            GEM_LOG_DEBUG(Logger::Channel::Graphics, "AsyncLoader: started.");
+        }
+
+        AsyncLoader::~AsyncLoader() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                running_ = false;
+            }
+            condition_.notify_one();
+            thread_.join();
+
+            // Created on this thread, destroyed on it too (GLFW requires the main thread)
+            if (window_) {
+                GLFW::destroy_window(window_);
+                window_ = nullptr;
+            }
+            EGLManager::getInstance().destroySharedContext(egl_context_);
+            GEM_LOG_DEBUG(Logger::Channel::Graphics, "AsyncLoader: stopped.");
+        }
+
+        UploadHandle AsyncLoader::submit(std::function<void()> upload) {
+            auto state = std::make_shared<UploadHandle::State>();
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                requests_.push_back({ std::move(upload), state });
+            }
+            condition_.notify_one();
+            return UploadHandle(std::move(state));
+        }
+
+        std::size_t AsyncLoader::get_pending_count() const noexcept {
+            return pending_.load(std::memory_order_relaxed);
+        }
+
+        void AsyncLoader::loaderMain() {
+            Profiler::setThreadName("Asset loader");
+
+            bool current = true;
+            if (window_) {
+                GLFW::make_context_current(window_);
+            }
+            else {
+                current = EGLManager::getInstance().makeCurrent(egl_context_);
+            }
+            if (!current) {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "AsyncLoader: cannot make the shared context current, uploads will fail.");
+            }
+
+            while (true) {
+                Request request;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    condition_.wait(lock, [this]() { return !running_ || !requests_.empty(); });
+                    if (requests_.empty()) {
+                        break;  // Stopped and drained
+                    }
+                    request = std::move(requests_.front());
+                    requests_.pop_front();
+                }
+
+                {
+                    GEM_PROFILE_ZONE("AsyncLoader upload");
+                    try {
+                        request.upload();
+                    }
+                    catch (const std::exception& e) {
+                        GEM_LOG_ERROR(Logger::Channel::Graphics, "AsyncLoader: upload threw an exception: {}", e.what());
+                    }
+                    catch (...) {
+                        GEM_LOG_ERROR(Logger::Channel::Graphics, "AsyncLoader: upload threw an unknown exception.");
+                    }
+                }
+
+                // Flushed so the fence signals without anyone waiting in this context
+                GLsync fence = GL::fence_sync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                GL::flush();
+                {
+                    std::lock_guard<std::mutex> lock(request.state->mutex);
+                    request.state->fence = fence;
+                    request.state->uploaded = true;
+                }
+                request.state->uploaded_condition.notify_all();
+
+                in_flight_.push_back(std::move(request.state));
+                pending_.fetch_sub(1, std::memory_order_relaxed);
+                loader_uploads_.add();
+                retire();
+            }
+
+            // Everything has landed once finish() returns: handles still held become ready
+            GL::finish();
+            for (const auto& state : in_flight_) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (state->fence) {
+                    GL::delete_sync(state->fence);
+                    state->fence = nullptr;
+                }
+            }
+            in_flight_.clear();
+
+            if (window_) {
+                GLFW::make_context_current(nullptr);
+            }
+            else {
+                EGLManager::getInstance().makeCurrent(EGLManager::SharedContext{});
+            }
+        }
+
+        void AsyncLoader::retire() {
+            for (std::size_t i = 0; i < in_flight_.size();) {
+                UploadHandle::State& state = *in_flight_[i];
+
+                bool done = false;
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    if (!state.fence) {
+                        done = true;    // Seen signaled through a handle
+                    }
+                    else if (in_flight_[i].use_count() == 1) {
+                        GL::delete_sync(state.fence);   // No handle left; deletion is deferred until it signals
+                        state.fence = nullptr;
+                        done = true;
+                    }
+                }
+
+                if (done) {
+                    in_flight_[i] = std::move(in_flight_.back());
+                    in_flight_.pop_back();
+                }
+                else {
+                    ++i;
+                }
+            }
+        }
+
+    } // namespace Graphics
+} // namespace Gem
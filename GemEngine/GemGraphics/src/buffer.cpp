@@ -1,8 +1,18 @@
 #include <Gem/Graphics/buffer.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
 
 namespace Gem {
     namespace Graphics {
 
+        namespace {
+
+            Metrics::Counter buffer_uploads_("gl.buffer_uploads");
+            Metrics::Counter buffer_upload_bytes_("gl.buffer_upload_bytes");
+            Metrics::Histogram buffer_upload_size_("gl.buffer_upload_size");
+
+        } // namespace
+
         // Constructor
         Buffer::Buffer(GLenum type) noexcept
             : type_(type) {
@@ -17,16 +27,21 @@ namespace Gem {
         // Generate the buffer object
         void Buffer::generate() {
             if (!is_generated_) {
-                GL::gen_buffers(1, &ID_);
+                if (GL::has_direct_state_access()) {
+                    GL::create_buffers(1, &ID_);    // A complete object: named calls work without a first bind
+                }
+                else {
+                    GL::gen_buffers(1, &ID_);
+                }
                 if (ID_ == 0) {
-                    std::cerr << "Failed to generate buffer." << std::endl;
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: failed to generate the buffer.");
                 }
                 else {
                     is_generated_ = true;
                 }
             }
             else {
-                std::cerr << "Buffer already generated." << std::endl;
+                GEM_LOG_WARNING(Logger::Channel::Graphics, "Buffer: already generated.");
             }
         }
 
@@ -36,7 +51,7 @@ namespace Gem {
                 GL::bind_buffer(type_, ID_);
             }
             else {
-                std::cerr << "Buffer not generated; cannot bind." << std::endl;
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: not generated, cannot bind.");
             }
         }
 
@@ -48,12 +63,78 @@ namespace Gem {
         // Upload data to the buffer
         void Buffer::set_data(GLsizeiptr size, const void* data, GLenum usage) {
             if (is_generated_) {
-                GL::bind_buffer(type_, ID_);
-                GL::buffer_data(type_, size, data, usage);
-                // Do not unbind here
+                if (GL::has_direct_state_access()) {
+                    GL::named_buffer_data(ID_, size, data, usage);  // Leaves the bindings alone
+                }
+                else {
+                    GL::bind_buffer(type_, ID_);
+                    GL::buffer_data(type_, size, data, usage);
+                    // Do not unbind here
+                }
+
+                buffer_uploads_.add();
+                buffer_upload_bytes_.add(static_cast<std::uint64_t>(size));
+                buffer_upload_size_.record(static_cast<std::uint64_t>(size));
+            }
+            else {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: not generated, cannot set data.");
+            }
+        }
+
+        // Create an immutable data store
+        void Buffer::set_storage(GLsizeiptr size, const void* data, GLbitfield flags) {
+            if (is_generated_) {
+                if (GL::has_direct_state_access()) {
+                    GL::named_buffer_storage(ID_, size, data, flags);
+                }
+                else {
+                    GL::bind_buffer(type_, ID_);
+                    GL::buffer_storage(type_, size, data, flags);
+                }
+
+                buffer_uploads_.add();
+                buffer_upload_bytes_.add(static_cast<std::uint64_t>(size));
+                buffer_upload_size_.record(static_cast<std::uint64_t>(size));
+            }
+            else {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: not generated, cannot set storage.");
+            }
+        }
+
+        // Update part of the data store
+        void Buffer::set_sub_data(GLintptr offset, GLsizeiptr size, const void* data) {
+            if (is_generated_) {
+                if (GL::has_direct_state_access()) {
+                    GL::named_buffer_sub_data(ID_, offset, size, data);
+                }
+                else {
+                    GL::bind_buffer(GL_COPY_WRITE_BUFFER, ID_);   // Leaves the VAO's element buffer alone
+                    GL::buffer_sub_data(GL_COPY_WRITE_BUFFER, offset, size, data);
+                }
+
+                buffer_uploads_.add();
+                buffer_upload_bytes_.add(static_cast<std::uint64_t>(size));
+                buffer_upload_size_.record(static_cast<std::uint64_t>(size));
+            }
+            else {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: not generated, cannot set sub data.");
+            }
+        }
+
+        // Copy a range of another buffer
+        void Buffer::copy_sub_data(const Buffer& source, GLintptr source_offset, GLintptr offset, GLsizeiptr size) {
+            if (is_generated_ && source.is_generated_) {
+                if (GL::has_direct_state_access()) {
+                    GL::copy_named_buffer_sub_data(source.ID_, ID_, source_offset, offset, size);
+                }
+                else {
+                    GL::bind_buffer(GL_COPY_READ_BUFFER, source.ID_);
+                    GL::bind_buffer(GL_COPY_WRITE_BUFFER, ID_);
+                    GL::copy_buffer_sub_data(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, source_offset, offset, size);
+                }
             }
             else {
-                std::cerr << "Buffer not generated; cannot set data." << std::endl;
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: not generated, cannot copy data.");
             }
         }
 
@@ -82,7 +163,7 @@ namespace Gem {
                 type_ = type;
             }
             else {
-                std::cerr << "Cannot change buffer type after generation." << std::endl;
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Buffer: cannot change the type after generation.");
             }
         }
 
@@ -1,5 +1,6 @@
 #include <Gem/Graphics/camera.h>
-#include <iostream>
+#include <Gem/Core/Logger.h>
+#include <cstring>
 
 namespace Gem {
 
@@ -12,7 +13,7 @@ namespace Gem {
         }
 
         // Constructor with position
-        Camera::Camera(const glm::vec3& position) noexcept : position_(position) {
+        Camera::Camera(const glm::vec3& position) noexcept : position_(position), previous_position_(position) {
             init();
         }
 
@@ -22,20 +23,20 @@ namespace Gem {
         }
 
         // Constructor with position and FOV
-        Camera::Camera(const glm::vec3& position, float fov) noexcept : position_(position), fov_(fov) {
+        Camera::Camera(const glm::vec3& position, float fov) noexcept : position_(position), previous_position_(position), fov_(fov) {
             init();
         }
 
         // Constructor with full customization
         Camera::Camera(const glm::vec3& position, float fov, float speed, float sensitivity) noexcept 
-            : position_(position), fov_(fov), speed_(speed), sensitivity_(sensitivity) {
+            : position_(position), previous_position_(position), fov_(fov), speed_(speed), sensitivity_(sensitivity) {
             init();
         }
 
         // Initialize the camera
         void Camera::init() {
             if (!are_attributes_set()) {
-                std::cerr << "ERROR::Camera::init: Camera attributes not properly set before initialization." << std::endl;
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "Camera::init: camera attributes not properly set before initialization.");
                 throw std::runtime_error("Camera attributes not set.");
             }
 
@@ -48,10 +49,27 @@ namespace Gem {
 				shader_->link_program(); // Link shaders into a shader program
 			}
 			catch (const std::exception& e) {
-				std::cerr << "Shader compilation/linking failed: " << e.what() << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Graphics, "Camera::init: shader compilation/linking failed: {}", e.what());
 				exit(EXIT_FAILURE); // Exit if shaders fail to compile/link
 			}
 
+			// Stream the matrices through a persistent mapping when the context allows it
+			if (StreamBuffer::is_supported()) {
+				try {
+					matrices_stream_ = std::make_unique<StreamBuffer>(sizeof(glm::mat4) * 2);
+				}
+				catch (const std::exception& e) {
+					GEM_LOG_WARNING(Logger::Channel::Graphics, "Camera: {} Falling back to glBufferSubData.", e.what());
+				}
+			}
+
+			// Bind the uniform block in the shader to the binding point
+			shader_->bind_uniform_block("Matrices", matrices_binding_point_);
+
+			if (matrices_stream_) {
+				return; // Bound per frame by update_matrices()
+			}
+
 			// Generate the buffer
 			matrices_ubo_.generate();
 
@@ -62,13 +80,10 @@ namespace Gem {
 			matrices_ubo_.set_data(sizeof(glm::mat4) * 2, nullptr, GL_DYNAMIC_DRAW);
 
 			// Bind the buffer base to the binding point
-			glBindBufferBase(GL_UNIFORM_BUFFER, matrices_binding_point_, matrices_ubo_.get_ID());
+			GL::bind_buffer_base(GL_UNIFORM_BUFFER, matrices_binding_point_, matrices_ubo_.get_ID());
 
 			// Unbind the buffer
 			matrices_ubo_.unbind();
-
-			// Bind the uniform block in the shader to the binding point
-			shader_->bind_uniform_block("Matrices", matrices_binding_point_);
         }
 
         // Check if attributes are set
@@ -84,23 +99,35 @@ namespace Gem {
         }
 
         // Update and send matrices to the shader
-        void Camera::update_matrices() const {
+        void Camera::update_matrices(const glm::vec3& eye) {
 			// Calculate view matrix
-			glm::mat4 view = glm::lookAt(position_, position_ + orientation_, up_);
+			glm::mat4 view = glm::lookAt(eye, eye + orientation_, up_);
 
 			// Calculate projection matrix
 			glm::mat4 projection = glm::perspective(glm::radians(fov_), static_cast<float>(width_) / height_, near_plane_, far_plane_);
 
+			if (matrices_stream_) {
+				// Write both matrices into this frame's region and point the binding at them
+				matrices_stream_->next_frame();
+				StreamBuffer::Allocation matrices = matrices_stream_->allocate(sizeof(glm::mat4) * 2);
+				if (matrices) {
+					std::memcpy(matrices.data, glm::value_ptr(projection), sizeof(glm::mat4));
+					std::memcpy(static_cast<std::byte*>(matrices.data) + sizeof(glm::mat4), glm::value_ptr(view), sizeof(glm::mat4));
+					matrices_stream_->bind_range(GL_UNIFORM_BUFFER, matrices_binding_point_, matrices);
+				}
+				return;
+			}
+
 			// Update the UBO with the matrices using the Buffer class
 
 			// Bind the buffer
 			matrices_ubo_.bind();
 
 			// Update the projection matrix (offset 0)
-			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(projection));
+			GL::buffer_sub_data(GL_UNIFORM_BUFFER, 0, sizeof(glm::mat4), glm::value_ptr(projection));
 
 			// Update the view matrix (offset sizeof(mat4))
-			glBufferSubData(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(view));
+			GL::buffer_sub_data(GL_UNIFORM_BUFFER, sizeof(glm::mat4), sizeof(glm::mat4), glm::value_ptr(view));
 
 			// Unbind the buffer
 			matrices_ubo_.unbind();
@@ -219,6 +246,7 @@ namespace Gem {
         // Set camera position
         void Camera::set_position(const glm::vec3& position) noexcept {
             position_ = position;
+            previous_position_ = position; // Teleport: nothing to interpolate
         }
 
         // Set movement speed
@@ -257,7 +285,21 @@ namespace Gem {
             process_inputs(window, deltaTime);
             
             // Update view and projection matrices
-            update_matrices();
+            update_matrices(position_);
+        }
+
+        // Fixed simulation step
+        void Camera::fixed_update(float step) {
+            previous_position_ = position_;
+            process_keyboard_input(step);
+        }
+
+        // Per-frame update with the interpolated position
+        void Camera::update_interpolated(GLFWwindow* window, float alpha) {
+            // Mouse look is applied every frame; it does not depend on the time step
+            process_mouse_input(window);
+
+            update_matrices(previous_position_ + (position_ - previous_position_) * alpha);
         }
 
         // Equality operator
@@ -0,0 +1,327 @@
+#include <Gem/Graphics/geometry_pool.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
+
+#include <algorithm>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            Metrics::Counter geometry_compactions_("geometry.compactions");
+            Metrics::Counter geometry_copy_bytes_("geometry.copy_bytes");     // Moved by compact()
+
+            /**
+             * Copies ranges from one buffer to another, merging the ones that are contiguous in both.
+             * Moves are (source, destination, size) in bytes, sorted by source.
+             */
+            struct CopyBatch {
+                Buffer& destination;
+                const Buffer& source;
+                GLintptr from = 0;
+                GLintptr to = 0;
+                GLsizeiptr size = 0;
+                GLsizeiptr total = 0;
+
+                void add(GLintptr source_offset, GLintptr destination_offset, GLsizeiptr bytes) {
+                    if (size > 0 && source_offset == from + size && destination_offset == to + size) {
+                        size += bytes;
+                        return;
+                    }
+                    flush();
+                    from = source_offset;
+                    to = destination_offset;
+                    size = bytes;
+                }
+
+                void flush() {
+                    if (size > 0) {
+                        destination.copy_sub_data(source, from, to, size);
+                        total += size;
+                        size = 0;
+                    }
+                }
+            };
+
+        } // namespace
+
+        //--------------------------------------------------------------------------
+        // GeometryPool
+        //--------------------------------------------------------------------------
+        GeometryPool::GeometryPool()
+            : GeometryPool(Config{}) {
+        }
+
+        GeometryPool::GeometryPool(const Config& config)
+            : config_(config),
+            vertex_allocator_(config.vertex_capacity),
+            index_allocator_(config.index_capacity) {
+
+            create_buffers(vertex_buffer_, index_buffer_);
+            vao_.generate();
+            link_vao();
+
+            GEM_LOG_DEBUG(Logger::Channel::Graphics, "GeometryPool: {} vertices of {} bytes, {} indices.",
+                config_.vertex_capacity, config_.vertex_stride, config_.index_capacity);
+        }
+
+        GeometryPool::~GeometryPool() {
+            for (Retired& retired : retiring_) {
+                GL::delete_sync(retired.fence);
+            }
+            // The buffers and the VAO delete themselves
+        }
+
+        MeshAllocation GeometryPool::allocate(std::uint32_t vertex_count, std::uint32_t index_count) {
+            OffsetAllocator::Allocation vertices = vertex_allocator_.allocate(vertex_count);
+            OffsetAllocator::Allocation indices = index_allocator_.allocate(index_count);
+
+            if ((!vertices || !indices) && config_.compact_when_fragmented
+                && vertex_allocator_.get_free_size() + vertex_allocator_.get_allocation_size(vertices) >= vertex_count
+                && index_allocator_.get_free_size() + index_allocator_.get_allocation_size(indices) >= index_count) {
+                // Enough room overall, only not in one piece
+                vertex_allocator_.free(vertices);
+                index_allocator_.free(indices);
+                compact();
+
+                vertices = vertex_allocator_.allocate(vertex_count);
+                indices = index_allocator_.allocate(index_count);
+            }
+
+            if (!vertices || !indices) {
+                vertex_allocator_.free(vertices);
+                index_allocator_.free(indices);
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "GeometryPool: no room for {} vertices and {} indices ({} and {} free).",
+                    vertex_count, index_count, vertex_allocator_.get_free_size(), index_allocator_.get_free_size());
+                return {};
+            }
+
+            std::uint32_t id = 0;
+            if (!free_entries_.empty()) {
+                id = free_entries_.back();
+                free_entries_.pop_back();
+            }
+            else {
+                id = static_cast<std::uint32_t>(entries_.size());
+                entries_.emplace_back();
+            }
+
+            Entry& entry = entries_[id];
+            entry.vertices = vertices;
+            entry.indices = indices;
+            entry.vertex_count = vertex_count;
+            entry.index_count = index_count;
+            entry.live = true;
+            meshes_++;
+
+            return { id };
+        }
+
+        MeshAllocation GeometryPool::upload(const void* vertices, std::uint32_t vertex_count, const GLuint* indices, std::uint32_t index_count) {
+            MeshAllocation mesh = allocate(vertex_count, index_count);
+            if (mesh) {
+                write(mesh, vertices, indices);
+            }
+            return mesh;
+        }
+
+        void GeometryPool::write(MeshAllocation mesh, const void* vertices, const GLuint* indices) {
+            const Entry* entry = find(mesh);
+            if (!entry) {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "GeometryPool: write() to an invalid mesh.");
+                return;
+            }
+
+            const GLsizeiptr stride = config_.vertex_stride;
+            vertex_buffer_->set_sub_data(static_cast<GLintptr>(entry->vertices.offset) * stride, static_cast<GLsizeiptr>(entry->vertex_count) * stride, vertices);
+            index_buffer_->set_sub_data(static_cast<GLintptr>(entry->indices.offset) * sizeof(GLuint), static_cast<GLsizeiptr>(entry->index_count) * sizeof(GLuint), indices);
+        }
+
+        void GeometryPool::free(MeshAllocation mesh) {
+            if (!find(mesh)) {
+                return;
+            }
+
+            Entry& entry = entries_[mesh.id];
+            pending_.push_back({ entry.vertices, entry.indices });   // Draws in flight may still read them
+            entry = Entry{};
+            free_entries_.push_back(mesh.id);
+            meshes_--;
+        }
+
+        void GeometryPool::next_frame() {
+            if (!pending_.empty()) {
+                Retired& retired = retiring_.emplace_back();
+                retired.fence = GL::fence_sync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                retired.ranges.swap(pending_);
+            }
+
+            // Fences signal in order: stop at the first the GPU has not reached
+            while (!retiring_.empty()) {
+                Retired& retired = retiring_.front();
+                GLenum result = GL::client_wait_sync(retired.fence, 0, 0);
+                if (result == GL_TIMEOUT_EXPIRED) {
+                    break;
+                }
+
+                for (const Ranges& ranges : retired.ranges) {
+                    vertex_allocator_.free(ranges.vertices);
+                    index_allocator_.free(ranges.indices);
+                }
+                GL::delete_sync(retired.fence);
+                retiring_.pop_front();
+            }
+        }
+
+        bool GeometryPool::compact() {
+            GEM_PROFILE_ZONE("GeometryPool::compact");
+
+            // Ranges waiting for the GPU are only read from the old buffers
+            for (Retired& retired : retiring_) {
+                GL::delete_sync(retired.fence);
+            }
+            retiring_.clear();
+            pending_.clear();
+
+            std::vector<std::uint32_t> live;
+            live.reserve(meshes_);
+            for (std::uint32_t id = 0; id < entries_.size(); ++id) {
+                if (entries_[id].live) {
+                    live.push_back(id);
+                }
+            }
+
+            std::unique_ptr<Buffer> vertex_buffer;
+            std::unique_ptr<Buffer> index_buffer;
+            create_buffers(vertex_buffer, index_buffer);
+
+            vertex_allocator_.reset();
+            index_allocator_.reset();
+
+            // Allocating in the old order from empty allocators packs the meshes without reordering them,
+            // so neighbours stay neighbours and their copies merge
+            const GLsizeiptr stride = config_.vertex_stride;
+            CopyBatch vertex_copies{ *vertex_buffer, *vertex_buffer_ };
+            std::sort(live.begin(), live.end(), [this](std::uint32_t a, std::uint32_t b) { return entries_[a].vertices.offset < entries_[b].vertices.offset; });
+            for (std::uint32_t id : live) {
+                Entry& entry = entries_[id];
+                OffsetAllocator::Allocation vertices = vertex_allocator_.allocate(entry.vertex_count);
+                vertex_copies.add(static_cast<GLintptr>(entry.vertices.offset) * stride, static_cast<GLintptr>(vertices.offset) * stride, static_cast<GLsizeiptr>(entry.vertex_count) * stride);
+                entry.vertices = vertices;
+            }
+            vertex_copies.flush();
+
+            CopyBatch index_copies{ *index_buffer, *index_buffer_ };
+            std::sort(live.begin(), live.end(), [this](std::uint32_t a, std::uint32_t b) { return entries_[a].indices.offset < entries_[b].indices.offset; });
+            for (std::uint32_t id : live) {
+                Entry& entry = entries_[id];
+                OffsetAllocator::Allocation indices = index_allocator_.allocate(entry.index_count);
+                index_copies.add(static_cast<GLintptr>(entry.indices.offset) * sizeof(GLuint), static_cast<GLintptr>(indices.offset) * sizeof(GLuint), static_cast<GLsizeiptr>(entry.index_count) * sizeof(GLuint));
+                entry.indices = indices;
+            }
+            index_copies.flush();
+
+            // The old buffers are deleted here; GL keeps them until the commands reading them are done
+            vertex_buffer_ = std::move(vertex_buffer);
+            index_buffer_ = std::move(index_buffer);
+            link_vao();
+
+            compactions_++;
+            geometry_compactions_.add();
+            geometry_copy_bytes_.add(static_cast<std::uint64_t>(vertex_copies.total + index_copies.total));
+            GEM_LOG_DEBUG(Logger::Channel::Graphics, "GeometryPool: compacted {} meshes ({} bytes copied).", live.size(), vertex_copies.total + index_copies.total);
+            return !live.empty();
+        }
+
+        Mesh GeometryPool::get_mesh(MeshAllocation mesh, GLenum mode) const noexcept {
+            Mesh result;
+            const Entry* entry = find(mesh);
+            if (!entry) {
+                return result;
+            }
+
+            result.vao = vao_.get_ID();
+            result.mode = mode;
+            result.count = static_cast<GLsizei>(entry->index_count);
+            result.index_type = GL_UNSIGNED_INT;
+            result.index_offset = entry->indices.offset * static_cast<std::uint32_t>(sizeof(GLuint));
+            result.base_vertex = static_cast<GLint>(entry->vertices.offset);
+            return result;
+        }
+
+        GLint GeometryPool::get_base_vertex(MeshAllocation mesh) const noexcept {
+            const Entry* entry = find(mesh);
+            return entry ? static_cast<GLint>(entry->vertices.offset) : 0;
+        }
+
+        std::uint32_t GeometryPool::get_first_index(MeshAllocation mesh) const noexcept {
+            const Entry* entry = find(mesh);
+            return entry ? entry->indices.offset : 0;
+        }
+
+        void GeometryPool::draw(MeshAllocation mesh, GLenum mode) const {
+            const Entry* entry = find(mesh);
+            if (!entry) {
+                return;
+            }
+
+            vao_.bind();
+            GL::draw_elements_base_vertex(mode, static_cast<GLsizei>(entry->index_count), GL_UNSIGNED_INT,
+                reinterpret_cast<const void*>(static_cast<std::uintptr_t>(entry->indices.offset) * sizeof(GLuint)),
+                static_cast<GLint>(entry->vertices.offset));
+            vao_.unbind();
+        }
+
+        GLuint GeometryPool::get_vao() const noexcept {
+            return vao_.get_ID();
+        }
+
+        GLsizei GeometryPool::get_vertex_stride() const noexcept {
+            return config_.vertex_stride;
+        }
+
+        GeometryPool::Stats GeometryPool::get_stats() const noexcept {
+            Stats stats;
+            stats.meshes = meshes_;
+            stats.used_vertices = vertex_allocator_.get_size() - vertex_allocator_.get_free_size();
+            stats.used_indices = index_allocator_.get_size() - index_allocator_.get_free_size();
+            stats.pending_frees = pending_.size();
+            for (const Retired& retired : retiring_) {
+                stats.pending_frees += retired.ranges.size();
+            }
+            stats.compactions = compactions_;
+            return stats;
+        }
+
+        void GeometryPool::create_buffers(std::unique_ptr<Buffer>& vertices, std::unique_ptr<Buffer>& indices) const {
+            vertices = std::make_unique<Buffer>(GL_ARRAY_BUFFER);
+            indices = std::make_unique<Buffer>(GL_ELEMENT_ARRAY_BUFFER);
+            vertices->generate();
+            indices->generate();
+
+            if (!GL::has_direct_state_access()) {
+                GL::bind_vertex_array(0);   // set_data() binds the element buffer, which would attach it to the bound VAO
+            }
+
+            // Filled piecewise afterwards: set_sub_data() never binds the element buffer target
+            vertices->set_data(static_cast<GLsizeiptr>(config_.vertex_capacity) * config_.vertex_stride, nullptr, GL_STATIC_DRAW);
+            indices->set_data(static_cast<GLsizeiptr>(config_.index_capacity) * sizeof(GLuint), nullptr, GL_STATIC_DRAW);
+        }
+
+        void GeometryPool::link_vao() {
+            vao_.link_attributes(*vertex_buffer_, config_.vertex_stride, config_.attributes.data(), config_.attributes.size());
+            vao_.link_element_buffer(*index_buffer_);
+            vao_.unbind();
+        }
+
+        const GeometryPool::Entry* GeometryPool::find(MeshAllocation mesh) const noexcept {
+            if (!mesh || mesh.id >= entries_.size() || !entries_[mesh.id].live) {
+                return nullptr;
+            }
+            return &entries_[mesh.id];
+        }
+
+    } // namespace Graphics
+} // namespace Gem
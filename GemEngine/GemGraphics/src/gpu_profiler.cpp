@@ -0,0 +1,334 @@
+#include <Gem/Graphics/gpu_profiler.h>
+#include <Gem/Core/Logger.h>
+
+#include <algorithm>
+#include <array>
+
+// Pipeline statistics tokens (GL 4.6 / ARB_pipeline_statistics_query), for loaders generated without them
+#ifndef GL_VERTICES_SUBMITTED_ARB
+    #define GL_VERTICES_SUBMITTED_ARB           0x82EE
+    #define GL_PRIMITIVES_SUBMITTED_ARB         0x82EF
+    #define GL_VERTEX_SHADER_INVOCATIONS_ARB    0x82F0
+    #define GL_FRAGMENT_SHADER_INVOCATIONS_ARB  0x82F4
+    #define GL_CLIPPING_INPUT_PRIMITIVES_ARB    0x82F6
+    #define GL_CLIPPING_OUTPUT_PRIMITIVES_ARB   0x82F7
+#endif
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            constexpr std::array<GLenum, 6> STATISTICS_TARGETS = {
+                GL_VERTICES_SUBMITTED_ARB,
+                GL_PRIMITIVES_SUBMITTED_ARB,
+                GL_VERTEX_SHADER_INVOCATIONS_ARB,
+                GL_FRAGMENT_SHADER_INVOCATIONS_ARB,
+                GL_CLIPPING_INPUT_PRIMITIVES_ARB,
+                GL_CLIPPING_OUTPUT_PRIMITIVES_ARB
+            };
+
+            constexpr std::uint64_t CALIBRATION_PERIOD = 128;  ///< Frames between two GPU/CPU clock calibrations.
+
+            struct ZoneRecord {
+                const Profiler::ZoneDesc* desc;
+                std::uint32_t depth;
+                bool open;      ///< End timestamp not issued yet.
+            };
+
+            /**
+             * Query objects of one frame in flight.
+             */
+            struct FrameSlot {
+                std::uint64_t frame_index = 0;
+                bool pending = false;                               ///< Queries issued, results not read yet.
+                GLuint frame_query = 0;                             ///< GL_TIME_ELAPSED
+                std::array<GLuint, STATISTICS_TARGETS.size()> statistics_queries{};
+                std::vector<GLuint> timestamps;                     ///< Begin/end pair per zone.
+                std::vector<ZoneRecord> zones;
+            };
+
+            GpuProfiler::Config config_;
+            bool initialized_ = false;
+            bool statistics_ = false;
+            bool in_frame_ = false;
+
+            std::vector<FrameSlot> slots_;
+            std::size_t write_slot_ = 0;
+            std::uint64_t frame_index_ = 0;
+            std::uint32_t depth_ = 0;
+            std::uint64_t dropped_frames_ = 0;
+
+            std::int64_t gpu_to_cpu_offset_ns_ = 0;                 ///< steady_clock ns minus GPU timestamp ns.
+            GpuProfiler::FrameResult last_frame_;
+
+            std::int64_t steadyNanoseconds() noexcept {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+            }
+
+            /**
+             * Reads the GPU clock between two CPU clock reads (no pipeline flush needed).
+             */
+            void calibrate() {
+                GLint64 gpu_ns = 0;
+                std::int64_t before = steadyNanoseconds();
+                GL::get_integer64v(GL_TIMESTAMP, &gpu_ns);
+                std::int64_t after = steadyNanoseconds();
+                gpu_to_cpu_offset_ns_ = before + (after - before) / 2 - static_cast<std::int64_t>(gpu_ns);
+            }
+
+            std::chrono::steady_clock::time_point toSteady(GLuint64 gpu_ns) noexcept {
+                return std::chrono::steady_clock::time_point(std::chrono::nanoseconds(static_cast<std::int64_t>(gpu_ns) + gpu_to_cpu_offset_ns_));
+            }
+
+            bool isAvailable(GLuint query) {
+                GLint available = GL_FALSE;
+                GL::get_query_object_iv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+                return available == GL_TRUE;
+            }
+
+            GLuint64 result(GLuint query) {
+                GLuint64 value = 0;
+                GL::get_query_object_ui64v(query, GL_QUERY_RESULT, &value);
+                return value;
+            }
+
+            /**
+             * Reads a finished slot into last_frame_ and forwards its zones to the CPU profiler.
+             */
+            void readSlot(FrameSlot& slot) {
+                GpuProfiler::FrameResult& frame = last_frame_;
+                frame.frame_index = slot.frame_index;
+                frame.gpu_time_ms = static_cast<double>(result(slot.frame_query)) / 1e6;
+                frame.zones.clear();
+
+                for (std::size_t i = 0; i < slot.zones.size(); ++i) {
+                    GpuProfiler::ZoneResult& zone = frame.zones.emplace_back();
+                    zone.zone = slot.zones[i].desc;
+                    zone.depth = slot.zones[i].depth;
+                    zone.start = toSteady(result(slot.timestamps[2 * i]));
+                    zone.end = toSteady(result(slot.timestamps[2 * i + 1]));
+
+                    Profiler::recordExternalZone("GPU", *zone.zone, zone.depth, zone.start, zone.end);
+                }
+
+                frame.has_statistics = statistics_;
+                if (statistics_) {
+                    frame.statistics.vertices_submitted = result(slot.statistics_queries[0]);
+                    frame.statistics.primitives_submitted = result(slot.statistics_queries[1]);
+                    frame.statistics.vertex_shader_invocations = result(slot.statistics_queries[2]);
+                    frame.statistics.fragment_shader_invocations = result(slot.statistics_queries[3]);
+                    frame.statistics.clipping_input_primitives = result(slot.statistics_queries[4]);
+                    frame.statistics.clipping_output_primitives = result(slot.statistics_queries[5]);
+                }
+
+                slot.pending = false;
+            }
+
+            /**
+             * Reads the finished slots, oldest first, stopping at the first one not ready.
+             */
+            void collect() {
+                std::size_t count = slots_.size();
+                for (std::size_t n = 0; n < count; ++n) {
+                    FrameSlot& slot = slots_[(write_slot_ + n) % count];    // write_slot_ holds the oldest frame
+                    if (!slot.pending) {
+                        continue;
+                    }
+
+                    // The frame query ends after every zone of the frame
+                    bool ready = isAvailable(slot.frame_query);
+                    if (ready && !slot.zones.empty()) {
+                        ready = isAvailable(slot.timestamps[2 * slot.zones.size() - 1]);
+                    }
+                    if (!ready) {
+                        break;
+                    }
+                    readSlot(slot);
+                }
+            }
+
+        } // namespace
+
+        //--------------------------------------------------------------------------
+        // Zones
+        //--------------------------------------------------------------------------
+        GpuProfiler::Zone::Zone(const Profiler::ZoneDesc& desc) noexcept
+            : index_(-1)
+            , slot_(0)
+            , frame_(0)
+        {
+            if (!in_frame_) {
+                return;
+            }
+
+            FrameSlot& slot = slots_[write_slot_];
+            if (slot.zones.size() >= config_.max_zones_per_frame) {
+                return;
+            }
+
+            index_ = static_cast<std::int64_t>(slot.zones.size());
+            slot_ = write_slot_;
+            frame_ = frame_index_;
+            slot.zones.push_back({ &desc, depth_++, true });    // Capacity reserved in init(): no allocation
+            GL::query_counter(slot.timestamps[2 * static_cast<std::size_t>(index_)], GL_TIMESTAMP);
+        }
+
+        GpuProfiler::Zone::~Zone() {
+            // A zone that outlived its frame was closed by end_frame() at the frame's end
+            if (index_ < 0 || !in_frame_ || frame_ != frame_index_) {
+                return;
+            }
+
+            depth_--;
+            ZoneRecord& zone = slots_[slot_].zones[static_cast<std::size_t>(index_)];
+            zone.open = false;
+            GL::query_counter(slots_[slot_].timestamps[2 * static_cast<std::size_t>(index_) + 1], GL_TIMESTAMP);
+        }
+
+        //--------------------------------------------------------------------------
+        // Lifetime
+        //--------------------------------------------------------------------------
+        bool GpuProfiler::init() {
+            return init(Config{});
+        }
+
+        bool GpuProfiler::init(const Config& config) {
+            if (initialized_) {
+                return true;
+            }
+
+            GLint major = 0, minor = 0;
+            GL::get_integerv(GL_MAJOR_VERSION, &major);
+            GL::get_integerv(GL_MINOR_VERSION, &minor);
+            int version = major * 10 + minor;
+
+            if (version < 33 && !GL::has_extension("GL_ARB_timer_query")) {
+                GEM_LOG_WARNING(Logger::Channel::Graphics, "GpuProfiler: timer queries not supported (GL {}.{})", major, minor);
+                return false;
+            }
+
+            config_ = config;
+            config_.frames_in_flight = std::max<std::size_t>(config_.frames_in_flight, 2);
+            statistics_ = config_.pipeline_statistics && (version >= 46 || GL::has_extension("GL_ARB_pipeline_statistics_query"));
+
+            slots_.resize(config_.frames_in_flight);
+            for (FrameSlot& slot : slots_) {
+                GL::gen_queries(1, &slot.frame_query);
+                if (statistics_) {
+                    GL::gen_queries(static_cast<GLsizei>(slot.statistics_queries.size()), slot.statistics_queries.data());
+                }
+                slot.timestamps.resize(2 * config_.max_zones_per_frame);
+                GL::gen_queries(static_cast<GLsizei>(slot.timestamps.size()), slot.timestamps.data());
+                slot.zones.reserve(config_.max_zones_per_frame);
+            }
+
+            calibrate();
+            write_slot_ = 0;
+            dropped_frames_ = 0;
+            initialized_ = true;
+
+            GEM_LOG_INFO(Logger::Channel::Graphics, "GpuProfiler: {} frames in flight, {} zones per frame, pipeline statistics {}",
+                config_.frames_in_flight, config_.max_zones_per_frame, statistics_ ? "on" : "off");
+            return true;
+        }
+
+        void GpuProfiler::shutdown() {
+            if (!initialized_) {
+                return;
+            }
+
+            if (in_frame_) {
+                end_frame();
+            }
+
+            for (FrameSlot& slot : slots_) {
+                GL::delete_queries(1, &slot.frame_query);
+                if (statistics_) {
+                    GL::delete_queries(static_cast<GLsizei>(slot.statistics_queries.size()), slot.statistics_queries.data());
+                }
+                GL::delete_queries(static_cast<GLsizei>(slot.timestamps.size()), slot.timestamps.data());
+            }
+            slots_.clear();
+            initialized_ = false;
+        }
+
+        bool GpuProfiler::is_initialized() noexcept {
+            return initialized_;
+        }
+
+        bool GpuProfiler::has_pipeline_statistics() noexcept {
+            return statistics_;
+        }
+
+        //--------------------------------------------------------------------------
+        // Frames
+        //--------------------------------------------------------------------------
+        void GpuProfiler::begin_frame() {
+            if (!initialized_ || in_frame_) {
+                return;
+            }
+
+            collect();
+
+            if (frame_index_ % CALIBRATION_PERIOD == 0) {
+                calibrate();    // GPU and CPU clocks drift apart slowly
+            }
+
+            FrameSlot& slot = slots_[write_slot_];
+            if (slot.pending) {
+                // Still not ready after frames_in_flight frames: reuse the queries instead of waiting
+                slot.pending = false;
+                dropped_frames_++;
+            }
+
+            slot.frame_index = frame_index_;
+            slot.zones.clear();
+            depth_ = 0;
+
+            GL::begin_query(GL_TIME_ELAPSED, slot.frame_query);
+            if (statistics_) {
+                for (std::size_t i = 0; i < STATISTICS_TARGETS.size(); ++i) {
+                    GL::begin_query(STATISTICS_TARGETS[i], slot.statistics_queries[i]);
+                }
+            }
+            in_frame_ = true;
+        }
+
+        void GpuProfiler::end_frame() {
+            if (!initialized_ || !in_frame_) {
+                return;
+            }
+
+            // Zones still open end with the frame, so every query of the slot is issued
+            FrameSlot& slot = slots_[write_slot_];
+            for (std::size_t i = 0; i < slot.zones.size(); ++i) {
+                if (slot.zones[i].open) {
+                    slot.zones[i].open = false;
+                    GL::query_counter(slot.timestamps[2 * i + 1], GL_TIMESTAMP);
+                }
+            }
+
+            if (statistics_) {
+                for (GLenum target : STATISTICS_TARGETS) {
+                    GL::end_query(target);
+                }
+            }
+            GL::end_query(GL_TIME_ELAPSED);
+
+            slot.pending = true;
+            write_slot_ = (write_slot_ + 1) % slots_.size();
+            frame_index_++;
+            in_frame_ = false;
+        }
+
+        const GpuProfiler::FrameResult& GpuProfiler::get_last_frame() noexcept {
+            return last_frame_;
+        }
+
+        std::uint64_t GpuProfiler::get_dropped_frames() noexcept {
+            return dropped_frames_;
+        }
+
+    } // namespace Graphics
+} // namespace Gem
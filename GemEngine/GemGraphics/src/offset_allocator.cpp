@@ -0,0 +1,278 @@
+#include <Gem/Graphics/offset_allocator.h>
+
+#include <algorithm>
+#include <bit>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            constexpr std::uint32_t MANTISSA_BITS = 3;
+            constexpr std::uint32_t MANTISSA_VALUE = 1u << MANTISSA_BITS;
+            constexpr std::uint32_t MANTISSA_MASK = MANTISSA_VALUE - 1;
+
+            /**
+             * Size class of a size, as a small float: sizes below 8 are exact, larger ones keep
+             * their top 4 bits. Rounding down files a free range under a class it fully covers;
+             * rounding up gives the first class where every range fits a request.
+             */
+            std::uint32_t sizeClass(std::uint32_t size, bool round_up) noexcept {
+                if (size < MANTISSA_VALUE) {
+                    return size;
+                }
+
+                const std::uint32_t shift = static_cast<std::uint32_t>(std::bit_width(size)) - 1 - MANTISSA_BITS;
+                std::uint32_t bin = ((shift + 1) << MANTISSA_BITS) + ((size >> shift) & MANTISSA_MASK);
+                if (round_up && (size & ((1u << shift) - 1)) != 0) {
+                    bin++;  // May carry into the exponent, which is the next class anyway
+                }
+                return bin;
+            }
+
+            // Index of the lowest set bit at or above start, or NO_SPACE
+            std::uint32_t lowestBitFrom(std::uint32_t mask, std::uint32_t start) noexcept {
+                if (start >= 32) {
+                    return OffsetAllocator::NO_SPACE;
+                }
+                mask &= ~((1u << start) - 1);
+                return mask ? static_cast<std::uint32_t>(std::countr_zero(mask)) : OffsetAllocator::NO_SPACE;
+            }
+
+        } // namespace
+
+        // Constructor
+        OffsetAllocator::OffsetAllocator(std::uint32_t size)
+            : size_(size) {
+            reset();
+        }
+
+        // Reserve a range
+        OffsetAllocator::Allocation OffsetAllocator::allocate(std::uint32_t size) {
+            if (size == 0) {
+                return {};
+            }
+
+            // First size class where every range is large enough
+            const std::uint32_t min_bin = sizeClass(size, true);
+            std::uint32_t top = min_bin / BINS_PER_LEAF;
+            std::uint32_t bin = NO_SPACE;
+
+            if (top < TOP_BINS && (used_top_bins_ & (1u << top))) {
+                const std::uint32_t leaf = lowestBitFrom(used_leaf_bins_[top], min_bin % BINS_PER_LEAF);
+                if (leaf != NO_SPACE) {
+                    bin = top * BINS_PER_LEAF + leaf;
+                }
+            }
+            if (bin == NO_SPACE) {
+                top = lowestBitFrom(used_top_bins_, top + 1);
+                if (top != NO_SPACE) {
+                    bin = top * BINS_PER_LEAF + static_cast<std::uint32_t>(std::countr_zero(used_leaf_bins_[top]));
+                }
+            }
+
+            std::uint32_t index = NO_SPACE;
+            if (bin != NO_SPACE) {
+                index = bin_heads_[bin];
+            }
+            else {
+                // Nothing in the larger classes: a range of the request's own class may still fit
+                for (std::uint32_t node = bin_heads_[sizeClass(size, false)]; node != NO_SPACE; node = nodes_[node].bin_next) {
+                    if (nodes_[node].size >= size) {
+                        index = node;
+                        break;
+                    }
+                }
+                if (index == NO_SPACE) {
+                    return {};
+                }
+            }
+
+            remove_from_bin(index);
+
+            const std::uint32_t remainder = nodes_[index].size - size;
+            nodes_[index].size = size;
+            nodes_[index].used = true;
+
+            // Give the tail back as a free range, right after the allocation
+            if (remainder > 0) {
+                const std::uint32_t tail = insert_free_node(nodes_[index].offset + size, remainder);
+                const std::uint32_t next = nodes_[index].neighbor_next;
+
+                nodes_[tail].neighbor_prev = index;
+                nodes_[tail].neighbor_next = next;
+                if (next != NO_SPACE) {
+                    nodes_[next].neighbor_prev = tail;
+                }
+                nodes_[index].neighbor_next = tail;
+            }
+
+            return { nodes_[index].offset, index };
+        }
+
+        // Release a range
+        void OffsetAllocator::free(Allocation allocation) {
+            if (!allocation || allocation.node >= nodes_.size() || !nodes_[allocation.node].used) {
+                return;
+            }
+
+            const std::uint32_t index = allocation.node;
+            std::uint32_t offset = nodes_[index].offset;
+            std::uint32_t size = nodes_[index].size;
+            std::uint32_t prev = nodes_[index].neighbor_prev;
+            std::uint32_t next = nodes_[index].neighbor_next;
+
+            // Merge with the free neighbours
+            if (prev != NO_SPACE && !nodes_[prev].used) {
+                offset = nodes_[prev].offset;
+                size += nodes_[prev].size;
+
+                const std::uint32_t merged = prev;
+                prev = nodes_[merged].neighbor_prev;
+                remove_from_bin(merged);
+                release_node(merged);
+            }
+            if (next != NO_SPACE && !nodes_[next].used) {
+                size += nodes_[next].size;
+
+                const std::uint32_t merged = next;
+                next = nodes_[merged].neighbor_next;
+                remove_from_bin(merged);
+                release_node(merged);
+            }
+            release_node(index);
+
+            const std::uint32_t range = insert_free_node(offset, size);
+            nodes_[range].neighbor_prev = prev;
+            nodes_[range].neighbor_next = next;
+            if (prev != NO_SPACE) {
+                nodes_[prev].neighbor_next = range;
+            }
+            if (next != NO_SPACE) {
+                nodes_[next].neighbor_prev = range;
+            }
+        }
+
+        // Free everything
+        void OffsetAllocator::reset() {
+            free_size_ = 0;
+            used_top_bins_ = 0;
+            std::fill(std::begin(used_leaf_bins_), std::end(used_leaf_bins_), std::uint8_t{ 0 });
+            std::fill(std::begin(bin_heads_), std::end(bin_heads_), NO_SPACE);
+            nodes_.clear();
+            unused_nodes_.clear();
+
+            if (size_ > 0) {
+                insert_free_node(0, size_);
+            }
+        }
+
+        // Get the size of an allocation
+        std::uint32_t OffsetAllocator::get_allocation_size(Allocation allocation) const noexcept {
+            if (!allocation || allocation.node >= nodes_.size()) {
+                return 0;
+            }
+            return nodes_[allocation.node].size;
+        }
+
+        // Get the size of the managed space
+        std::uint32_t OffsetAllocator::get_size() const noexcept {
+            return size_;
+        }
+
+        // Get the free units
+        std::uint32_t OffsetAllocator::get_free_size() const noexcept {
+            return free_size_;
+        }
+
+        // Get the largest free range
+        std::uint32_t OffsetAllocator::get_largest_free_size() const noexcept {
+            if (used_top_bins_ == 0) {
+                return 0;
+            }
+
+            // The largest range is in the highest non-empty class, but not necessarily first in it
+            const std::uint32_t top = 31 - static_cast<std::uint32_t>(std::countl_zero(used_top_bins_));
+            const std::uint32_t leaf = 31 - static_cast<std::uint32_t>(std::countl_zero(static_cast<std::uint32_t>(used_leaf_bins_[top])));
+
+            std::uint32_t largest = 0;
+            for (std::uint32_t index = bin_heads_[top * BINS_PER_LEAF + leaf]; index != NO_SPACE; index = nodes_[index].bin_next) {
+                largest = std::max(largest, nodes_[index].size);
+            }
+            return largest;
+        }
+
+        // Create a free node in its size class
+        std::uint32_t OffsetAllocator::insert_free_node(std::uint32_t offset, std::uint32_t size) {
+            const std::uint32_t bin = sizeClass(size, false);
+            const std::uint32_t top = bin / BINS_PER_LEAF;
+            const std::uint32_t leaf = bin % BINS_PER_LEAF;
+
+            const std::uint32_t index = new_node();
+            Node& node = nodes_[index];
+            node.offset = offset;
+            node.size = size;
+            node.used = false;
+            node.bin_prev = NO_SPACE;
+            node.bin_next = bin_heads_[bin];
+            node.neighbor_prev = NO_SPACE;
+            node.neighbor_next = NO_SPACE;
+
+            if (node.bin_next != NO_SPACE) {
+                nodes_[node.bin_next].bin_prev = index;
+            }
+            bin_heads_[bin] = index;
+            used_leaf_bins_[top] |= static_cast<std::uint8_t>(1u << leaf);
+            used_top_bins_ |= 1u << top;
+
+            free_size_ += size;
+            return index;
+        }
+
+        // Unlink a free node from its size class
+        void OffsetAllocator::remove_from_bin(std::uint32_t index) {
+            Node& node = nodes_[index];
+
+            if (node.bin_prev != NO_SPACE) {
+                nodes_[node.bin_prev].bin_next = node.bin_next;
+            }
+            else {
+                const std::uint32_t bin = sizeClass(node.size, false);
+                bin_heads_[bin] = node.bin_next;
+
+                if (node.bin_next == NO_SPACE) {
+                    const std::uint32_t top = bin / BINS_PER_LEAF;
+                    used_leaf_bins_[top] &= static_cast<std::uint8_t>(~(1u << (bin % BINS_PER_LEAF)));
+                    if (used_leaf_bins_[top] == 0) {
+                        used_top_bins_ &= ~(1u << top);
+                    }
+                }
+            }
+            if (node.bin_next != NO_SPACE) {
+                nodes_[node.bin_next].bin_prev = node.bin_prev;
+            }
+
+            node.bin_prev = NO_SPACE;
+            node.bin_next = NO_SPACE;
+            free_size_ -= node.size;
+        }
+
+        // Get a node slot, recycled if possible
+        std::uint32_t OffsetAllocator::new_node() {
+            if (!unused_nodes_.empty()) {
+                const std::uint32_t index = unused_nodes_.back();
+                unused_nodes_.pop_back();
+                return index;
+            }
+            nodes_.emplace_back();
+            return static_cast<std::uint32_t>(nodes_.size() - 1);
+        }
+
+        // Give a node slot back
+        void OffsetAllocator::release_node(std::uint32_t index) {
+            nodes_[index] = Node{};
+            unused_nodes_.push_back(index);
+        }
+
+    } // namespace Graphics
+} // namespace Gem
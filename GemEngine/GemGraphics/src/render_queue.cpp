@@ -0,0 +1,257 @@
+#include <Gem/Graphics/render_queue.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            Metrics::Counter render_packets_("render.packets");
+            Metrics::Counter render_state_changes_("render.state_changes");
+
+            std::size_t alignUp(std::size_t value, std::size_t alignment) noexcept {
+                return (value + alignment - 1) / alignment * alignment;
+            }
+
+            /**
+             * LSD radix sort on the 64-bit key, one byte per pass. Histograms for all passes are
+             * built in a single read, and passes where every key has the same byte are skipped,
+             * so keys that only use their top bits cost two or three passes. Stable, so packets
+             * with equal keys keep their recording order.
+             */
+            template <typename Entry>
+            void radixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch) {
+                const std::size_t count = entries.size();
+                if (count < 2) {
+                    return;
+                }
+
+                std::size_t histograms[8][256] = {};
+                for (const Entry& entry : entries) {
+                    for (int pass = 0; pass < 8; ++pass) {
+                        histograms[pass][(entry.key >> (pass * 8)) & 0xFF]++;
+                    }
+                }
+
+                scratch.resize(count);
+                Entry* source = entries.data();
+                Entry* destination = scratch.data();
+
+                for (int pass = 0; pass < 8; ++pass) {
+                    std::size_t* histogram = histograms[pass];
+                    if (histogram[(source[0].key >> (pass * 8)) & 0xFF] == count) {
+                        continue;   // Every key has the same byte here
+                    }
+
+                    std::size_t offset = 0;
+                    for (int digit = 0; digit < 256; ++digit) {
+                        std::size_t bucket = histogram[digit];
+                        histogram[digit] = offset;
+                        offset += bucket;
+                    }
+                    for (std::size_t i = 0; i < count; ++i) {
+                        destination[histogram[(source[i].key >> (pass * 8)) & 0xFF]++] = source[i];
+                    }
+                    std::swap(source, destination);
+                }
+
+                if (source != entries.data()) {
+                    entries.swap(scratch);
+                }
+            }
+
+        } // namespace
+
+        //--------------------------------------------------------------------------
+        // CommandBuffer
+        //--------------------------------------------------------------------------
+        DrawPacket& CommandBuffer::draw(std::uint64_t sort_key, GLuint program, const Mesh& mesh, const void* uniforms, std::uint32_t uniform_size) {
+            DrawPacket& packet = packets_.emplace_back();
+            packet.sort_key = sort_key;
+            packet.program = program;
+            packet.vao = mesh.vao;
+            packet.mode = static_cast<std::uint16_t>(mesh.mode);
+            packet.index_type = static_cast<std::uint16_t>(mesh.index_type);
+            packet.count = mesh.count;
+            packet.index_offset = mesh.index_offset;
+            packet.base_vertex = mesh.base_vertex;
+
+            if (uniforms && uniform_size > 0) {
+                packet.uniform_offset = static_cast<std::uint32_t>(uniforms_.size());
+                packet.uniform_size = uniform_size;
+                uniforms_.insert(uniforms_.end(), static_cast<const std::uint8_t*>(uniforms), static_cast<const std::uint8_t*>(uniforms) + uniform_size);
+            }
+            return packet;
+        }
+
+        std::size_t CommandBuffer::size() const noexcept {
+            return packets_.size();
+        }
+
+        void CommandBuffer::reset() noexcept {
+            packets_.clear();
+            uniforms_.clear();
+        }
+
+        //--------------------------------------------------------------------------
+        // RenderQueue
+        //--------------------------------------------------------------------------
+        RenderQueue::RenderQueue()
+            : RenderQueue(Config{}) {
+        }
+
+        RenderQueue::RenderQueue(const Config& config)
+            : config_(config) {
+        }
+
+        RenderQueue::~RenderQueue() = default;
+
+        CommandBuffer& RenderQueue::acquire_command_buffer() {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            CommandBuffer* buffer = nullptr;
+            if (!free_.empty()) {
+                buffer = free_.back();
+                free_.pop_back();
+            }
+            else {
+                buffers_.push_back(std::make_unique<CommandBuffer>());
+                buffer = buffers_.back().get();
+                buffer->packets_.reserve(config_.packets_per_buffer);
+            }
+
+            acquired_.push_back(buffer);
+            return *buffer;
+        }
+
+        void RenderQueue::execute() {
+            GEM_PROFILE_ZONE("RenderQueue::execute");
+
+            std::vector<CommandBuffer*>& buffers = executing_;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                buffers.swap(acquired_);    // acquired_ gets last frame's (empty) vector back
+            }
+
+            stats_ = Stats{};
+
+            // Merge
+            entries_.clear();
+            for (std::uint32_t b = 0; b < buffers.size(); ++b) {
+                const std::vector<DrawPacket>& packets = buffers[b]->packets_;
+                for (std::uint32_t p = 0; p < packets.size(); ++p) {
+                    entries_.push_back({ packets[p].sort_key, b, p });
+                }
+            }
+
+            radixSort(entries_, scratch_);
+
+            // Lay out the uniform blocks in submission order, at the required alignment
+            if (uniform_alignment_ == 0) {
+                GL::get_integerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_alignment_);
+                uniform_alignment_ = std::max(uniform_alignment_, 16);
+            }
+
+            staging_.clear();
+            uniform_offsets_.resize(entries_.size());
+            for (std::size_t i = 0; i < entries_.size(); ++i) {
+                const CommandBuffer& buffer = *buffers[entries_[i].buffer];
+                const DrawPacket& packet = buffer.packets_[entries_[i].packet];
+                if (packet.uniform_size == 0) {
+                    continue;
+                }
+
+                std::size_t offset = alignUp(staging_.size(), static_cast<std::size_t>(uniform_alignment_));
+                staging_.resize(offset + packet.uniform_size);
+                std::memcpy(staging_.data() + offset, buffer.uniforms_.data() + packet.uniform_offset, packet.uniform_size);
+                uniform_offsets_[i] = static_cast<std::uint32_t>(offset);
+            }
+
+            if (!staging_.empty()) {
+                if (uniform_buffer_.get_ID() == 0) {
+                    uniform_buffer_.generate();
+                }
+                uniform_buffer_.set_data(static_cast<GLsizeiptr>(staging_.size()), staging_.data(), GL_STREAM_DRAW);    // Orphans last frame's data
+                stats_.uniform_bytes = staging_.size();
+            }
+
+            // Submit, skipping binds that would not change anything
+            GLuint program = 0;
+            GLuint vao = 0;
+            GLuint textures[DrawPacket::MAX_TEXTURES] = {};
+            bool first = true;
+
+            for (std::size_t i = 0; i < entries_.size(); ++i) {
+                const DrawPacket& packet = buffers[entries_[i].buffer]->packets_[entries_[i].packet];
+
+                if (first || packet.program != program) {
+                    GL::use_program(packet.program);
+                    program = packet.program;
+                    stats_.program_changes++;
+                }
+                if (first || packet.vao != vao) {
+                    GL::bind_vertex_array(packet.vao);
+                    vao = packet.vao;
+                    stats_.vao_changes++;
+                }
+                for (unsigned int unit = 0; unit < DrawPacket::MAX_TEXTURES; ++unit) {
+                    if (packet.textures[unit] != 0 && packet.textures[unit] != textures[unit]) {
+                        GL::active_texture(GL_TEXTURE0 + unit);
+                        GL::bind_texture(packet.texture_targets[unit], packet.textures[unit]);
+                        textures[unit] = packet.textures[unit];
+                        stats_.texture_changes++;
+                    }
+                }
+                if (packet.uniform_size > 0) {
+                    GL::bind_buffer_range(GL_UNIFORM_BUFFER, config_.uniform_binding, uniform_buffer_.get_ID(),
+                        static_cast<GLintptr>(uniform_offsets_[i]), static_cast<GLsizeiptr>(packet.uniform_size));
+                }
+
+                const void* indices = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(packet.index_offset));
+                if (packet.base_vertex != 0) {
+                    GL::draw_elements_base_vertex(packet.mode, packet.count, packet.index_type, indices, packet.base_vertex);
+                }
+                else {
+                    GL::draw_elements(packet.mode, packet.count, packet.index_type, indices);
+                }
+                first = false;
+            }
+            stats_.draws = entries_.size();
+
+            if (!first) {
+                GL::bind_vertex_array(0);   // Like Shape::render(), leave no VAO bound
+            }
+
+            render_packets_.add(stats_.draws);
+            render_state_changes_.add(stats_.program_changes + stats_.vao_changes + stats_.texture_changes);
+
+            // Hand the buffers back for the next frame
+            for (CommandBuffer* buffer : buffers) {
+                buffer->reset();
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            free_.insert(free_.end(), buffers.begin(), buffers.end());
+            buffers.clear();
+        }
+
+        const RenderQueue::Stats& RenderQueue::get_stats() const noexcept {
+            return stats_;
+        }
+
+        std::uint64_t RenderQueue::make_sort_key(std::uint8_t layer, std::uint32_t program, std::uint32_t material, float depth) noexcept {
+            constexpr float DEPTH_MAX = static_cast<float>((1u << 24) - 1);
+            float clamped = depth > 0.0f ? std::min(depth, 1.0f) : 0.0f;    // Also maps NaN to 0
+            std::uint64_t quantized = static_cast<std::uint64_t>(clamped * DEPTH_MAX + 0.5f);
+
+            return (static_cast<std::uint64_t>(layer) << 56)
+                | (static_cast<std::uint64_t>(program & 0xFFFu) << 44)
+                | (static_cast<std::uint64_t>(material & 0xFFFFFu) << 24)
+                | quantized;
+        }
+
+    } // namespace Graphics
+} // namespace Gem
@@ -1,14 +1,24 @@
 #include <Gem/Graphics/shader.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+
+#include <algorithm>
 
 namespace Gem {
 
 	namespace Graphics {
 
+		namespace {
+
+			Metrics::Counter shader_activations_("gl.shader_activations");
+
+		} // namespace
+
 		// Constructor
 		Shader::Shader() {
 			ID_ = GL::create_program();
 			if (ID_ == 0) {
-				std::cerr << "ERROR::SHADER::Failed to create shader program." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "Failed to create shader program.");
 			}
 		}
 
@@ -22,12 +32,13 @@ namespace Gem {
 			// Create the shader object
 			GLuint shader = GL::create_shader(shaderType);
 			if (shader == 0) {
-				std::cerr << "ERROR::SHADER::Failed to create shader of type " << shaderType << "." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "Failed to create shader of type {}.", shaderType);
 				throw std::runtime_error("Shader creation failed");
 			}
 
 			// Read the shader source code from the file
-			std::string shaderCode = get_file_contents(shaderFile);
+			std::vector<std::string> included;
+			std::string shaderCode = resolve_includes(get_file_contents(shaderFile), included);
 			const char* shaderSource = shaderCode.c_str();
 
 			// Compile the shader
@@ -40,8 +51,7 @@ namespace Gem {
 			if (!success) {
 				char infoLog[1024];
 				GL::get_shader_info_log(shader, sizeof(infoLog), nullptr, infoLog);
-				std::cerr << "ERROR::SHADER_COMPILATION_ERROR of type: " << shaderType << "\n"
-					<< infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "Compilation error in '{}' (type {}):\n{}", shaderFile, shaderType, static_cast<const char*>(infoLog));
 				GL::delete_shader(shader); // Avoid shader resource leak
 				throw std::runtime_error("Shader compilation failed");
 			}
@@ -62,8 +72,7 @@ namespace Gem {
 			if (!success) {
 				char infoLog[1024];
 				GL::get_program_info_log(ID_, sizeof(infoLog), nullptr, infoLog);
-				std::cerr << "ERROR::PROGRAM_LINKING_ERROR\n" << infoLog
-					<< "\n -- --------------------------------------------------- -- " << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "Program linking error:\n{}", static_cast<const char*>(infoLog));
 				throw std::runtime_error("Program linking failed");
 			}
 
@@ -73,8 +82,7 @@ namespace Gem {
 			if (!success) {
 				char infoLog[1024];
 				GL::get_program_info_log(ID_, sizeof(infoLog), nullptr, infoLog);
-				std::cerr << "ERROR::PROGRAM_VALIDATION_ERROR\n" << infoLog
-					<< "\n -- --------------------------------------------------- -- " << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "Program validation error:\n{}", static_cast<const char*>(infoLog));
 				throw std::runtime_error("Program validation failed");
 			}
 
@@ -88,6 +96,7 @@ namespace Gem {
 		// Activate the shader program
 		void Shader::activate() const {
 			GL::use_program(ID_);
+			shader_activations_.add();
 		}
 
 		// Delete the shader program
@@ -103,6 +112,11 @@ namespace Gem {
 			path_ = path;
 		}
 
+		// Add a folder searched for includes
+		void Shader::add_include_path(const std::string& path) {
+			include_paths_.push_back(path);
+		}
+
 		// Get the shader program ID
 		[[nodiscard]] GLuint Shader::get_ID() const noexcept {
 			return ID_;
@@ -112,7 +126,7 @@ namespace Gem {
 		void Shader::add_uniform_location(const std::string& name) {
 			GLint location = GL::get_uniform_location(ID_, name.c_str());
 			if (location == -1) {
-				std::cerr << "WARNING::SHADER::add_uniform_location: Uniform '" << name << "' does not exist or is not used." << std::endl;
+				GEM_LOG_WARNING(Logger::Channel::Shader, "add_uniform_location: uniform '{}' does not exist or is not used.", name);
 			}
 			uniform_locations_[name] = location;
 		}
@@ -124,7 +138,7 @@ namespace Gem {
 				return it->second;
 			}
 			else {
-				std::cerr << "ERROR::SHADER::get_uniform_location: Uniform '" << name << "' not found. Did you forget to add it?" << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "get_uniform_location: uniform '{}' not found. Did you forget to add it?", name);
 				throw std::runtime_error("Uniform not found");
 			}
 		}
@@ -241,21 +255,21 @@ namespace Gem {
 				GL::set_uniform_matrix4x3fv(location, count, transpose, value);
 				break;
 			default:
-				std::cerr << "ERROR::SHADER::set_uniform_matrix: Invalid matrix type." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Shader, "set_uniform_matrix: invalid matrix type.");
 				throw std::runtime_error("Invalid matrix type");
 			}
 		}
 
 		void Shader::bind_uniform_block(const std::string& blockName, GLuint bindingPoint) {
 			// Get the index of the uniform block
-			GLuint blockIndex = glGetUniformBlockIndex(ID_, blockName.c_str());
+			GLuint blockIndex = GL::get_uniform_block_index(ID_, blockName);
 			if (blockIndex == GL_INVALID_INDEX) {
-				std::cerr << "WARNING::SHADER::bind_uniform_block: Uniform block '" << blockName << "' not found." << std::endl;
+				GEM_LOG_WARNING(Logger::Channel::Shader, "bind_uniform_block: uniform block '{}' not found.", blockName);
 				return;
 			}
 
 			// Bind the uniform block to the binding point
-			glUniformBlockBinding(ID_, blockIndex, bindingPoint);
+			GL::uniform_block_binding(ID_, blockIndex, bindingPoint);
 		}
 
 		// Equality operator
@@ -279,10 +293,68 @@ namespace Gem {
 				in.close();
 				return contents.str();
 			}
-			std::cerr << "Could not open file: " << full_filename << "\nTry to change the path with set_path() to your local shader folder.\n";
+			GEM_LOG_ERROR(Logger::Channel::Shader, "Could not open file: {}\nTry to change the path with set_path() to your local shader folder.", full_filename);
 			throw std::runtime_error("Could not open file " + full_filename);
 		}
 
+		// Expand #include "file" lines
+		std::string Shader::resolve_includes(const std::string& source, std::vector<std::string>& included) const {
+			std::istringstream lines(source);
+			std::ostringstream result;
+			std::string line;
+			int lineNumber = 0;
+
+			while (std::getline(lines, line)) {
+				++lineNumber;
+
+				const std::size_t directive = line.find_first_not_of(" \t");
+				if (directive == std::string::npos || line.compare(directive, 8, "#include") != 0) {
+					result << line << '\n';
+					continue;
+				}
+
+				const std::size_t open = line.find('"', directive + 8);
+				const std::size_t close = open == std::string::npos ? std::string::npos : line.find('"', open + 1);
+				if (close == std::string::npos) {
+					GEM_LOG_ERROR(Logger::Channel::Shader, "resolve_includes: malformed include at line {}: {}", lineNumber, line);
+					throw std::runtime_error("Malformed shader include");
+				}
+				const std::string name = line.substr(open + 1, close - open - 1);
+
+				// Once per shader: skip files already included (and include cycles)
+				if (std::find(included.begin(), included.end(), name) != included.end()) {
+					result << '\n';
+					continue;
+				}
+				included.push_back(name);
+
+				// The shader folder first, then the include folders
+				std::string contents;
+				bool found = false;
+				for (std::size_t i = 0; i <= include_paths_.size() && !found; ++i) {
+					std::ifstream in((i == 0 ? path_ : include_paths_[i - 1]) + name, std::ios::in | std::ios::binary);
+					if (in) {
+						std::ostringstream file;
+						file << in.rdbuf();
+						contents = file.str();
+						found = true;
+					}
+				}
+				if (!found) {
+					std::string searched = path_;
+					for (const std::string& path : include_paths_) {
+						searched += ", " + path;
+					}
+					GEM_LOG_ERROR(Logger::Channel::Shader, "resolve_includes: could not find include '{}' in {}\nAdd its folder with add_include_path().", name, searched);
+					throw std::runtime_error("Could not find shader include " + name);
+				}
+
+				// Keep the including file's line numbers in compile errors after the include
+				result << "#line 1\n" << resolve_includes(contents, included) << "#line " << lineNumber + 1 << '\n';
+			}
+			return result.str();
+		}
+
 	} // namespace Graphics
 
 } // namespace Gem
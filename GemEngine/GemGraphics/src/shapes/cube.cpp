@@ -1,12 +1,13 @@
 #include <Gem/Graphics/shapes/cube.h>
-#include <iostream>
+#include <Gem/Core/Logger.h>
+#include <stdexcept>
 
 namespace Gem {
     namespace Graphics {
         namespace Shapes {
 
-            Cube::Cube(float size)
-                : size_(size),
+            Cube::Cube(float size, VertexCompression compression)
+                : size_(size), compression_(compression),
                 VAO_(),
                 VBO_(GL_ARRAY_BUFFER),
                 EBO_(GL_ELEMENT_ARRAY_BUFFER) {
@@ -15,7 +16,43 @@ namespace Gem {
                 initialize();
             }
 
+            Cube::Cube(float size, AsyncLoader& loader, VertexCompression compression)
+                : size_(size), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER) {
+
+                // VAOs are not shared between contexts: is_ready() sets it up once the buffers have landed
+                ready_ = false;
+                upload_ = loader.submit([this]() {
+                    generateData();
+                    uploadBuffers();
+                });
+            }
+
+            Cube::Cube(float size, GeometryPool& pool, VertexCompression compression)
+                : size_(size), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER),
+                pool_(&pool) {
+
+                // Drawn with the pool's VAO and buffers: VAO_, VBO_ and EBO_ are never generated
+                if (pool.get_vertex_stride() != get_vertex_stride(compression_)) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "Cube: the GeometryPool's vertex format does not match the cube's compression.");
+                    throw std::runtime_error("GeometryPool vertex format mismatch.");
+                }
+
+                generateData();
+                const void* vertices = compression_ != VertexCompression::None ? static_cast<const void*>(packed_.data()) : vertices_.data();
+                allocation_ = pool.upload(vertices, static_cast<std::uint32_t>(vertices_.size() * sizeof(GLfloat) / PositionNormalVertex::stride), indices_.data(), static_cast<std::uint32_t>(indices_.size()));
+            }
+
             Cube::~Cube() {
+                upload_.wait(); // The loader may still be filling the buffers
+                if (pool_) {
+                    pool_->free(allocation_);
+                }
                 // Cleanup is handled by the destructors of VAO_, VBO_, and EBO_
             }
 
@@ -93,6 +130,19 @@ namespace Gem {
                     20, 23, 22,
                     22, 21, 20
                 };
+
+                if (compression_ != VertexCompression::None) {
+                    // Each face maps the whole texture, from its first (bottom-left) vertex counter-clockwise
+                    std::vector<GLfloat> texcoords;
+                    texcoords.reserve(24 * 2);
+                    for (int face = 0; face < 6; ++face) {
+                        texcoords.insert(texcoords.end(), { 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f });
+                    }
+
+                    const std::size_t vertexCount = vertices_.size() / 6;
+                    bounds_ = compute_position_bounds(vertices_.data(), vertexCount);
+                    packed_ = compress_vertices(compression_, vertices_.data(), texcoords.data(), vertexCount, bounds_);
+                }
             }
 
             const std::vector<GLfloat>& Cube::getVertices() const {
@@ -112,41 +162,91 @@ namespace Gem {
                 VAO_.bind();
 
                 // Upload vertex and index data to GPU
-                VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                if (compression_ != VertexCompression::None) {
+                    VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+                }
+                else {
+                    VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                }
                 EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
 
-                // Link the position attribute (location = 0)
-                VAO_.link_attrib(
-                    VBO_,                   // VBO
-                    0,                      // Attribute location in the shader
-                    3,                      // Number of components (x, y, z)
-                    GL_FLOAT,               // Data type
-                    6 * sizeof(GLfloat),    // Stride (total size of a vertex)
-                    (void*)0,               // Offset (start of position data)
-                    GL_FALSE                // Normalized
-                );
-
-                // Link the normal attribute (location = 2)
-                VAO_.link_attrib(
-                    VBO_,                             // VBO
-                    2,                                // Attribute location in the shader
-                    3,                                // Number of components (nx, ny, nz)
-                    GL_FLOAT,                         // Data type
-                    6 * sizeof(GLfloat),              // Stride (total size of a vertex)
-                    (void*)(3 * sizeof(GLfloat)),     // Offset (after position data)
-                    GL_FALSE                          // Normalized
-                );
+                // The element buffer is VAO state: attach it explicitly, set_data() may not bind it
+                VAO_.link_element_buffer(EBO_);
+                linkAttributes();
 
                 // Unbind VAO to prevent accidental modifications
                 VAO_.unbind();
             }
 
+            void Cube::uploadBuffers() {
+                VBO_.generate();
+                EBO_.generate();
+
+                // No VAO is bound in the loader's context, so binding the EBO changes nothing else
+                if (compression_ != VertexCompression::None) {
+                    VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+                }
+                else {
+                    VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                }
+                EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
+
+                VBO_.unbind();
+                EBO_.unbind();
+            }
+
+            void Cube::linkAttributes() {
+                // Position at location 0, normal at location 2 and, when compressed, UV at location 1 (VertexLocation)
+                link_vertex_format(VAO_, VBO_, compression_);
+            }
+
             void Cube::render() const {
+                if (!ready_) {
+                    return;
+                }
+                if (pool_) {
+                    pool_->draw(allocation_, GL_TRIANGLES);
+                    return;
+                }
                 VAO_.bind();
                 Gem::GL::draw_elements(GL_TRIANGLES, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, 0);
                 VAO_.unbind();
             }
 
+            Mesh Cube::get_mesh() const noexcept {
+                Mesh mesh;
+                if (!ready_) {
+                    return mesh;    // Empty until is_ready()
+                }
+                if (pool_) {
+                    return pool_->get_mesh(allocation_, GL_TRIANGLES);
+                }
+                mesh.vao = VAO_.get_ID();
+                mesh.mode = GL_TRIANGLES;
+                mesh.count = static_cast<GLsizei>(indices_.size());
+                mesh.index_type = GL_UNSIGNED_INT;
+                return mesh;
+            }
+
+            VertexCompression Cube::get_vertex_compression() const noexcept {
+                return compression_;
+            }
+
+            const PositionBounds& Cube::get_position_bounds() const noexcept {
+                return bounds_;
+            }
+
+            bool Cube::is_ready() {
+                if (!ready_ && upload_.is_ready()) {
+                    VAO_.generate();
+                    VAO_.link_element_buffer(EBO_);
+                    linkAttributes();
+                    VAO_.unbind();
+                    ready_ = true;
+                }
+                return ready_;
+            }
+
         } // namespace Shapes
     } // namespace Graphics
 } // namespace Gem
\ No newline at end of file
@@ -1,12 +1,13 @@
 #include <Gem/Graphics/shapes/plane.h>
-#include <iostream>
+#include <Gem/Core/Logger.h>
+#include <stdexcept>
 
 namespace Gem {
     namespace Graphics {
         namespace Shapes {
 
-            Plane::Plane(float width, float height, unsigned int segments)
-                : width_(width), height_(height), segments_(segments),
+            Plane::Plane(float width, float height, unsigned int segments, VertexCompression compression)
+                : width_(width), height_(height), segments_(segments), compression_(compression),
                 VAO_(),
                 VBO_(GL_ARRAY_BUFFER),
                 EBO_(GL_ELEMENT_ARRAY_BUFFER) {
@@ -15,7 +16,43 @@ namespace Gem {
                 initialize();
             }
 
+            Plane::Plane(float width, float height, unsigned int segments, AsyncLoader& loader, VertexCompression compression)
+                : width_(width), height_(height), segments_(segments), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER) {
+
+                // VAOs are not shared between contexts: is_ready() sets it up once the buffers have landed
+                ready_ = false;
+                upload_ = loader.submit([this]() {
+                    generateData();
+                    uploadBuffers();
+                });
+            }
+
+            Plane::Plane(float width, float height, unsigned int segments, GeometryPool& pool, VertexCompression compression)
+                : width_(width), height_(height), segments_(segments), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER),
+                pool_(&pool) {
+
+                // Drawn with the pool's VAO and buffers: VAO_, VBO_ and EBO_ are never generated
+                if (pool.get_vertex_stride() != get_vertex_stride(compression_)) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "Plane: the GeometryPool's vertex format does not match the plane's compression.");
+                    throw std::runtime_error("GeometryPool vertex format mismatch.");
+                }
+
+                generateData();
+                const void* vertices = compression_ != VertexCompression::None ? static_cast<const void*>(packed_.data()) : vertices_.data();
+                allocation_ = pool.upload(vertices, static_cast<std::uint32_t>(vertices_.size() * sizeof(GLfloat) / PositionNormalVertex::stride), indices_.data(), static_cast<std::uint32_t>(indices_.size()));
+            }
+
             Plane::~Plane() {
+                upload_.wait(); // The loader may still be filling the buffers
+                if (pool_) {
+                    pool_->free(allocation_);
+                }
                 // Cleanup is handled by the destructors of VAO_, VBO_, and EBO_
             }
 
@@ -79,6 +116,18 @@ namespace Gem {
                         indices_[indexCount++] = topRight;
                     }
                 }
+
+                if (compression_ != VertexCompression::None) {
+                    // The texture spans the whole plane
+                    std::vector<GLfloat> texcoords(numVertices * 2);
+                    for (unsigned int i = 0; i < numVertices; ++i) {
+                        texcoords[i * 2] = static_cast<float>(i % numVerticesX) / static_cast<float>(segments_);
+                        texcoords[i * 2 + 1] = static_cast<float>(i / numVerticesX) / static_cast<float>(segments_);
+                    }
+
+                    bounds_ = compute_position_bounds(vertices_.data(), numVertices);
+                    packed_ = compress_vertices(compression_, vertices_.data(), texcoords.data(), numVertices, bounds_);
+                }
             }
 
             const std::vector<GLfloat>& Plane::getVertices() const {
@@ -98,41 +147,91 @@ namespace Gem {
                 VAO_.bind();
 
                 // Upload vertex and index data to GPU
-                VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                if (compression_ != VertexCompression::None) {
+                    VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+                }
+                else {
+                    VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                }
                 EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
 
-                // Link the position attribute (location = 0)
-                VAO_.link_attrib(
-                    VBO_,                   // VBO
-                    0,                      // Attribute location in the shader
-                    3,                      // Number of components (x, y, z)
-                    GL_FLOAT,               // Data type
-                    6 * sizeof(GLfloat),    // Stride (total size of a vertex)
-                    (void*)0,               // Offset (start of position data)
-                    GL_FALSE                // Normalized
-                );
-
-                // Link the normal attribute (location = 2)
-                VAO_.link_attrib(
-                    VBO_,                             // VBO
-                    2,                                // Attribute location in the shader
-                    3,                                // Number of components (nx, ny, nz)
-                    GL_FLOAT,                         // Data type
-                    6 * sizeof(GLfloat),              // Stride (total size of a vertex)
-                    (void*)(3 * sizeof(GLfloat)),     // Offset (after position data)
-                    GL_FALSE                          // Normalized
-                );
+                // The element buffer is VAO state: attach it explicitly, set_data() may not bind it
+                VAO_.link_element_buffer(EBO_);
+                linkAttributes();
 
                 // Unbind VAO to prevent accidental modifications
                 VAO_.unbind();
             }
 
+            void Plane::uploadBuffers() {
+                VBO_.generate();
+                EBO_.generate();
+
+                // No VAO is bound in the loader's context, so binding the EBO changes nothing else
+                if (compression_ != VertexCompression::None) {
+                    VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+                }
+                else {
+                    VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+                }
+                EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
+
+                VBO_.unbind();
+                EBO_.unbind();
+            }
+
+            void Plane::linkAttributes() {
+                // Position at location 0, normal at location 2 and, when compressed, UV at location 1 (VertexLocation)
+                link_vertex_format(VAO_, VBO_, compression_);
+            }
+
             void Plane::render() const {
+                if (!ready_) {
+                    return;
+                }
+                if (pool_) {
+                    pool_->draw(allocation_, GL_TRIANGLES);
+                    return;
+                }
                 VAO_.bind();
                 Gem::GL::draw_elements(GL_TRIANGLES, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, 0);
                 VAO_.unbind();
             }
 
+            Mesh Plane::get_mesh() const noexcept {
+                Mesh mesh;
+                if (!ready_) {
+                    return mesh;    // Empty until is_ready()
+                }
+                if (pool_) {
+                    return pool_->get_mesh(allocation_, GL_TRIANGLES);
+                }
+                mesh.vao = VAO_.get_ID();
+                mesh.mode = GL_TRIANGLES;
+                mesh.count = static_cast<GLsizei>(indices_.size());
+                mesh.index_type = GL_UNSIGNED_INT;
+                return mesh;
+            }
+
+            VertexCompression Plane::get_vertex_compression() const noexcept {
+                return compression_;
+            }
+
+            const PositionBounds& Plane::get_position_bounds() const noexcept {
+                return bounds_;
+            }
+
+            bool Plane::is_ready() {
+                if (!ready_ && upload_.is_ready()) {
+                    VAO_.generate();
+                    VAO_.link_element_buffer(EBO_);
+                    linkAttributes();
+                    VAO_.unbind();
+                    ready_ = true;
+                }
+                return ready_;
+            }
+
         } // namespace Shapes
     } // namespace Graphics
 } // namespace Gem
\ No newline at end of file
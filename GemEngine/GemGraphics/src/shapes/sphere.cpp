@@ -1,5 +1,7 @@
 #include <Gem/Graphics/shapes/sphere.h>
-#include <iostream>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/JobSystem.h>
+#include <stdexcept>
 #include <cmath>
 
 namespace Gem {
@@ -8,8 +10,8 @@ namespace Gem {
 
             constexpr float M_PI = 3.14159265358979;
             
-            Sphere::Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments)
-				: radius_(radius), latitudeSegments_(latitudeSegments), longitudeSegments_(longitudeSegments),
+            Sphere::Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments, VertexCompression compression)
+				: latitudeSegments_(latitudeSegments), longitudeSegments_(longitudeSegments), radius_(radius), compression_(compression),
 				VAO_(),
 				VBO_(GL_ARRAY_BUFFER),
 				EBO_(GL_ELEMENT_ARRAY_BUFFER) {
@@ -18,8 +20,44 @@ namespace Gem {
                 initialize();
             }
 
+            Sphere::Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments, AsyncLoader& loader, VertexCompression compression)
+                : latitudeSegments_(latitudeSegments), longitudeSegments_(longitudeSegments), radius_(radius), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER) {
+
+                // VAOs are not shared between contexts: is_ready() sets it up once the buffers have landed
+                ready_ = false;
+                upload_ = loader.submit([this]() {
+                    generateData();
+                    uploadBuffers();
+                });
+            }
+
+            Sphere::Sphere(float radius, unsigned int latitudeSegments, unsigned int longitudeSegments, GeometryPool& pool, VertexCompression compression)
+                : latitudeSegments_(latitudeSegments), longitudeSegments_(longitudeSegments), radius_(radius), compression_(compression),
+                VAO_(),
+                VBO_(GL_ARRAY_BUFFER),
+                EBO_(GL_ELEMENT_ARRAY_BUFFER),
+                pool_(&pool) {
+
+                // Drawn with the pool's VAO and buffers: VAO_, VBO_ and EBO_ are never generated
+                if (pool.get_vertex_stride() != get_vertex_stride(compression_)) {
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "Sphere: the GeometryPool's vertex format does not match the sphere's compression.");
+                    throw std::runtime_error("GeometryPool vertex format mismatch.");
+                }
+
+                generateData();
+                const void* vertices = compression_ != VertexCompression::None ? static_cast<const void*>(packed_.data()) : vertices_.data();
+                allocation_ = pool.upload(vertices, static_cast<std::uint32_t>(vertices_.size() * sizeof(GLfloat) / PositionNormalVertex::stride), indices_.data(), static_cast<std::uint32_t>(indices_.size()));
+            }
+
             Sphere::~Sphere() {
-				// Already done in destructor
+                upload_.wait(); // The loader may still be filling the buffers
+                if (pool_) {
+                    pool_->free(allocation_);
+                }
+                // Cleanup is handled by the destructors of VAO_, VBO_, and EBO_
             }
 
 			void Sphere::generateData() {
@@ -53,36 +91,39 @@ namespace Gem {
 					cosY[y] = std::cos(angleY);
 				}
 
-				// Generate vertices and normals
-				unsigned int vertexIndex = 0;
-				for (unsigned int y = 0; y <= latitudeSegments_; ++y) {
-					float sinY_val = sinY[y];
-					float cosY_val = cosY[y];
-					for (unsigned int x = 0; x <= longitudeSegments_; ++x) {
-						float sinX_val = sinX[x];
-						float cosX_val = cosX[x];
-
-						// Calculate position using radius_
-						float posX = radius_ * cosX_val * sinY_val;
-						float posY = radius_ * cosY_val;
-						float posZ = radius_ * sinX_val * sinY_val;
-
-						// Normal vector (normalize position vector for the normal)
-						float nx = cosX_val * sinY_val;
-						float ny = cosY_val;
-						float nz = sinX_val * sinY_val;
-
-						// Position
-						vertices_[vertexIndex++] = posX;
-						vertices_[vertexIndex++] = posY;
-						vertices_[vertexIndex++] = posZ;
-
-						// Normal
-						vertices_[vertexIndex++] = nx;
-						vertices_[vertexIndex++] = ny;
-						vertices_[vertexIndex++] = nz;
+				// Generate vertices and normals, one latitude row per index (rows are independent)
+				const unsigned int rowFloats = (longitudeSegments_ + 1) * 6;
+				JobSystem::parallelFor(0, latitudeSegments_ + 1, 16, [&](std::size_t firstRow, std::size_t lastRow) {
+					for (std::size_t y = firstRow; y < lastRow; ++y) {
+						float sinY_val = sinY[y];
+						float cosY_val = cosY[y];
+						unsigned int vertexIndex = static_cast<unsigned int>(y) * rowFloats;
+						for (unsigned int x = 0; x <= longitudeSegments_; ++x) {
+							float sinX_val = sinX[x];
+							float cosX_val = cosX[x];
+
+							// Calculate position using radius_
+							float posX = radius_ * cosX_val * sinY_val;
+							float posY = radius_ * cosY_val;
+							float posZ = radius_ * sinX_val * sinY_val;
+
+							// Normal vector (normalize position vector for the normal)
+							float nx = cosX_val * sinY_val;
+							float ny = cosY_val;
+							float nz = sinX_val * sinY_val;
+
+							// Position
+							vertices_[vertexIndex++] = posX;
+							vertices_[vertexIndex++] = posY;
+							vertices_[vertexIndex++] = posZ;
+
+							// Normal
+							vertices_[vertexIndex++] = nx;
+							vertices_[vertexIndex++] = ny;
+							vertices_[vertexIndex++] = nz;
+						}
 					}
-				}
+				});
 
 				// Generate indices (same as before)
 				unsigned int index = 0;
@@ -102,6 +143,18 @@ namespace Gem {
 						}
 					}
 				}
+
+				if (compression_ != VertexCompression::None) {
+					// Longitude along u, latitude along v
+					std::vector<GLfloat> texcoords(numVertices * 2);
+					for (unsigned int i = 0; i < numVertices; ++i) {
+						texcoords[i * 2] = static_cast<float>(i % (longitudeSegments_ + 1)) / longitudeSegments_;
+						texcoords[i * 2 + 1] = static_cast<float>(i / (longitudeSegments_ + 1)) / latitudeSegments_;
+					}
+
+					bounds_ = compute_position_bounds(vertices_.data(), numVertices);
+					packed_ = compress_vertices(compression_, vertices_.data(), texcoords.data(), numVertices, bounds_);
+				}
 			}
 
 
@@ -123,43 +176,92 @@ namespace Gem {
 				VAO_.bind();
 
 				// Upload vertex and index data to GPU
-				VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+				if (compression_ != VertexCompression::None) {
+					VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+				}
+				else {
+					VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+				}
 				EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
 
-				// Link the position attribute (location = 0)
-				// Each vertex consists of 6 floats: 3 for position, 3 for normal
-				VAO_.link_attrib(
-					VBO_,				    // VBO
-					0,                    // Attribute location in the shader
-					3,                    // Number of components (x, y, z)
-					GL_FLOAT,             // Data type
-					6 * sizeof(GLfloat),  // Stride (total size of a vertex)
-					(void*)0,             // Offset (start of position data)
-					GL_FALSE              // Normalized
-				);
-
-				// Link the normal attribute (location = 1)
-				VAO_.link_attrib(
-					VBO_,                             // VBO
-					2,                                // Attribute location in the shader
-					3,                                // Number of components (nx, ny, nz)
-					GL_FLOAT,                         // Data type
-					6 * sizeof(GLfloat),              // Stride (total size of a vertex)
-					(void*)(3 * sizeof(GLfloat)),     // Offset (after position data)
-					GL_FALSE                          // Normalized
-				);
+				// The element buffer is VAO state: attach it explicitly, set_data() may not bind it
+				VAO_.link_element_buffer(EBO_);
+				linkAttributes();
 
 				// Unbind VAO to prevent accidental modifications
 				VAO_.unbind();
 			}
 
+			void Sphere::uploadBuffers() {
+				VBO_.generate();
+				EBO_.generate();
+
+				// No VAO is bound in the loader's context, so binding the EBO changes nothing else
+				if (compression_ != VertexCompression::None) {
+					VBO_.set_data(packed_.size(), packed_.data(), GL_STATIC_DRAW);
+				}
+				else {
+					VBO_.set_data(vertices_.size() * sizeof(float), vertices_.data(), GL_STATIC_DRAW);
+				}
+				EBO_.set_data(indices_.size() * sizeof(unsigned int), indices_.data(), GL_STATIC_DRAW);
+
+				VBO_.unbind();
+				EBO_.unbind();
+			}
+
+			void Sphere::linkAttributes() {
+				// Position at location 0, normal at location 2 and, when compressed, UV at location 1 (VertexLocation)
+				link_vertex_format(VAO_, VBO_, compression_);
+			}
+
 
             void Sphere::render() const {
+                if (!ready_) {
+                    return;
+                }
+                if (pool_) {
+                    pool_->draw(allocation_, GL_TRIANGLE_STRIP);
+                    return;
+                }
                 VAO_.bind();
                 Gem::GL::draw_elements(GL_TRIANGLE_STRIP, static_cast<GLsizei>(indices_.size()), GL_UNSIGNED_INT, 0);
                 VAO_.unbind();
             }
 
+            Mesh Sphere::get_mesh() const noexcept {
+                Mesh mesh;
+                if (!ready_) {
+                    return mesh;    // Empty until is_ready()
+                }
+                if (pool_) {
+                    return pool_->get_mesh(allocation_, GL_TRIANGLE_STRIP);
+                }
+                mesh.vao = VAO_.get_ID();
+                mesh.mode = GL_TRIANGLE_STRIP;
+                mesh.count = static_cast<GLsizei>(indices_.size());
+                mesh.index_type = GL_UNSIGNED_INT;
+                return mesh;
+            }
+
+            VertexCompression Sphere::get_vertex_compression() const noexcept {
+                return compression_;
+            }
+
+            const PositionBounds& Sphere::get_position_bounds() const noexcept {
+                return bounds_;
+            }
+
+            bool Sphere::is_ready() {
+                if (!ready_ && upload_.is_ready()) {
+                    VAO_.generate();
+                    VAO_.link_element_buffer(EBO_);
+                    linkAttributes();
+                    VAO_.unbind();
+                    ready_ = true;
+                }
+                return ready_;
+            }
+
         } // namespace Shapes
     } // namespace Graphics
 } // namespace Gem
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include <Gem/Graphics/stream_buffer.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            Metrics::Counter stream_bytes_("stream.bytes");
+            Metrics::Counter stream_overflows_("stream.overflows");
+            Metrics::Counter stream_waits_("stream.waits");       // next_frame() found the GPU still reading the region
+
+            constexpr GLbitfield MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            constexpr GLuint64 WAIT_SLICE_NS = 1000000;     // 1 ms per glClientWaitSync
+
+            GLsizeiptr alignUp(GLsizeiptr value, GLsizeiptr alignment) noexcept {
+                return (value + alignment - 1) & ~(alignment - 1);
+            }
+
+            GLsizeiptr offsetAlignment(GLenum target) {
+                GLenum pname = GL_NONE;
+                switch (target) {
+                case GL_UNIFORM_BUFFER:         pname = GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT; break;
+                case GL_SHADER_STORAGE_BUFFER:  pname = GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT; break;
+                default:                        return 16;
+                }
+
+                GLint alignment = 0;
+                GL::get_integerv(pname, &alignment);
+                return alignment > 0 ? alignment : 256;     // The largest value the spec allows
+            }
+
+        } // namespace
+
+        // Constructor
+        StreamBuffer::StreamBuffer(GLsizeiptr frame_size, unsigned int frame_count, GLenum target)
+            : target_(target), frame_size_(frame_size), frame_count_(frame_count) {
+            if (!is_supported()) {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "StreamBuffer: glBufferStorage is not available (needs GL 4.4 or ARB_buffer_storage).");
+                throw std::runtime_error("StreamBuffer needs buffer storage support!");
+            }
+            if (frame_size <= 0 || frame_count == 0) {
+                throw std::runtime_error("StreamBuffer needs a non-empty frame size and at least one frame!");
+            }
+
+            alignment_ = offsetAlignment(target);
+            frame_size_ = alignUp(frame_size, alignment_);
+            fences_.assign(frame_count_, nullptr);
+
+            const GLsizeiptr size = frame_size_ * frame_count_;
+
+            GL::gen_buffers(1, &ID_);
+            GL::bind_buffer(target_, ID_);
+            GL::buffer_storage(target_, size, nullptr, MAP_FLAGS);
+            mapping_ = static_cast<std::byte*>(GL::map_buffer_range(target_, 0, size, MAP_FLAGS));
+            GL::bind_buffer(target_, 0);
+
+            if (!mapping_) {
+                GL::delete_buffers(1, &ID_);
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "StreamBuffer: failed to map {} bytes.", size);
+                throw std::runtime_error("StreamBuffer failed to map its buffer!");
+            }
+
+            GEM_LOG_DEBUG(Logger::Channel::Graphics, "StreamBuffer: {} x {} bytes, alignment {}.", frame_count_, frame_size_, alignment_);
+        }
+
+        // Destructor
+        StreamBuffer::~StreamBuffer() {
+            for (GLsync fence : fences_) {
+                if (fence) {
+                    GL::delete_sync(fence);
+                }
+            }
+
+            if (ID_ != 0) {
+                GL::bind_buffer(target_, ID_);
+                GL::unmap_buffer(target_);
+                GL::bind_buffer(target_, 0);
+                GL::delete_buffers(1, &ID_);
+            }
+        }
+
+        // Check for buffer storage support
+        bool StreamBuffer::is_supported() noexcept {
+            // Loaded by GLAD from GL 4.4 or ARB_buffer_storage
+            return glBufferStorage != nullptr;
+        }
+
+        // Fence the region just filled and move to the next one
+        void StreamBuffer::next_frame() {
+            fences_[frame_] = GL::fence_sync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+            frame_ = (frame_ + 1) % frame_count_;
+            used_ = 0;
+
+            GLsync& fence = fences_[frame_];
+            if (!fence) {
+                return;
+            }
+
+            GLenum result = GL::client_wait_sync(fence, 0, 0);
+            if (result == GL_TIMEOUT_EXPIRED) {
+                GEM_PROFILE_ZONE("StreamBuffer wait");
+                stream_waits_.add();
+
+                while (result == GL_TIMEOUT_EXPIRED) {
+                    result = GL::client_wait_sync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_SLICE_NS);
+                }
+            }
+            if (result == GL_WAIT_FAILED) {
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "StreamBuffer: glClientWaitSync failed.");
+            }
+
+            GL::delete_sync(fence);
+            fence = nullptr;
+        }
+
+        // Allocate with the target's alignment
+        StreamBuffer::Allocation StreamBuffer::allocate(GLsizeiptr size) {
+            return allocate(size, alignment_);
+        }
+
+        // Bump-allocate from the current region
+        StreamBuffer::Allocation StreamBuffer::allocate(GLsizeiptr size, GLsizeiptr alignment) {
+            const GLsizeiptr start = alignUp(used_, alignment);
+            if (size <= 0 || start + size > frame_size_) {
+                stream_overflows_.add();
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "StreamBuffer: cannot allocate {} bytes, {} of {} used this frame.", size, used_, frame_size_);
+                return {};
+            }
+            used_ = start + size;
+
+            Allocation allocation;
+            allocation.offset = static_cast<GLintptr>(frame_ * frame_size_ + start);
+            allocation.data = mapping_ + allocation.offset;
+            allocation.size = size;
+
+            GL::mark_mapped_write(ID_, allocation.offset, size, allocation.data);
+            stream_bytes_.add(static_cast<std::uint64_t>(size));
+            return allocation;
+        }
+
+        // Allocate and copy
+        StreamBuffer::Allocation StreamBuffer::write(const void* data, GLsizeiptr size) {
+            Allocation allocation = allocate(size);
+            if (allocation) {
+                std::memcpy(allocation.data, data, static_cast<std::size_t>(size));
+            }
+            return allocation;
+        }
+
+        // Bind an allocation to an indexed binding point
+        void StreamBuffer::bind_range(GLenum target, GLuint index, const Allocation& allocation) const {
+            GL::bind_buffer_range(target, index, ID_, allocation.offset, allocation.size);
+        }
+
+        // Get the buffer ID
+        GLuint StreamBuffer::get_ID() const noexcept {
+            return ID_;
+        }
+
+        // Get the region size
+        GLsizeiptr StreamBuffer::get_frame_size() const noexcept {
+            return frame_size_;
+        }
+
+        // Get the number of regions
+        unsigned int StreamBuffer::get_frame_count() const noexcept {
+            return frame_count_;
+        }
+
+        // Get the bytes used in the current region
+        GLsizeiptr StreamBuffer::get_used() const noexcept {
+            return used_;
+        }
+
+    } // namespace Graphics
+} // namespace Gem
@@ -1,9 +1,17 @@
 #include <Gem/Graphics/textures/tex_1D.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
 
 namespace Gem {
 
 	namespace Graphics {
 
+		namespace {
+
+			Metrics::Counter texture_binds_("gl.texture_binds");
+
+		} // namespace
+
 		// Constructor
 		Texture1D::Texture1D() {
 			init();
@@ -18,14 +26,12 @@ namespace Gem {
 		void Texture1D::init() {
 			generate();
 
-			bind(0); // Default binding to texture unit 0 for initialization
-
 			// Set default texture parameters
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-
-			unbind();
+			set_parameters({
+				{ GL_TEXTURE_MIN_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_MAG_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_WRAP_S, GL_REPEAT }
+			});
 
 			is_initialized_ = true;
 		}
@@ -38,8 +44,14 @@ namespace Gem {
 
 		// Bind the texture
 		void Texture1D::bind(GLuint texture_unit) const {
-			GL::active_texture(GL_TEXTURE0 + texture_unit);
-			GL::bind_texture(GL_TEXTURE_1D, texture_ID_);
+			if (GL::has_direct_state_access()) {
+				GL::bind_texture_unit(texture_unit, GL_TEXTURE_1D, texture_ID_);	// Leaves the active unit alone
+			}
+			else {
+				GL::active_texture(GL_TEXTURE0 + texture_unit);
+				GL::bind_texture(GL_TEXTURE_1D, texture_ID_);
+			}
+			texture_binds_.add();
 		}
 
 		// Unbind the texture
@@ -50,9 +62,13 @@ namespace Gem {
 		// Generate mipmaps
 		void Texture1D::generate_mipmaps() const {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture1D::generate_mipmaps: Texture not initialized." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture1D::generate_mipmaps: Texture not initialized.");
 				throw std::runtime_error("Texture not initialized.");
 			}
+			if (GL::has_direct_state_access()) {
+				GL::generate_texture_mipmap(texture_ID_);
+				return;
+			}
 			bind(0); // Bind to any texture unit, here 0
 			GL::generate_mipmap(GL_TEXTURE_1D);
 			unbind();
@@ -61,7 +77,7 @@ namespace Gem {
 		// Load a texture from an image file
 		void Texture1D::load_texture(const std::string& texture_name) {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture1D::load_texture: Texture not initialized. Call init() first." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture1D::load_texture: Texture not initialized. Call init() first.");
 				throw std::runtime_error("Texture not initialized.");
 			}
 
@@ -73,22 +89,40 @@ namespace Gem {
 			unsigned char* texture_data = stbi_load(full_filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
 
 			if (!texture_data) {
-				std::cerr << "ERROR::Texture1D::load_texture: Failed to load texture '" << full_filename << "'.\nTry to change the path with set_path() to your local texture folder." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture1D::load_texture: Failed to load texture '{}'.\nTry to change the path with set_path() to your local texture folder.", full_filename);
 				return;
 			}
 
 			if (height != 1) {
-				std::cerr << "ERROR::Texture1D::load_texture: Image height must be 1 for 1D textures." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture1D::load_texture: Image height must be 1 for 1D textures.");
 				stbi_image_free(texture_data);
 				return;
 			}
 
-			width_ = static_cast<GLuint>(width);
+			if (GL::has_direct_state_access()) {
+				// Immutable storage: allocated with the full mip chain on the first load, only re-uploaded after.
+				// A new width needs a new texture, as glTexImage1D would resize it without direct state access
+				if (width_ != 0 && width_ != static_cast<GLuint>(width)) {
+					recreate();
+					width_ = 0;
+				}
+				if (width_ == 0) {
+					GL::texture_storage_1d(texture_ID_, get_mip_levels(static_cast<GLuint>(width)), GL_RGBA8, width);
+				}
+
+				width_ = static_cast<GLuint>(width);
+
+				// Upload the texture data to the GPU
+				GL::texture_sub_image_1d(texture_ID_, 0, 0, width_, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+			}
+			else {
+				width_ = static_cast<GLuint>(width);
 
-			// Upload the texture data to the GPU
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_image_1d(GL_TEXTURE_1D, 0, GL_RGBA8, width_, 0, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
-			unbind();
+				// Upload the texture data to the GPU
+				bind(0); // Bind to any texture unit, here 0
+				GL::tex_image_1d(GL_TEXTURE_1D, 0, GL_RGBA8, width_, 0, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+				unbind();
+			}
 
 			// Free the loaded texture data
 			stbi_image_free(texture_data);
@@ -96,30 +130,22 @@ namespace Gem {
 
 		// Set the min filter parameter
 		void Texture1D::set_min_filter(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MIN_FILTER, param } });
 		}
 
 		// Set the mag filter parameter
 		void Texture1D::set_mag_filter(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MAG_FILTER, param } });
 		}
 
 		// Set the wrap parameter
 		void Texture1D::set_wrap(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param } });
 		}
 
 		// Set the wrap S parameter
 		void Texture1D::set_wrap_s(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param } });
 		}
 
 		// Get the width of the texture
@@ -127,6 +153,11 @@ namespace Gem {
 			return width_;
 		}
 
+		// Get the texture target
+		GLenum Texture1D::get_target() const noexcept {
+			return GL_TEXTURE_1D;
+		}
+
 		// Equality operator
 		bool Texture1D::operator==(const Texture1D& other) const noexcept {
 			return texture_ID_ == other.texture_ID_;
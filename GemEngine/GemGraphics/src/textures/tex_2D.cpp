@@ -1,9 +1,19 @@
 #include <Gem/Graphics/textures/tex_2d.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
+
+#include <algorithm>
 
 namespace Gem {
 
 	namespace Graphics {
 
+		namespace {
+
+			Metrics::Counter texture_binds_("gl.texture_binds");
+
+		} // namespace
+
 		// Constructor
 		Texture2D::Texture2D() {
 			init();
@@ -18,15 +28,13 @@ namespace Gem {
 		void Texture2D::init() {
 			generate();
 
-			bind(0); // Default binding to texture unit 0 for initialization
-
 			// Set default texture parameters
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-			unbind();
+			set_parameters({
+				{ GL_TEXTURE_MIN_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_MAG_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_WRAP_S, GL_REPEAT },
+				{ GL_TEXTURE_WRAP_T, GL_REPEAT }
+			});
 
 			is_initialized_ = true;
 		}
@@ -39,8 +47,14 @@ namespace Gem {
 
 		// Bind the texture
 		void Texture2D::bind(GLuint texture_unit) const {
-			GL::active_texture(GL_TEXTURE0 + texture_unit);
-			GL::bind_texture(GL_TEXTURE_2D, texture_ID_);
+			if (GL::has_direct_state_access()) {
+				GL::bind_texture_unit(texture_unit, GL_TEXTURE_2D, texture_ID_);	// Leaves the active unit alone
+			}
+			else {
+				GL::active_texture(GL_TEXTURE0 + texture_unit);
+				GL::bind_texture(GL_TEXTURE_2D, texture_ID_);
+			}
+			texture_binds_.add();
 		}
 
 		// Unbind the texture
@@ -51,9 +65,13 @@ namespace Gem {
 		// Generate mipmaps
 		void Texture2D::generate_mipmaps() const {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture2D::generate_mipmaps: Texture not initialized." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2D::generate_mipmaps: Texture not initialized.");
 				throw std::runtime_error("Texture not initialized.");
 			}
+			if (GL::has_direct_state_access()) {
+				GL::generate_texture_mipmap(texture_ID_);
+				return;
+			}
 			bind(0); // Bind to any texture unit, here 0
 			GL::generate_mipmap(GL_TEXTURE_2D);
 			unbind();
@@ -62,7 +80,7 @@ namespace Gem {
 		// Load a texture from an image file
 		void Texture2D::load_texture(const std::string& texture_name) {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture2D::load_texture: Texture not initialized. Call init() first." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2D::load_texture: Texture not initialized. Call init() first.");
 				throw std::runtime_error("Texture not initialized.");
 			}
 
@@ -74,56 +92,75 @@ namespace Gem {
 			unsigned char* texture_data = stbi_load(full_filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
 
 			if (!texture_data) {
-				std::cerr << "ERROR::Texture2D::load_texture: Failed to load texture '" << full_filename << "'.\nTry to change the path with set_path() to your local texture folder." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2D::load_texture: Failed to load texture '{}'.\nTry to change the path with set_path() to your local texture folder.", full_filename);
 				return;
 			}
 
-			width_ = static_cast<GLuint>(width);
-			height_ = static_cast<GLuint>(height);
-
-			// Upload the texture data to the GPU
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_image_2d(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
-			unbind();
+			if (GL::has_direct_state_access()) {
+				// Immutable storage: allocated with the full mip chain on the first load, only re-uploaded after.
+				// A new size needs a new texture, as glTexImage2D would resize it without direct state access
+				if (width_ != 0 && (width_ != static_cast<GLuint>(width) || height_ != static_cast<GLuint>(height))) {
+					recreate();
+					width_ = 0;
+				}
+				if (width_ == 0) {
+					GL::texture_storage_2d(texture_ID_, get_mip_levels(static_cast<GLuint>(std::max(width, height))), GL_RGBA8, width, height);
+				}
+
+				width_ = static_cast<GLuint>(width);
+				height_ = static_cast<GLuint>(height);
+
+				// Upload the texture data to the GPU
+				GL::texture_sub_image_2d(texture_ID_, 0, 0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+			}
+			else {
+				width_ = static_cast<GLuint>(width);
+				height_ = static_cast<GLuint>(height);
+
+				// Upload the texture data to the GPU
+				bind(0); // Bind to any texture unit, here 0
+				GL::tex_image_2d(GL_TEXTURE_2D, 0, GL_RGBA8, width_, height_, 0, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+				unbind();
+			}
 
 			// Free the loaded texture data
 			stbi_image_free(texture_data);
 		}
 
+		// Load a texture on the loader thread
+		UploadHandle Texture2D::load_texture(const std::string& texture_name, AsyncLoader& loader) {
+			if (!is_initialized_) {
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2D::load_texture: Texture not initialized. Call init() first.");
+				throw std::runtime_error("Texture not initialized.");
+			}
+
+			// The texture name is shared with the loader's context
+			return loader.submit([this, texture_name]() { load_texture(texture_name); });
+		}
+
 		// Set the min filter parameter
 		void Texture2D::set_min_filter(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MIN_FILTER, param } });
 		}
 
 		// Set the mag filter parameter
 		void Texture2D::set_mag_filter(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MAG_FILTER, param } });
 		}
 
 		// Set the wrap parameter
 		void Texture2D::set_wrap(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, param);
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param }, { GL_TEXTURE_WRAP_T, param } });
 		}
 
 		// Set the wrap S parameter
 		void Texture2D::set_wrap_s(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param } });
 		}
 
 		// Set the wrap T parameter
 		void Texture2D::set_wrap_t(GLint param) {
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_parameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_T, param } });
 		}
 
 		// Get the width of the texture
@@ -136,6 +173,11 @@ namespace Gem {
 			return height_;
 		}
 
+		// Get the texture target
+		GLenum Texture2D::get_target() const noexcept {
+			return GL_TEXTURE_2D;
+		}
+
 		// Equality operator
 		bool Texture2D::operator==(const Texture2D& other) const noexcept {
 			return texture_ID_ == other.texture_ID_;
@@ -1,9 +1,17 @@
 #include <Gem/Graphics/textures/tex_2D_array.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
 
 namespace Gem {
 
 	namespace Graphics {
 
+		namespace {
+
+			Metrics::Counter texture_binds_("gl.texture_binds");
+
+		} // namespace
+
 		// Constructor
 		Texture2DArray::Texture2DArray(GLuint width, GLuint height, GLuint max_layers)
 			: width_(width), height_(height), max_layers_(max_layers) {
@@ -19,19 +27,24 @@ namespace Gem {
 		void Texture2DArray::init() {
 			generate();
 
-			bind(0); // Bind to texture unit 0 for initialization
-
 			// Allocate storage for the texture array
-			GL::tex_storage_3d(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, width_, height_, max_layers_);
+			if (GL::has_direct_state_access()) {
+				GL::texture_storage_3d(texture_ID_, 1, GL_RGBA8, width_, height_, max_layers_);
+			}
+			else {
+				bind(0); // Bind to texture unit 0 for initialization
+				GL::tex_storage_3d(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, width_, height_, max_layers_);
+				unbind();
+			}
 			is_storage_allocated_ = true;
 
 			// Set default texture parameters
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-			unbind();
+			set_parameters({
+				{ GL_TEXTURE_MIN_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_MAG_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_WRAP_S, GL_REPEAT },
+				{ GL_TEXTURE_WRAP_T, GL_REPEAT }
+			});
 
 			is_initialized_ = true;
 		}
@@ -44,8 +57,14 @@ namespace Gem {
 
 		// Bind the texture array
 		void Texture2DArray::bind(GLuint texture_unit) const {
-			GL::active_texture(GL_TEXTURE0 + texture_unit);
-			GL::bind_texture(GL_TEXTURE_2D_ARRAY, texture_ID_);
+			if (GL::has_direct_state_access()) {
+				GL::bind_texture_unit(texture_unit, GL_TEXTURE_2D_ARRAY, texture_ID_);	// Leaves the active unit alone
+			}
+			else {
+				GL::active_texture(GL_TEXTURE0 + texture_unit);
+				GL::bind_texture(GL_TEXTURE_2D_ARRAY, texture_ID_);
+			}
+			texture_binds_.add();
 		}
 
 		// Unbind the texture array
@@ -56,9 +75,13 @@ namespace Gem {
 		// Generate mipmaps
 		void Texture2DArray::generate_mipmaps() const {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture2DArray::generate_mipmaps: Texture array not initialized." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::generate_mipmaps: Texture array not initialized.");
 				throw std::runtime_error("Texture array not initialized.");
 			}
+			if (GL::has_direct_state_access()) {
+				GL::generate_texture_mipmap(texture_ID_);
+				return;
+			}
 			bind(0); // Bind to any texture unit, here 0
 			GL::generate_mipmap(GL_TEXTURE_2D_ARRAY);
 			unbind();
@@ -67,17 +90,17 @@ namespace Gem {
 		// Add a texture to the array
 		void Texture2DArray::add_texture(const std::string& texture_name) {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture2DArray::add_texture: Texture array not initialized. Call init() first." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Texture array not initialized. Call init() first.");
 				throw std::runtime_error("Texture array not initialized.");
 			}
 
 			if (!is_storage_allocated_) {
-				std::cerr << "ERROR::Texture2DArray::add_texture: Storage not allocated for texture array." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Storage not allocated for texture array.");
 				throw std::runtime_error("Texture array storage not allocated.");
 			}
 
 			if (layer_count_ >= max_layers_) {
-				std::cerr << "ERROR::Texture2DArray::add_texture: Maximum number of textures reached." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Maximum number of textures reached.");
 				return;
 			}
 
@@ -89,20 +112,25 @@ namespace Gem {
 			unsigned char* texture_data = stbi_load(full_filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
 
 			if (!texture_data) {
-				std::cerr << "ERROR::Texture2DArray::add_texture: Failed to load texture '" << full_filename << "'.\nTry to change the path with set_path() to your local texture folder." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Failed to load texture '{}'.\nTry to change the path with set_path() to your local texture folder.", full_filename);
 				return;
 			}
 
 			if (static_cast<GLuint>(width) != width_ || static_cast<GLuint>(height) != height_) {
-				std::cerr << "ERROR::Texture2DArray::add_texture: Texture dimensions do not match the array dimensions." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Texture dimensions do not match the array dimensions.");
 				stbi_image_free(texture_data);
 				return;
 			}
 
 			// Upload the texture data to the GPU
-			bind(0); // Bind to any texture unit, here 0
-			GL::tex_sub_image_3d(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer_count_, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
-			unbind();
+			if (GL::has_direct_state_access()) {
+				GL::texture_sub_image_3d(texture_ID_, 0, 0, 0, layer_count_, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+			}
+			else {
+				bind(0); // Bind to any texture unit, here 0
+				GL::tex_sub_image_3d(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer_count_, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data);
+				unbind();
+			}
 
 			// Free the loaded texture data
 			stbi_image_free(texture_data);
@@ -110,40 +138,40 @@ namespace Gem {
 			++layer_count_;
 		}
 
+		// Add a texture to the array on the loader thread
+		UploadHandle Texture2DArray::add_texture(const std::string& texture_name, AsyncLoader& loader) {
+			if (!is_initialized_) {
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture2DArray::add_texture: Texture array not initialized. Call init() first.");
+				throw std::runtime_error("Texture array not initialized.");
+			}
+
+			// The storage was allocated by init(); the loader's context shares it
+			return loader.submit([this, texture_name]() { add_texture(texture_name); });
+		}
+
 		// Set the min filter parameter
 		void Texture2DArray::set_min_filter(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MIN_FILTER, param } });
 		}
 
 		// Set the mag filter parameter
 		void Texture2DArray::set_mag_filter(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MAG_FILTER, param } });
 		}
 
 		// Set the wrap parameter
 		void Texture2DArray::set_wrap(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, param);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param }, { GL_TEXTURE_WRAP_T, param } });
 		}
 
 		// Set the wrap S parameter
 		void Texture2DArray::set_wrap_s(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param } });
 		}
 
 		// Set the wrap T parameter
 		void Texture2DArray::set_wrap_t(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_T, param } });
 		}
 
 		// Get the width of the textures
@@ -161,6 +189,11 @@ namespace Gem {
 			return layer_count_;
 		}
 
+		// Get the texture target
+		GLenum Texture2DArray::get_target() const noexcept {
+			return GL_TEXTURE_2D_ARRAY;
+		}
+
 		// Equality operator
 		bool Texture2DArray::operator==(const Texture2DArray& other) const noexcept {
 			return texture_ID_ == other.texture_ID_;
@@ -1,9 +1,17 @@
 #include <Gem/Graphics/textures/tex_3D.h>
+#include <Gem/Core/Logger.h>
+#include <Gem/Core/Metrics.h>
 
 namespace Gem {
 
 	namespace Graphics {
 
+		namespace {
+
+			Metrics::Counter texture_binds_("gl.texture_binds");
+
+		} // namespace
+
 		// Constructor
 		Texture3D::Texture3D() {
 			init();
@@ -18,16 +26,14 @@ namespace Gem {
 		void Texture3D::init() {
 			generate();
 
-			bind(0); // Default binding to texture unit 0 for initialization
-
 			// Set default texture parameters
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, GL_REPEAT);
-
-			unbind();
+			set_parameters({
+				{ GL_TEXTURE_MIN_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_MAG_FILTER, GL_LINEAR },
+				{ GL_TEXTURE_WRAP_S, GL_REPEAT },
+				{ GL_TEXTURE_WRAP_T, GL_REPEAT },
+				{ GL_TEXTURE_WRAP_R, GL_REPEAT }
+			});
 
 			is_initialized_ = true;
 		}
@@ -40,8 +46,14 @@ namespace Gem {
 
 		// Bind the texture
 		void Texture3D::bind(GLuint texture_unit) const {
-			GL::active_texture(GL_TEXTURE0 + texture_unit);
-			GL::bind_texture(GL_TEXTURE_3D, texture_ID_);
+			if (GL::has_direct_state_access()) {
+				GL::bind_texture_unit(texture_unit, GL_TEXTURE_3D, texture_ID_);	// Leaves the active unit alone
+			}
+			else {
+				GL::active_texture(GL_TEXTURE0 + texture_unit);
+				GL::bind_texture(GL_TEXTURE_3D, texture_ID_);
+			}
+			texture_binds_.add();
 		}
 
 		// Unbind the texture
@@ -52,9 +64,13 @@ namespace Gem {
 		// Generate mipmaps
 		void Texture3D::generate_mipmaps() const {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture3D::generate_mipmaps: Texture not initialized." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture3D::generate_mipmaps: Texture not initialized.");
 				throw std::runtime_error("Texture not initialized.");
 			}
+			if (GL::has_direct_state_access()) {
+				GL::generate_texture_mipmap(texture_ID_);
+				return;
+			}
 			bind(0); // Bind to any texture unit, here 0
 			GL::generate_mipmap(GL_TEXTURE_3D);
 			unbind();
@@ -63,12 +79,12 @@ namespace Gem {
 		// Load a 3D texture from a set of image files
 		void Texture3D::load_texture(const std::vector<std::string>& texture_names) {
 			if (!is_initialized_) {
-				std::cerr << "ERROR::Texture3D::load_texture: Texture not initialized. Call init() first." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture3D::load_texture: Texture not initialized. Call init() first.");
 				throw std::runtime_error("Texture not initialized.");
 			}
 
 			if (texture_names.empty()) {
-				std::cerr << "ERROR::Texture3D::load_texture: No texture names provided." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture3D::load_texture: No texture names provided.");
 				return;
 			}
 
@@ -83,7 +99,7 @@ namespace Gem {
 				unsigned char* texture_data = stbi_load(full_filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
 
 				if (!texture_data) {
-					std::cerr << "ERROR::Texture3D::load_texture: Failed to load texture '" << full_filename << "'.\nTry to change the path with set_path() to your local texture folder." << std::endl;
+					GEM_LOG_ERROR(Logger::Channel::Texture, "Texture3D::load_texture: Failed to load texture '{}'.\nTry to change the path with set_path() to your local texture folder.", full_filename);
 					// Free previously loaded images
 					for (auto data : texture_data_list) {
 						stbi_image_free(data);
@@ -98,7 +114,7 @@ namespace Gem {
 				}
 				else {
 					if (width != static_cast<int>(width_) || height != static_cast<int>(height_)) {
-						std::cerr << "ERROR::Texture3D::load_texture: Texture '" << full_filename << "' has different dimensions than previous textures." << std::endl;
+						GEM_LOG_ERROR(Logger::Channel::Texture, "Texture3D::load_texture: Texture '{}' has different dimensions than previous textures.", full_filename);
 						stbi_image_free(texture_data);
 						// Free previously loaded images
 						for (auto data : texture_data_list) {
@@ -113,16 +129,25 @@ namespace Gem {
 
 			depth_ = static_cast<GLuint>(texture_data_list.size());
 
-			// Allocate storage for the 3D texture
-			bind(0);
-			GL::tex_storage_3d(GL_TEXTURE_3D, 1, GL_RGBA8, width_, height_, depth_);
-
-			// Upload texture data for each layer
-			for (GLuint i = 0; i < depth_; ++i) {
-				GL::tex_sub_image_3d(GL_TEXTURE_3D, 0, 0, 0, i, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data_list[i]);
+			if (GL::has_direct_state_access()) {
+				// Allocate storage for the 3D texture, then upload each layer
+				GL::texture_storage_3d(texture_ID_, 1, GL_RGBA8, width_, height_, depth_);
+				for (GLuint i = 0; i < depth_; ++i) {
+					GL::texture_sub_image_3d(texture_ID_, 0, 0, 0, i, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data_list[i]);
+				}
 			}
+			else {
+				// Allocate storage for the 3D texture
+				bind(0);
+				GL::tex_storage_3d(GL_TEXTURE_3D, 1, GL_RGBA8, width_, height_, depth_);
+
+				// Upload texture data for each layer
+				for (GLuint i = 0; i < depth_; ++i) {
+					GL::tex_sub_image_3d(GL_TEXTURE_3D, 0, 0, 0, i, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, texture_data_list[i]);
+				}
 
-			unbind();
+				unbind();
+			}
 
 			// Free the loaded texture data
 			for (auto data : texture_data_list) {
@@ -132,46 +157,32 @@ namespace Gem {
 
 		// Set the min filter parameter
 		void Texture3D::set_min_filter(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MIN_FILTER, param } });
 		}
 
 		// Set the mag filter parameter
 		void Texture3D::set_mag_filter(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_MAG_FILTER, param } });
 		}
 
 		// Set the wrap parameter
 		void Texture3D::set_wrap(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, param);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, param);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param }, { GL_TEXTURE_WRAP_T, param }, { GL_TEXTURE_WRAP_R, param } });
 		}
 
 		// Set the wrap S parameter
 		void Texture3D::set_wrap_s(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_S, param } });
 		}
 
 		// Set the wrap T parameter
 		void Texture3D::set_wrap_t(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_T, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_T, param } });
 		}
 
 		// Set the wrap R parameter
 		void Texture3D::set_wrap_r(GLint param) {
-			bind(0);
-			GL::tex_parameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, param);
-			unbind();
+			set_parameters({ { GL_TEXTURE_WRAP_R, param } });
 		}
 
 		// Get the width of the texture
@@ -189,6 +200,11 @@ namespace Gem {
 			return depth_;
 		}
 
+		// Get the texture target
+		GLenum Texture3D::get_target() const noexcept {
+			return GL_TEXTURE_3D;
+		}
+
 		// Equality operator
 		bool Texture3D::operator==(const Texture3D& other) const noexcept {
 			return texture_ID_ == other.texture_ID_;
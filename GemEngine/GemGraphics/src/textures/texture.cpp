@@ -1,4 +1,7 @@
 #include <Gem/Graphics/textures/texture.h>
+#include <Gem/Core/Logger.h>
+
+#include <algorithm>
 
 namespace Gem {
 
@@ -24,13 +27,67 @@ namespace Gem {
 
 		// Generates the texture
 		void Texture::generate() {
-			GL::gen_textures(1, &texture_ID_);
+			if (GL::has_direct_state_access()) {
+				GL::create_textures(get_target(), 1, &texture_ID_);
+			}
+			else {
+				GL::gen_textures(1, &texture_ID_);
+			}
 			if (texture_ID_ == 0) {
-				std::cerr << "ERROR::Texture::generate: Failed to generate texture." << std::endl;
+				GEM_LOG_ERROR(Logger::Channel::Texture, "Texture::generate: Failed to generate texture.");
 				throw std::runtime_error("Failed to generate texture.");
 			}
 		}
 
+		// Sets texture parameters
+		void Texture::set_parameters(std::initializer_list<std::pair<GLenum, GLint>> parameters) {
+			for (const auto& parameter : parameters) {
+				auto it = std::find_if(parameters_.begin(), parameters_.end(),
+					[&parameter](const auto& stored) { return stored.first == parameter.first; });
+				if (it != parameters_.end()) {
+					it->second = parameter.second;
+				}
+				else {
+					parameters_.push_back(parameter);
+				}
+			}
+			apply_parameters(parameters.begin(), parameters.size());
+		}
+
+		// Replaces the texture with a new one that has the same parameters
+		void Texture::recreate() {
+			GL::delete_textures(1, &texture_ID_);
+			texture_ID_ = 0;
+			generate();
+			apply_parameters(parameters_.data(), parameters_.size());
+		}
+
+		// Applies texture parameters
+		void Texture::apply_parameters(const std::pair<GLenum, GLint>* parameters, std::size_t count) {
+			if (GL::has_direct_state_access()) {
+				for (std::size_t i = 0; i < count; ++i) {
+					GL::texture_parameteri(texture_ID_, parameters[i].first, parameters[i].second);
+				}
+				return;
+			}
+
+			bind(0); // Bind to any texture unit, here 0
+			for (std::size_t i = 0; i < count; ++i) {
+				GL::tex_parameteri(get_target(), parameters[i].first, parameters[i].second);
+			}
+			unbind();
+		}
+
+		// Number of levels of a full mipmap chain
+		GLsizei Texture::get_mip_levels(GLuint size) noexcept {
+			GLsizei levels = 1;
+			while (size > 1) {
+				size >>= 1;
+				++levels;
+			}
+			return levels;
+		}
+
 		// Default implementation for set_wrap_r (optional, as not all textures use R coordinate)
 		void Texture::set_wrap_r(GLint /*param*/) {
 			// Do nothing by default
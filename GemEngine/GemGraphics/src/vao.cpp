@@ -1,8 +1,30 @@
 #include <Gem/Graphics/vao.h>
+#include <Gem/Core/Logger.h>
+
+#include <cstdint>
 
 namespace Gem {
     namespace Graphics {
 
+        namespace {
+
+            std::size_t attribute_size(GLenum type, GLint components) noexcept {
+                switch (type) {
+                case GL_BYTE:
+                case GL_UNSIGNED_BYTE:                  return components;
+                case GL_SHORT:
+                case GL_UNSIGNED_SHORT:
+                case GL_HALF_FLOAT:                     return 2 * components;
+                case GL_DOUBLE:                         return 8 * components;
+                case GL_INT_2_10_10_10_REV:
+                case GL_UNSIGNED_INT_2_10_10_10_REV:
+                case GL_UNSIGNED_INT_10F_11F_11F_REV:   return 4;   // All components in one word
+                default:                                return 4 * components;  // GL_FLOAT, GL_INT, GL_UNSIGNED_INT, GL_FIXED
+                }
+            }
+
+        } // namespace
+
         // Constructor
         VAO::VAO() noexcept {
             // VAO is not yet generated.
@@ -16,16 +38,21 @@ namespace Gem {
         // Generate the VAO
         void VAO::generate() {
             if (!is_generated_) {
-                GL::gen_vertex_arrays(1, &ID_);
+                if (GL::has_direct_state_access()) {
+                    GL::create_vertex_arrays(1, &ID_);  // A complete object: named calls work without a first bind
+                }
+                else {
+                    GL::gen_vertex_arrays(1, &ID_);
+                }
                 if (ID_ == 0) {
-                    std::cerr << "Failed to generate VAO." << std::endl;
+                    GEM_LOG_ERROR(Logger::Channel::Graphics, "VAO: failed to generate the vertex array.");
                 }
                 else {
                     is_generated_ = true;
                 }
             }
             else {
-                std::cerr << "VAO already generated." << std::endl;
+                GEM_LOG_WARNING(Logger::Channel::Graphics, "VAO: already generated.");
             }
         }
 
@@ -35,7 +62,7 @@ namespace Gem {
                 GL::bind_vertex_array(ID_);
             }
             else {
-                std::cerr << "VAO not generated; cannot bind." << std::endl;
+                GEM_LOG_ERROR(Logger::Channel::Graphics, "VAO: not generated, cannot bind.");
             }
         }
 
@@ -46,6 +73,16 @@ namespace Gem {
 
         // Link a VBO to the VAO
         void VAO::link_attrib(const Buffer& VBO, GLuint layout, GLint numComponents, GLenum type, GLsizei stride, const void* offset, GLboolean normalized) {
+            if (GL::has_direct_state_access()) {
+                // One vertex buffer binding per attribute, at the attribute's location
+                GLsizei vertex_stride = stride != 0 ? stride : static_cast<GLsizei>(attribute_size(type, numComponents));   // 0 is not "tightly packed" here
+                GL::vertex_array_vertex_buffer(ID_, layout, VBO.get_ID(), reinterpret_cast<GLintptr>(offset), vertex_stride);
+                GL::vertex_array_attrib_format(ID_, layout, numComponents, type, normalized, 0);
+                GL::vertex_array_attrib_binding(ID_, layout, layout);
+                GL::enable_vertex_array_attrib(ID_, layout);
+                return;
+            }
+
             // Bind the VBO (vertex buffer object)
             VBO.bind();
 
@@ -65,6 +102,43 @@ namespace Gem {
             // unbind();
         }
 
+        // Link interleaved attributes
+        void VAO::link_attributes(const Buffer& VBO, GLsizei stride, const VertexAttribute* attributes, std::size_t count, GLuint binding) {
+            if (GL::has_direct_state_access()) {
+                // One vertex buffer binding for the whole vertex, attributes at relative offsets in it
+                GL::vertex_array_vertex_buffer(ID_, binding, VBO.get_ID(), 0, stride);
+                for (std::size_t i = 0; i < count; ++i) {
+                    const VertexAttribute& attribute = attributes[i];
+                    GL::vertex_array_attrib_format(ID_, attribute.location, attribute.components, attribute.type, attribute.normalized, attribute.offset);
+                    GL::vertex_array_attrib_binding(ID_, attribute.location, binding);
+                    GL::enable_vertex_array_attrib(ID_, attribute.location);
+                }
+                return;
+            }
+
+            VBO.bind();
+            bind();
+            for (std::size_t i = 0; i < count; ++i) {
+                const VertexAttribute& attribute = attributes[i];
+                GL::vertex_attrib_pointer(attribute.location, attribute.components, attribute.type, attribute.normalized, stride,
+                    reinterpret_cast<const void*>(static_cast<std::uintptr_t>(attribute.offset)));
+                GL::enable_vertex_attrib_array(attribute.location);
+            }
+            VBO.unbind();
+        }
+
+        // Attach the element buffer
+        void VAO::link_element_buffer(const Buffer& EBO) {
+            if (GL::has_direct_state_access()) {
+                GL::vertex_array_element_buffer(ID_, EBO.get_ID());
+                return;
+            }
+
+            // The element buffer binding is part of the bound VAO
+            bind();
+            EBO.bind();
+        }
+
         // Delete the VAO
         void VAO::cleanup() {
             if (is_generated_) {
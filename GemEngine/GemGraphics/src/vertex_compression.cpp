@@ -0,0 +1,168 @@
+#include <Gem/Graphics/vertex_compression.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            // Quantizes a normal's octahedral code to integers in [-scale, scale], trying the four
+            // codes around it and keeping the one that decodes closest to the normal
+            std::array<int, 2> quantizeOctahedral(GLfloat x, GLfloat y, GLfloat z, float scale) noexcept {
+                const std::array<GLfloat, 2> code = encode_octahedral(x, y, z);
+                const float u = std::floor(code[0] * scale);
+                const float v = std::floor(code[1] * scale);
+
+                std::array<int, 2> best = { 0, 0 };
+                float bestDot = -2.0f;
+                for (int i = 0; i < 4; ++i) {
+                    const float qu = std::clamp(u + (i & 1), -scale, scale);
+                    const float qv = std::clamp(v + (i >> 1), -scale, scale);
+                    const std::array<GLfloat, 3> decoded = decode_octahedral(qu / scale, qv / scale);
+                    const float dot = decoded[0] * x + decoded[1] * y + decoded[2] * z;
+                    if (dot > bestDot) {
+                        bestDot = dot;
+                        best = { static_cast<int>(qu), static_cast<int>(qv) };
+                    }
+                }
+                return best;
+            }
+
+            // Position relative to the bounds, in [-1, 1] (0 on a flat axis)
+            std::int16_t quantizePosition(GLfloat value, GLfloat center, GLfloat extent) noexcept {
+                return extent > 0.0f ? pack_snorm16((value - center) / extent) : 0;
+            }
+
+            template <typename T, std::size_t N>
+            void store(std::byte* vertex, GLuint offset, const T (&values)[N]) noexcept {
+                std::memcpy(vertex + offset, values, sizeof(values));
+            }
+
+        } // namespace
+
+        GLsizei get_vertex_stride(VertexCompression compression) noexcept {
+            switch (compression) {
+            case VertexCompression::Octahedral16:
+                return CompressedVertex16::stride;
+            case VertexCompression::Octahedral8:
+                return CompressedVertex8::stride;
+            default:
+                return PositionNormalVertex::stride;
+            }
+        }
+
+        void link_vertex_format(VAO& VAO, const Buffer& VBO, VertexCompression compression) {
+            switch (compression) {
+            case VertexCompression::Octahedral16:
+                VAO.link_layout<CompressedVertex16>(VBO);
+                break;
+            case VertexCompression::Octahedral8:
+                VAO.link_layout<CompressedVertex8>(VBO);
+                break;
+            default:
+                VAO.link_layout<PositionNormalVertex>(VBO);
+                break;
+            }
+        }
+
+        PositionBounds compute_position_bounds(const GLfloat* vertices, std::size_t vertex_count, std::size_t stride) {
+            PositionBounds bounds;
+            if (vertex_count == 0) {
+                return bounds;
+            }
+
+            std::array<GLfloat, 3> low = { vertices[0], vertices[1], vertices[2] };
+            std::array<GLfloat, 3> high = low;
+            for (std::size_t i = 1; i < vertex_count; ++i) {
+                const GLfloat* position = vertices + i * stride;
+                for (int axis = 0; axis < 3; ++axis) {
+                    low[axis] = std::min(low[axis], position[axis]);
+                    high[axis] = std::max(high[axis], position[axis]);
+                }
+            }
+
+            for (int axis = 0; axis < 3; ++axis) {
+                bounds.center[axis] = 0.5f * (low[axis] + high[axis]);
+                bounds.extent[axis] = 0.5f * (high[axis] - low[axis]);
+            }
+            return bounds;
+        }
+
+        std::array<GLfloat, 2> encode_octahedral(GLfloat x, GLfloat y, GLfloat z) noexcept {
+            const GLfloat length = std::abs(x) + std::abs(y) + std::abs(z);
+            if (length == 0.0f) {
+                return { 0.0f, 0.0f };
+            }
+            GLfloat u = x / length;
+            GLfloat v = y / length;
+
+            // Fold the lower hemisphere over the diagonals
+            if (z < 0.0f) {
+                const GLfloat foldedU = (1.0f - std::abs(v)) * (u >= 0.0f ? 1.0f : -1.0f);
+                const GLfloat foldedV = (1.0f - std::abs(u)) * (v >= 0.0f ? 1.0f : -1.0f);
+                u = foldedU;
+                v = foldedV;
+            }
+            return { u, v };
+        }
+
+        std::array<GLfloat, 3> decode_octahedral(GLfloat u, GLfloat v) noexcept {
+            GLfloat x = u;
+            GLfloat y = v;
+            const GLfloat z = 1.0f - std::abs(u) - std::abs(v);
+            const GLfloat t = std::max(-z, 0.0f);
+            x += x >= 0.0f ? -t : t;
+            y += y >= 0.0f ? -t : t;
+
+            const GLfloat length = std::sqrt(x * x + y * y + z * z);
+            return { x / length, y / length, z / length };
+        }
+
+        std::vector<std::byte> compress_vertices(VertexCompression compression, const GLfloat* vertices, const GLfloat* texcoords,
+            std::size_t vertex_count, const PositionBounds& bounds) {
+
+            const std::size_t stride = static_cast<std::size_t>(get_vertex_stride(compression));
+            std::vector<std::byte> result(vertex_count * stride);
+            if (compression == VertexCompression::None) {
+                std::memcpy(result.data(), vertices, result.size());
+                return result;
+            }
+
+            for (std::size_t i = 0; i < vertex_count; ++i) {
+                const GLfloat* position = vertices + i * 6;
+                const GLfloat* normal = position + 3;
+                std::byte* vertex = result.data() + i * stride;
+
+                const std::int16_t px = quantizePosition(position[0], bounds.center[0], bounds.extent[0]);
+                const std::int16_t py = quantizePosition(position[1], bounds.center[1], bounds.extent[1]);
+                const std::int16_t pz = quantizePosition(position[2], bounds.center[2], bounds.extent[2]);
+                const std::uint16_t uv[2] = {
+                    pack_half(texcoords ? texcoords[i * 2] : 0.0f),
+                    pack_half(texcoords ? texcoords[i * 2 + 1] : 0.0f)
+                };
+
+                if (compression == VertexCompression::Octahedral16) {
+                    const std::array<int, 2> code = quantizeOctahedral(normal[0], normal[1], normal[2], 32767.0f);
+                    const std::int16_t p[4] = { px, py, pz, 32767 };
+                    const std::int16_t n[2] = { static_cast<std::int16_t>(code[0]), static_cast<std::int16_t>(code[1]) };
+                    store(vertex, CompressedVertex16::offset<0>, p);
+                    store(vertex, CompressedVertex16::offset<1>, n);
+                    store(vertex, CompressedVertex16::offset<2>, uv);
+                }
+                else {
+                    const std::array<int, 2> code = quantizeOctahedral(normal[0], normal[1], normal[2], 127.0f);
+                    const std::int16_t p[3] = { px, py, pz };
+                    const std::int8_t n[2] = { static_cast<std::int8_t>(code[0]), static_cast<std::int8_t>(code[1]) };
+                    store(vertex, CompressedVertex8::offset<0>, p);
+                    store(vertex, CompressedVertex8::offset<1>, n);
+                    store(vertex, CompressedVertex8::offset<2>, uv);
+                }
+            }
+            return result;
+        }
+
+    } // namespace Graphics
+} // namespace Gem
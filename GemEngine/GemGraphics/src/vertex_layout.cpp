@@ -0,0 +1,70 @@
+#include <Gem/Graphics/vertex_layout.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Gem {
+    namespace Graphics {
+
+        namespace {
+
+            // Clamps to [low, high] (NaN to 0) and rounds to the nearest multiple of 1 / scale
+            long quantize(float value, float low, float high, float scale) noexcept {
+                if (std::isnan(value)) {
+                    return 0;
+                }
+                return std::lround(std::clamp(value, low, high) * scale);
+            }
+
+        } // namespace
+
+        // Float to half float
+        std::uint16_t pack_half(float value) noexcept {
+            const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+            const std::uint16_t sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+            const std::uint32_t magnitude = bits & 0x7FFFFFFF;
+
+            if (magnitude >= 0x7F800000) {
+                return sign | 0x7C00 | (magnitude > 0x7F800000 ? 0x0200 : 0);   // Infinity, or a quiet NaN
+            }
+            if (magnitude >= 0x477FF000) {
+                return sign | 0x7C00;   // 65520 and above round to infinity
+            }
+            if (magnitude < 0x38800000) {
+                // Below the smallest normal half (2^-14): subnormal, in units of 2^-24
+                return sign | static_cast<std::uint16_t>(std::nearbyint(std::bit_cast<float>(magnitude) * 16777216.0f));
+            }
+
+            // Rebias the exponent (127 -> 15) and round the mantissa to 10 bits, to nearest even
+            std::uint32_t half = magnitude - 0x38000000;
+            half += 0x0FFF + ((half >> 13) & 1);
+            return sign | static_cast<std::uint16_t>(half >> 13);
+        }
+
+        // Signed normalized 16-bit
+        std::int16_t pack_snorm16(float value) noexcept {
+            return static_cast<std::int16_t>(quantize(value, -1.0f, 1.0f, 32767.0f));
+        }
+
+        // Unsigned normalized 16-bit
+        std::uint16_t pack_unorm16(float value) noexcept {
+            return static_cast<std::uint16_t>(quantize(value, 0.0f, 1.0f, 65535.0f));
+        }
+
+        // Signed normalized 8-bit
+        std::int8_t pack_snorm8(float value) noexcept {
+            return static_cast<std::int8_t>(quantize(value, -1.0f, 1.0f, 127.0f));
+        }
+
+        // GL_INT_2_10_10_10_REV: x in the low bits, w in the top 2
+        std::uint32_t pack_snorm_10_10_10_2(float x, float y, float z, float w) noexcept {
+            const std::uint32_t px = static_cast<std::uint32_t>(quantize(x, -1.0f, 1.0f, 511.0f)) & 0x3FF;
+            const std::uint32_t py = static_cast<std::uint32_t>(quantize(y, -1.0f, 1.0f, 511.0f)) & 0x3FF;
+            const std::uint32_t pz = static_cast<std::uint32_t>(quantize(z, -1.0f, 1.0f, 511.0f)) & 0x3FF;
+            const std::uint32_t pw = static_cast<std::uint32_t>(quantize(w, -1.0f, 1.0f, 1.0f)) & 0x3;
+            return px | (py << 10) | (pz << 20) | (pw << 30);
+        }
+
+    } // namespace Graphics
+} // namespace Gem
@@ -1,10 +1,18 @@
 #include <Inputs.h>
 #include <Gem/Core/Logger.h> // Use your logging system
+#include <Gem/Core/Metrics.h>
 #include <algorithm>         // for std::fill
 
 namespace Gem {
     namespace Input {
 
+        namespace {
+
+            Metrics::Counter key_events_("input.key_events");
+            Metrics::Counter mouse_button_events_("input.mouse_button_events");
+
+        } // namespace
+
         // Static method to get the singleton instance
         Inputs& Inputs::getInstance() {
             static Inputs instance;
@@ -28,28 +36,30 @@ namespace Gem {
         {
             // Range check for valid keyCode
             if (keyCode < 0 || keyCode > GLFW_KEY_LAST) {
-                Gem::Logger::error("Inputs::key_callback: Invalid keyCode = {}", keyCode);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::key_callback: Invalid keyCode = {}", keyCode);
                 return;
             }
 
-            Gem::Logger::debug("Key event: key={}, action={}", keyCode, action);
+            GEM_LOG_DEBUG(Gem::Logger::Channel::Input, "Key event: key={}, action={}", keyCode, action);
 
             // Consider both GLFW_PRESS and GLFW_REPEAT as key being pressed
             // This ensures continuous movement when keys are held down
             bool pressed = (action != GLFW_RELEASE);
             keys_[keyCode].update(pressed);
+            key_events_.add();
         }
 
         void Inputs::mouse_button_callback(int button, int action)
         {
             int keyCode = button + MOUSE_BUTTON_OFFSET;
             if (keyCode < MOUSE_BUTTON_OFFSET || keyCode >= MAX_KEYS) {
-                Gem::Logger::error("Inputs::mouse_button_callback: Invalid button = {}", button);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::mouse_button_callback: Invalid button = {}", button);
                 return;
             }
 
             bool pressed = (action != GLFW_RELEASE);
             keys_[keyCode].update(pressed);
+            mouse_button_events_.add();
         }
 
         void Inputs::update()
@@ -66,7 +76,7 @@ namespace Gem {
         bool Inputs::is_key_pressed(int keyCode) const noexcept
         {
             if (keyCode < 0 || keyCode > GLFW_KEY_LAST) {
-                Gem::Logger::error("Inputs::is_key_pressed: Invalid keyCode = {}", keyCode);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::is_key_pressed: Invalid keyCode = {}", keyCode);
                 return false;
             }
             return keys_[keyCode].is_pressed();
@@ -75,7 +85,7 @@ namespace Gem {
         bool Inputs::was_key_pressed(int keyCode) const noexcept
         {
             if (keyCode < 0 || keyCode > GLFW_KEY_LAST) {
-                Gem::Logger::error("Inputs::was_key_pressed: Invalid keyCode = {}", keyCode);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::was_key_pressed: Invalid keyCode = {}", keyCode);
                 return false;
             }
             return keys_[keyCode].was_pressed();
@@ -84,7 +94,7 @@ namespace Gem {
         bool Inputs::was_key_released(int keyCode) const noexcept
         {
             if (keyCode < 0 || keyCode > GLFW_KEY_LAST) {
-                Gem::Logger::error("Inputs::was_key_released: Invalid keyCode = {}", keyCode);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::was_key_released: Invalid keyCode = {}", keyCode);
                 return false;
             }
             return keys_[keyCode].was_released();
@@ -97,7 +107,7 @@ namespace Gem {
         {
             int keyCode = button + MOUSE_BUTTON_OFFSET;
             if (keyCode < MOUSE_BUTTON_OFFSET || keyCode >= MAX_KEYS) {
-                Gem::Logger::error("Inputs::is_mouse_button_pressed: Invalid button = {}", button);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::is_mouse_button_pressed: Invalid button = {}", button);
                 return false;
             }
             return keys_[keyCode].is_pressed();
@@ -107,7 +117,7 @@ namespace Gem {
         {
             int keyCode = button + MOUSE_BUTTON_OFFSET;
             if (keyCode < MOUSE_BUTTON_OFFSET || keyCode >= MAX_KEYS) {
-                Gem::Logger::error("Inputs::was_mouse_button_pressed: Invalid button = {}", button);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::was_mouse_button_pressed: Invalid button = {}", button);
                 return false;
             }
             return keys_[keyCode].was_pressed();
@@ -117,7 +127,7 @@ namespace Gem {
         {
             int keyCode = button + MOUSE_BUTTON_OFFSET;
             if (keyCode < MOUSE_BUTTON_OFFSET || keyCode >= MAX_KEYS) {
-                Gem::Logger::error("Inputs::was_mouse_button_released: Invalid button = {}", button);
+                GEM_LOG_RATE_LIMITED(Gem::Logger::Channel::Input, Gem::Logger::LogLevel::Error, 5, "Inputs::was_mouse_button_released: Invalid button = {}", button);
                 return false;
             }
             return keys_[keyCode].was_released();
@@ -1,7 +1,10 @@
 #include <Gem/Window/Window.h>
 #include <function_overload.h>
 #include <GLFW_Manager.h>
+#include <Gem/Core/GemEngine.h>
 #include <Gem/Core/Logger.h>
+#include <Gem/Core/Profiler.h>
+#include <Gem/Graphics/gpu_profiler.h>
 #include <stdexcept>
 
 namespace Gem {
@@ -9,6 +12,15 @@ namespace Gem {
     Window::Window(int width, int height, const char* title)
         : window_(nullptr), title_(title), width_(width), height_(height), inputs_(Input::Inputs::getInstance()) {
 
+        if (GemEngine::getInstance().isHeadless()) {
+            GEM_LOG_ERROR(Gem::Logger::Channel::Window, "Cannot create window {}: the engine runs headless.", title_);
+            throw std::runtime_error("Windows are not available in headless mode!");
+        }
+
+        // The application's main clock reports frames; this one only times the camera
+        clock_.setFrameTelemetry(false);
+        clock_.setFixedTimestep(1.0 / 120.0); // Camera movement runs at 120 Hz, independent of the frame rate
+
         // Ensure GLFW is initialized (refCount incremented)
         GLFWManager::getInstance().incrementRefCount();
 
@@ -16,11 +28,18 @@ namespace Gem {
 
         Gem::GLFW::make_context_current(window_);
 		camera_ = new Gem::Graphics::Camera(glm::vec3(0, 0, 0), 60);
+
+#if GEMENGINE_PROFILING
+        // GPU zones are timed with queries of this window's context
+        Gem::Graphics::GpuProfiler::init();
+#endif
     }
 
     Window::~Window() {
         if (window_) {
-            Gem::Logger::info("Destroying window: {}", title_);
+            Gem::Graphics::GpuProfiler::shutdown(); // Query objects die with the context
+
+            GEM_LOG_INFO(Gem::Logger::Channel::Window, "Destroying window: {}", title_);
             Gem::GLFW::destroy_window(window_);
             window_ = nullptr;
         }
@@ -46,11 +65,11 @@ namespace Gem {
         // Create GLFW window
         window_ = Gem::GLFW::create_window(width_, height_, title_);
         if (!window_) {
-            Gem::Logger::error("Failed to create GLFW window: {}", title_);
+            GEM_LOG_ERROR(Gem::Logger::Channel::Window, "Failed to create GLFW window: {}", title_);
             throw std::runtime_error("Failed to create GLFW window!");
         }
 
-        Gem::Logger::info("Window created: {} ({}x{})", title_, width_, height_);
+        GEM_LOG_INFO(Gem::Logger::Channel::Window, "Window created: {} ({}x{})", title_, width_, height_);
         setCallbacks();
     }
 
@@ -59,20 +78,37 @@ namespace Gem {
     }
     
     void Window::update() noexcept {
+        GEM_PROFILE_ZONE("Window::update");
+
         // Update input and timing systems
         Gem::GL::clear_color(0.15f, 0.15f, 0.15f, 0.5f);
         Gem::GL::clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        // Reads back the GPU timings of a few frames ago and starts this frame's queries
+        Gem::Graphics::GpuProfiler::begin_frame();
         
-        camera_->update(window_, static_cast<float>(clock_.getDeltaTime()));
-        inputs_.update();
         clock_.update();
+
+        // Fixed-rate camera movement, then render from the interpolated position
+        const int steps = clock_.getFixedSteps();
+        const float step = static_cast<float>(clock_.getFixedTimestep());
+        for (int i = 0; i < steps; ++i) {
+            camera_->fixed_update(step);
+        }
+        camera_->update_interpolated(window_, static_cast<float>(clock_.getInterpolationAlpha()));
+
+        inputs_.update();
     }
     
     void Window::render() noexcept {
+        GEM_PROFILE_ZONE("Window::render");
+
         // Clear the screen
         
         // Render here (to be implemented by derived classes or render systems)
         
+        Gem::Graphics::GpuProfiler::end_frame();
+
         // Swap front and back buffers
         Gem::GLFW::swap_buffers(window_);
         
@@ -86,17 +122,17 @@ namespace Gem {
 
     void Window::setFramebufferSizeCallback(std::function<void(GLFWwindow*, int, int)> callback) {
         userFramebufferSizeCallback_ = callback;
-        Gem::Logger::debug("Custom framebuffer size callback set.");
+        GEM_LOG_DEBUG(Gem::Logger::Channel::Window, "Custom framebuffer size callback set.");
     }
 
     void Window::setKeyCallback(std::function<void(GLFWwindow*, int, int, int, int)> callback) {
         userKeyCallback_ = callback;
-        Gem::Logger::debug("Custom key callback set.");
+        GEM_LOG_DEBUG(Gem::Logger::Channel::Window, "Custom key callback set.");
     }
 
     void Window::setMouseButtonCallback(std::function<void(GLFWwindow*, int, int, int)> callback) {
         userMouseButtonCallback_ = callback;
-        Gem::Logger::debug("Custom mouse button callback set.");
+        GEM_LOG_DEBUG(Gem::Logger::Channel::Window, "Custom mouse button callback set.");
     }
 
     void Window::setTitle(const char* newTitle) {
@@ -133,7 +169,7 @@ namespace Gem {
             if (self->userFramebufferSizeCallback_) {
                 self->userFramebufferSizeCallback_(window, width, height);
             }
-            Gem::Logger::info("Framebuffer resized: {}x{}", width, height);
+            GEM_LOG_INFO(Gem::Logger::Channel::Window, "Framebuffer resized: {}x{}", width, height);
             });
 
         // Key callback
@@ -159,7 +195,7 @@ namespace Gem {
             if (self->userMouseButtonCallback_) {
                 self->userMouseButtonCallback_(window, button, action, mods);
             }
-            Gem::Logger::debug("Mouse button event: button={}, action={}", button, action);
+            GEM_LOG_DEBUG(Gem::Logger::Channel::Window, "Mouse button event: button={}, action={}", button, action);
             });
     }
 
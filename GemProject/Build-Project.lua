@@ -45,6 +45,11 @@ project "GemProject"
        systemversion "latest"
        defines { "WINDOWS" }
 
+   filter "system:linux"
+       if GemUseEGL then
+           links { "EGL" }
+       end
+
    filter "configurations:Debug"
        defines { "DEBUG" }
        runtime "Debug"
@@ -0,0 +1,28 @@
+#version 330
+#include "GemVertexCompression.glsl"
+
+// default.vert for shapes built with a VertexCompression other than None
+
+layout(location = 0) in vec3 vertex_position; // quantized position attribute
+layout(location = 1) in vec2 aTexCoord;
+layout(location = 2) in vec2 aNormal;         // octahedral normal attribute
+
+// Uniform block for matrices
+layout(std140) uniform Matrices {
+    mat4 projectionMatrix;
+    mat4 viewMatrix;
+};
+
+uniform mat4 modelMatrix;
+
+// The shape's get_position_bounds()
+uniform vec3 positionCenter;
+uniform vec3 positionExtent;
+
+out vec3 Normals;
+
+void main(void) {
+	Normals = gem_decode_normal(aNormal);
+	vec3 position = gem_decode_position(vertex_position, positionCenter, positionExtent);
+	gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(position, 1.0); // set vertex position
+}
@@ -6,9 +6,14 @@
 #include <Gem/Core/GemEngine.h>
 #include <Gem/Core/Clock.h>
 #include <Gem/Core/Logger.h>
+#include <Gem/Core/FlightRecorder.h>
+#include <Gem/Core/Metrics.h>
+#include <Gem/Core/Profiler.h>
 
 #include <Gem/Window/Window.h>
 #include <Gem/Graphics/camera.h>
+#include <Gem/Graphics/gpu_profiler.h>
+#include <Gem/Graphics/async_loader.h>
 
 #include <Gem/Graphics/shader.h>
 #include <Gem/Graphics/textures/tex_2D.h>
@@ -18,6 +23,11 @@
 
 int main() {
 
+	// Dump the last logs and frame times on a crash or a frame longer than 100 ms
+	Gem::FlightRecorder::Config flight_config;
+	flight_config.frame_budget_ms = 100.0;
+	Gem::FlightRecorder::enable(flight_config);
+
 	Gem::Logger::debug("This is a debug log. Debug level: {}", 123);
 	Gem::Logger::info("This is an info log with string: {}", "GemEngine starting...");
 	Gem::Logger::warning("This is a warning log, watch out!");
@@ -25,69 +35,94 @@ int main() {
 
 	// Initialize GLFW
 	Gem::GemEngine::getInstance().init();
-	Gem::Window window(800, 600, "GemEngine Window");
-
-	// Create a timer
-	Gem::Clock clock;
-	clock.logFPS(1); // Log FPS every second
-
-	// Create default shader for the sphere
-	Gem::Graphics::Shader shader;
-	shader.set_path("src/"); // Set the path where shader files are located
-
-	// Create position-based color shader for the cube
-	Gem::Graphics::Shader positionColorShader;
-	positionColorShader.set_path("src/"); // Set the path where shader files are located
 
-	try {
-		// Load default shader
-		shader.add_shader(GL_VERTEX_SHADER, "default.vert"); // Add vertex shader
-		shader.add_shader(GL_FRAGMENT_SHADER, "default.frag"); // Add fragment shader
-		shader.link_program(); // Link shaders into a shader program
+	// Everything holding GL objects lives in this block: the loader, shapes, textures, shaders and
+	// the window are destroyed while the engine (and its context) is still up
+	{
+		Gem::Window window(800, 600, "GemEngine Window");
+
+		// Create a timer
+		Gem::Clock clock;
+		clock.logFPS(1); // Log FPS every second
+		clock.setFrameBudget(1000.0 / 60.0); // Count frames slower than 60 FPS
+		Gem::Metrics::setDumpInterval(5.0); // Log draw calls, uploads, binds... every 5 seconds
+
+		// Create default shader for the sphere
+		Gem::Graphics::Shader shader;
+		shader.set_path("src/"); // Set the path where shader files are located
+
+		// Create position-based color shader for the cube
+		Gem::Graphics::Shader positionColorShader;
+		positionColorShader.set_path("src/"); // Set the path where shader files are located
+
+		try {
+			// Load default shader
+			shader.add_shader(GL_VERTEX_SHADER, "default_compressed.vert"); // Add vertex shader (decodes the compressed sphere)
+			shader.add_shader(GL_FRAGMENT_SHADER, "default.frag"); // Add fragment shader
+			shader.link_program(); // Link shaders into a shader program
 		
-		// Load position color shader
-		positionColorShader.add_shader(GL_VERTEX_SHADER, "position_color.vert"); // Add vertex shader
-		positionColorShader.add_shader(GL_FRAGMENT_SHADER, "position_color.frag"); // Add fragment shader
-		positionColorShader.link_program(); // Link shaders into a shader program
-	}
-	catch (const std::exception& e) {
-		std::cerr << "Shader compilation/linking failed: " << e.what() << std::endl;
-		exit(EXIT_FAILURE); // Exit if shaders fail to compile/link
-	}
-
-	Gem::Graphics::Shapes::Sphere player_sphere(1); // Small sphere representing the player
-	Gem::Graphics::Shapes::Cube cube(1); // Cube for the ground
-
-	Gem::Graphics::Texture2D texture; // Load a texture for the player sphere
-	texture.set_path("src/");
-	texture.set_mag_filter(GL_NEAREST);
-	texture.load_texture("dirt.png");
-	texture.bind(0);
-
-	shader.add_uniform_location("texture_diffuse");
-	shader.add_uniform_location("modelMatrix");
-	positionColorShader.add_uniform_location("modelMatrix");
-	glm::mat4 model = glm::mat4(1.0f); // Initialize model matrix
-
-	// Loop until the user closes the window
-	while (Gem::GemEngine::getInstance().isRunning()) {
-
-		clock.update(0); // Cap FPS to 60
-		window.update();
-
-		// Render sphere with default shader
-		shader.activate();
-		shader.set_uniform_matrix("modelMatrix", glm::value_ptr(model), 1, GL_FALSE, GL_FLOAT_MAT4);
-		shader.set_uniform("texture_diffuse", 0);
-		player_sphere.render();
+			// Load position color shader
+			positionColorShader.add_shader(GL_VERTEX_SHADER, "position_color.vert"); // Add vertex shader
+			positionColorShader.add_shader(GL_FRAGMENT_SHADER, "position_color.frag"); // Add fragment shader
+			positionColorShader.link_program(); // Link shaders into a shader program
+		}
+		catch (const std::exception& e) {
+			std::cerr << "Shader compilation/linking failed: " << e.what() << std::endl;
+			exit(EXIT_FAILURE); // Exit if shaders fail to compile/link
+		}
+
+		// Meshes and textures are uploaded on a background thread; the loop draws them once they have landed
+		Gem::Graphics::AsyncLoader loader;
+
+		Gem::Graphics::Shapes::Sphere player_sphere(1, 32, 32, loader, Gem::Graphics::VertexCompression::Octahedral16); // Small sphere representing the player
+		Gem::Graphics::Shapes::Cube cube(1, loader); // Cube for the ground
+
+		Gem::Graphics::Texture2D texture; // Load a texture for the player sphere
+		texture.set_path("src/");
+		texture.set_mag_filter(GL_NEAREST);
+		Gem::Graphics::UploadHandle texture_upload = texture.load_texture("dirt.png", loader);
+
+		shader.add_uniform_location("texture_diffuse");
+		shader.add_uniform_location("modelMatrix");
+		shader.add_uniform_location("positionCenter");
+		shader.add_uniform_location("positionExtent");
+		positionColorShader.add_uniform_location("modelMatrix");
+		glm::mat4 model = glm::mat4(1.0f); // Initialize model matrix
+
+		// Loop until the user closes the window (GEM_NULL_BACKEND=<frames> closes it after that many frames)
+		while (Gem::GemEngine::getInstance().isRunning() && !window.shouldClose()) {
+
+			clock.update(0); // Cap FPS to 60
+			window.update();
+
+			// Render sphere with default shader
+			if (player_sphere.is_ready() && texture_upload.is_ready()) {
+				GEM_PROFILE_GPU_ZONE("Render sphere");
+				texture.bind(0);
+				shader.activate();
+				shader.set_uniform_matrix("modelMatrix", glm::value_ptr(model), 1, GL_FALSE, GL_FLOAT_MAT4);
+				shader.set_uniform("texture_diffuse", 0);
+				const Gem::Graphics::PositionBounds& bounds = player_sphere.get_position_bounds(); // Decodes the quantized positions
+				shader.set_uniform("positionCenter", bounds.center[0], bounds.center[1], bounds.center[2]);
+				shader.set_uniform("positionExtent", bounds.extent[0], bounds.extent[1], bounds.extent[2]);
+				player_sphere.render();
+			}
 		
-		// Render cube with position color shader
-		positionColorShader.activate();
-		positionColorShader.set_uniform_matrix("modelMatrix", glm::value_ptr(model), 1, GL_FALSE, GL_FLOAT_MAT4);
-		cube.render();
+			// Render cube with position color shader
+			if (cube.is_ready()) {
+				GEM_PROFILE_GPU_ZONE("Render cube");
+				positionColorShader.activate();
+				positionColorShader.set_uniform_matrix("modelMatrix", glm::value_ptr(model), 1, GL_FALSE, GL_FLOAT_MAT4);
+				cube.render();
+			}
+
+			window.render();
 
-		window.render();
+		}
 
+		// Frame-time distribution of the whole run, and GL calls per wrapper (Dist builds count them)
+		clock.exportFrameHistogram("gem_frame_times.csv");
+		Gem::GL::export_call_stats("gem_gl_calls.csv");
 	}
 
 	// Terminate GLFW
@@ -0,0 +1,60 @@
+project "GemGLReplay"
+   location( _SCRIPT_DIR )
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   targetdir "Build/%{cfg.buildcfg}"
+   staticruntime "off"
+
+   files { "src/**.h", "src/**.cpp" }
+
+   includedirs
+   {
+      -- Include Core (the replayer shares the GLCapture layout and drives the headless context)
+      "../../GemEngine/GemCore/include",
+      "../../GemEngine/GemCore/include-protected",
+
+      "C:/glfw-3.4/include",
+      "C:/glad/include"
+   }
+
+   libdirs {
+
+    "C:/glfw-3.4/build/src/Debug",
+ }
+
+   links
+   {
+      "GemEngine",
+      "glfw3",
+      "opengl32"
+   }
+
+   targetdir ("../../Build/" .. OutputDir .. "/%{prj.name}")
+   objdir ("../../Build/Intermediates/" .. OutputDir .. "/%{prj.name}")
+
+   filter "system:windows"
+       systemversion "latest"
+       defines { "WINDOWS" }
+
+   filter "system:linux"
+       if GemUseEGL then
+           links { "EGL" } -- Replays on a headless context
+       end
+
+   filter "configurations:Debug"
+       defines { "DEBUG" }
+       runtime "Debug"
+       symbols "On"
+
+   filter "configurations:Release"
+       defines { "RELEASE" }
+       runtime "Release"
+       optimize "On"
+       symbols "On"
+
+   filter "configurations:Dist"
+       defines { "DIST" }
+       runtime "Release"
+       optimize "On"
+       symbols "Off"
@@ -0,0 +1,989 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Gem/Core/GemEngine.h>
+#include <Gem/Core/GLCapture.h>
+#include <EGL_Manager.h>
+#include <function_overload.h>
+
+/**
+ * GemGLReplay - plays a GLCapture file back on a headless context and times it.
+ *
+ * Usage: GemGLReplay <capture.gglcap> [options]
+ *   --frames first:last   Frames to time (0-based, inclusive). Earlier frames replay untimed to build the state.
+ *   --loop N              Plays the timed frames N times.
+ *   --frame-by-frame      Waits for the GPU after each frame and reports per-frame times.
+ *   --checksum            With --frame-by-frame: hashes the framebuffer after each frame (not timed).
+ *   --size WxH            Offscreen framebuffer size. Defaults to the largest viewport of the capture.
+ *   --csv out.csv         With --frame-by-frame: writes frame, captured, CPU and GPU times.
+ *
+ * Calls are replayed straight to the driver, bypassing Gem::GL (no state cache, no capture).
+ */
+
+namespace {
+
+	using namespace Gem::GLCaptureFormat;
+
+	/**
+	 * Bounds-checked reader over one record payload.
+	 */
+	class Reader {
+	public:
+		Reader(const char* data, std::size_t size) : data_(data), size_(size) {}
+
+		template <typename T>
+		bool read(T& value) {
+			if (size_ - offset_ < sizeof(T)) {
+				return false;
+			}
+			std::memcpy(&value, data_ + offset_, sizeof(T));
+			offset_ += sizeof(T);
+			return true;
+		}
+
+		/**
+		 * Reads a blob; @p data is nullptr when the captured pointer was null.
+		 */
+		bool read_blob(const char*& data, std::size_t& length) {
+			std::uint64_t stored = 0;
+			if (!read(stored)) {
+				return false;
+			}
+			if (stored == NULL_BLOB) {
+				data = nullptr;
+				length = 0;
+				return true;
+			}
+			if (size_ - offset_ < stored) {
+				return false;
+			}
+			data = data_ + offset_;
+			length = static_cast<std::size_t>(stored);
+			offset_ += length;
+			return true;
+		}
+
+	private:
+		const char* data_;
+		std::size_t size_;
+		std::size_t offset_ = 0;
+	};
+
+	struct Record {
+		Call call;
+		std::uint8_t context;
+		const char* payload;
+		std::uint32_t size;
+	};
+
+	struct Options {
+		std::string input;
+		std::size_t first_frame = 0;
+		std::size_t last_frame = ~std::size_t{ 0 };
+		unsigned int loops = 1;
+		bool frame_by_frame = false;
+		bool checksum = false;
+		int width = 0;
+		int height = 0;
+		std::string csv;
+	};
+
+	struct FrameTiming {
+		std::size_t frame;
+		double captured_ms;
+		double cpu_ms;       ///< Issuing the calls.
+		double gpu_ms;       ///< Until glFinish returned.
+		std::uint64_t checksum;
+	};
+
+	double milliseconds_since(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	std::uint64_t key(std::uint32_t high, std::uint32_t low) {
+		return (static_cast<std::uint64_t>(high) << 32) | low;
+	}
+
+	/**
+	 * Executes records, mapping captured object names, uniform locations and contexts to the replay's.
+	 */
+	class Replayer {
+	public:
+		Replayer() {
+			contexts_.push_back(Gem::EGLManager::getInstance().getContext());
+		}
+
+		~Replayer() {
+			Gem::EGLManager& egl = Gem::EGLManager::getInstance();
+			egl.makeCurrent(contexts_[0]);
+			for (std::size_t i = 1; i < contexts_.size(); ++i) {
+				egl.destroySharedContext(contexts_[i]);
+			}
+		}
+
+		/**
+		 * Returns false if the record is truncated or the call unknown; the record is then skipped.
+		 */
+		bool execute(const Record& record) {
+			if (record.call == Call::EndFrame) {
+				return true;
+			}
+			if (!switch_context(record.context)) {
+				return false;
+			}
+			Reader reader(record.payload, record.size);
+			return dispatch(record.call, reader);
+		}
+
+		/**
+		 * Makes the render context (context 0) current again.
+		 */
+		void restore_main_context() {
+			switch_context(0);
+		}
+
+	private:
+		bool switch_context(std::uint8_t context) {
+			if (context == current_) {
+				return true;
+			}
+
+			Gem::EGLManager& egl = Gem::EGLManager::getInstance();
+			while (contexts_.size() <= context) {
+				Gem::EGLManager::SharedContext shared;
+				if (!egl.createSharedContext(shared)) {
+					std::cerr << "Cannot create a shared context for captured context " << static_cast<int>(context) << "." << std::endl;
+					return false;
+				}
+				contexts_.push_back(shared);
+			}
+			if (!egl.makeCurrent(contexts_[context])) {
+				return false;
+			}
+			current_ = context;
+			return true;
+		}
+
+		static GLuint lookup(const std::unordered_map<std::uint64_t, GLuint>& map, std::uint64_t captured) {
+			auto it = map.find(captured);
+			return it != map.end() ? it->second : static_cast<GLuint>(captured & 0xFFFFFFFFu);
+		}
+
+		/**
+		 * Buffers, textures, shaders, programs and renderbuffers are shared by all contexts;
+		 * vertex arrays and framebuffers belong to the context that created them.
+		 */
+		GLuint buffer(GLuint name) const { return name ? lookup(buffers_, name) : 0; }
+		GLuint texture(GLuint name) const { return name ? lookup(textures_, name) : 0; }
+		GLuint shader(GLuint name) const { return name ? lookup(shaders_, name) : 0; }
+		GLuint program(GLuint name) const { return name ? lookup(programs_, name) : 0; }
+		GLuint renderbuffer(GLuint name) const { return name ? lookup(renderbuffers_, name) : 0; }
+		GLuint vertex_array(GLuint name) const { return name ? lookup(vertex_arrays_, key(current_, name)) : 0; }
+
+		GLuint framebuffer(GLuint name) const {
+			if (name == 0) {
+				return current_ == 0 ? Gem::EGLManager::getInstance().getFramebuffer() : 0;  // Stands in for the window
+			}
+			return lookup(framebuffers_, key(current_, name));
+		}
+
+		GLint uniform_location(GLint captured) const {
+			if (captured < 0) {
+				return captured;
+			}
+			auto it = uniform_locations_.find(key(programs_in_use_[current_], static_cast<std::uint32_t>(captured)));
+			return it != uniform_locations_.end() ? it->second : captured;
+		}
+
+		template <typename Gen>
+		bool gen_names(Reader& reader, std::unordered_map<std::uint64_t, GLuint>& map, bool per_context, Gen gen) {
+			GLsizei n = 0;
+			const char* data = nullptr;
+			std::size_t length = 0;
+			if (!reader.read(n) || !reader.read_blob(data, length) || !data || length != static_cast<std::size_t>(n) * sizeof(GLuint)) {
+				return false;
+			}
+
+			names_.resize(static_cast<std::size_t>(n));
+			gen(n, names_.data());
+			for (GLsizei i = 0; i < n; ++i) {
+				GLuint captured = 0;
+				std::memcpy(&captured, data + i * sizeof(GLuint), sizeof(GLuint));
+				map[per_context ? key(current_, captured) : captured] = names_[static_cast<std::size_t>(i)];
+			}
+			return true;
+		}
+
+		template <typename Delete>
+		bool delete_names(Reader& reader, std::unordered_map<std::uint64_t, GLuint>& map, bool per_context, Delete remove) {
+			GLsizei n = 0;
+			const char* data = nullptr;
+			std::size_t length = 0;
+			if (!reader.read(n) || !reader.read_blob(data, length) || !data || length != static_cast<std::size_t>(n) * sizeof(GLuint)) {
+				return false;
+			}
+
+			names_.clear();
+			for (GLsizei i = 0; i < n; ++i) {
+				GLuint captured = 0;
+				std::memcpy(&captured, data + i * sizeof(GLuint), sizeof(GLuint));
+				std::uint64_t id = per_context ? key(current_, captured) : captured;
+				auto it = map.find(id);
+				if (it != map.end()) {
+					names_.push_back(it->second);
+					map.erase(it);
+				}
+			}
+			remove(static_cast<GLsizei>(names_.size()), names_.data());
+			return true;
+		}
+
+		/**
+		 * Copies uniform values out of the file, which keeps no alignment.
+		 */
+		template <typename T>
+		const T* aligned(const char* data, std::size_t length) {
+			scratch_.resize((length + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+			std::memcpy(scratch_.data(), data, length);
+			return reinterpret_cast<const T*>(scratch_.data());
+		}
+
+		bool replay_uniform(Reader& reader) {
+			UniformType type{};
+			std::uint8_t components = 0;
+			GLint location = 0;
+			GLsizei count = 0;
+			const char* data = nullptr;
+			std::size_t length = 0;
+			if (!reader.read(type) || !reader.read(components) || !reader.read(location) || !reader.read(count)
+				|| !reader.read_blob(data, length) || !data) {
+				return false;
+			}
+
+			location = uniform_location(location);
+			switch (type) {
+			case UniformType::Int: {
+				const GLint* values = aligned<GLint>(data, length);
+				switch (components) {
+				case 1: glUniform1iv(location, count, values); return true;
+				case 2: glUniform2iv(location, count, values); return true;
+				case 3: glUniform3iv(location, count, values); return true;
+				case 4: glUniform4iv(location, count, values); return true;
+				}
+				return false;
+			}
+			case UniformType::UInt: {
+				const GLuint* values = aligned<GLuint>(data, length);
+				switch (components) {
+				case 1: glUniform1uiv(location, count, values); return true;
+				case 2: glUniform2uiv(location, count, values); return true;
+				case 3: glUniform3uiv(location, count, values); return true;
+				case 4: glUniform4uiv(location, count, values); return true;
+				}
+				return false;
+			}
+			case UniformType::Float: {
+				const GLfloat* values = aligned<GLfloat>(data, length);
+				switch (components) {
+				case 1: glUniform1fv(location, count, values); return true;
+				case 2: glUniform2fv(location, count, values); return true;
+				case 3: glUniform3fv(location, count, values); return true;
+				case 4: glUniform4fv(location, count, values); return true;
+				}
+				return false;
+			}
+			}
+			return false;
+		}
+
+		bool replay_uniform_matrix(Reader& reader) {
+			std::uint8_t columns = 0;
+			std::uint8_t rows = 0;
+			GLint location = 0;
+			GLsizei count = 0;
+			GLboolean transpose = GL_FALSE;
+			const char* data = nullptr;
+			std::size_t length = 0;
+			if (!reader.read(columns) || !reader.read(rows) || !reader.read(location) || !reader.read(count)
+				|| !reader.read(transpose) || !reader.read_blob(data, length) || !data) {
+				return false;
+			}
+
+			location = uniform_location(location);
+			const GLfloat* values = aligned<GLfloat>(data, length);
+			switch (columns * 10 + rows) {
+			case 22: glUniformMatrix2fv(location, count, transpose, values); return true;
+			case 33: glUniformMatrix3fv(location, count, transpose, values); return true;
+			case 44: glUniformMatrix4fv(location, count, transpose, values); return true;
+			case 23: glUniformMatrix2x3fv(location, count, transpose, values); return true;
+			case 32: glUniformMatrix3x2fv(location, count, transpose, values); return true;
+			case 24: glUniformMatrix2x4fv(location, count, transpose, values); return true;
+			case 42: glUniformMatrix4x2fv(location, count, transpose, values); return true;
+			case 34: glUniformMatrix3x4fv(location, count, transpose, values); return true;
+			case 43: glUniformMatrix4x3fv(location, count, transpose, values); return true;
+			}
+			return false;
+		}
+
+		bool dispatch(Call call, Reader& reader) {
+			GLenum a = 0, b = 0, c = 0;
+			GLint i0 = 0, i1 = 0, i2 = 0, i3 = 0, i4 = 0;
+			GLuint u0 = 0, u1 = 0, u2 = 0;
+			GLsizei w = 0, h = 0, depth = 0;
+			std::int64_t s0 = 0, s1 = 0, s2 = 0;
+			std::uint64_t offset = 0;
+			const char* data = nullptr;
+			std::size_t length = 0;
+
+			switch (call) {
+			//|=== Uniforms ===
+			case Call::GetUniformLocation: {
+				GLint location = 0;
+				if (!reader.read(u0) || !reader.read_blob(data, length) || !data || !reader.read(location)) {
+					return false;
+				}
+				GLuint replayed = program(u0);
+				uniform_locations_[key(replayed, static_cast<std::uint32_t>(location))] = glGetUniformLocation(replayed, std::string(data, length).c_str());
+				return true;
+			}
+			case Call::Uniform:
+				return replay_uniform(reader);
+			case Call::UniformMatrix:
+				return replay_uniform_matrix(reader);
+			case Call::GetUniformBlockIndex: {
+				GLuint index = 0;
+				if (!reader.read(u0) || !reader.read_blob(data, length) || !data || !reader.read(index)) {
+					return false;
+				}
+				GLuint replayed = program(u0);
+				block_indices_[key(replayed, index)] = glGetUniformBlockIndex(replayed, std::string(data, length).c_str());
+				return true;
+			}
+			case Call::UniformBlockBinding: {
+				if (!reader.read(u0) || !reader.read(u1) || !reader.read(u2)) {
+					return false;
+				}
+				GLuint replayed = program(u0);
+				glUniformBlockBinding(replayed, lookup(block_indices_, key(replayed, u1)), u2);
+				return true;
+			}
+
+			//|=== Textures ===
+			case Call::GenTextures:
+				return gen_names(reader, textures_, false, [](GLsizei n, GLuint* names) { glGenTextures(n, names); });
+			case Call::DeleteTextures:
+				return delete_names(reader, textures_, false, [](GLsizei n, const GLuint* names) { glDeleteTextures(n, names); });
+			case Call::ActiveTexture:
+				if (!reader.read(a)) return false;
+				glActiveTexture(a);
+				return true;
+			case Call::BindTexture:
+				if (!reader.read(a) || !reader.read(u0)) return false;
+				glBindTexture(a, texture(u0));
+				return true;
+			case Call::TexParameteri:
+				if (!reader.read(a) || !reader.read(b) || !reader.read(i0)) return false;
+				glTexParameteri(a, b, i0);
+				return true;
+			case Call::GenerateMipmap:
+				if (!reader.read(a)) return false;
+				glGenerateMipmap(a);
+				return true;
+			case Call::TexImage1D:
+				if (!reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(w) || !reader.read(i2)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTexImage1D(a, i0, i1, w, i2, b, c, data);
+				return true;
+			case Call::TexImage2D:
+				if (!reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(w) || !reader.read(h) || !reader.read(i2)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTexImage2D(a, i0, i1, w, h, i2, b, c, data);
+				return true;
+			case Call::TexImage3D:
+				if (!reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(w) || !reader.read(h) || !reader.read(depth)
+					|| !reader.read(i2) || !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTexImage3D(a, i0, i1, w, h, depth, i2, b, c, data);
+				return true;
+			case Call::TexSubImage2D:
+				if (!reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(i2) || !reader.read(w) || !reader.read(h)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTexSubImage2D(a, i0, i1, i2, w, h, b, c, data);
+				return true;
+			case Call::TexSubImage3D:
+				if (!reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(i2) || !reader.read(i3)
+					|| !reader.read(w) || !reader.read(h) || !reader.read(depth)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTexSubImage3D(a, i0, i1, i2, i3, w, h, depth, b, c, data);
+				return true;
+			case Call::TexStorage2D:
+				if (!reader.read(a) || !reader.read(w) || !reader.read(b) || !reader.read(i0) || !reader.read(i1)) return false;
+				glTexStorage2D(a, w, b, i0, i1);
+				return true;
+			case Call::TexStorage3D:
+				if (!reader.read(a) || !reader.read(w) || !reader.read(b) || !reader.read(i0) || !reader.read(i1) || !reader.read(i4)) return false;
+				glTexStorage3D(a, w, b, i0, i1, i4);
+				return true;
+
+			//|=== Buffers ===
+			case Call::GenBuffers:
+				return gen_names(reader, buffers_, false, [](GLsizei n, GLuint* names) { glGenBuffers(n, names); });
+			case Call::DeleteBuffers:
+				return delete_names(reader, buffers_, false, [](GLsizei n, const GLuint* names) { glDeleteBuffers(n, names); });
+			case Call::BindBuffer:
+				if (!reader.read(a) || !reader.read(u0)) return false;
+				glBindBuffer(a, buffer(u0));
+				return true;
+			case Call::BufferData:
+				if (!reader.read(a) || !reader.read(s0) || !reader.read_blob(data, length) || !reader.read(b)) return false;
+				glBufferData(a, static_cast<GLsizeiptr>(s0), data, b);
+				return true;
+			case Call::BufferSubData:
+				if (!reader.read(a) || !reader.read(s0) || !reader.read_blob(data, length) || !data) return false;
+				glBufferSubData(a, static_cast<GLintptr>(s0), static_cast<GLsizeiptr>(length), data);
+				return true;
+			case Call::BufferStorage:
+				if (!reader.read(a) || !reader.read(s0) || !reader.read_blob(data, length) || !reader.read(b)) return false;
+				glBufferStorage(a, static_cast<GLsizeiptr>(s0), data, b | GL_DYNAMIC_STORAGE_BIT);	// BufferWrite updates it with glBufferSubData
+				return true;
+			case Call::BufferWrite:
+				if (!reader.read(u0) || !reader.read(s0) || !reader.read_blob(data, length) || !data) return false;
+				glBindBuffer(GL_COPY_WRITE_BUFFER, buffer(u0));
+				glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(s0), static_cast<GLsizeiptr>(length), data);
+				return true;
+			case Call::BindBufferRange:
+				if (!reader.read(a) || !reader.read(u0) || !reader.read(u1) || !reader.read(s0) || !reader.read(s1)) return false;
+				glBindBufferRange(a, u0, buffer(u1), static_cast<GLintptr>(s0), static_cast<GLsizeiptr>(s1));
+				return true;
+			case Call::BindBufferBase:
+				if (!reader.read(a) || !reader.read(u0) || !reader.read(u1)) return false;
+				glBindBufferBase(a, u0, buffer(u1));
+				return true;
+
+			//|=== Vertex arrays ===
+			case Call::GenVertexArrays:
+				return gen_names(reader, vertex_arrays_, true, [](GLsizei n, GLuint* names) { glGenVertexArrays(n, names); });
+			case Call::DeleteVertexArrays:
+				return delete_names(reader, vertex_arrays_, true, [](GLsizei n, const GLuint* names) { glDeleteVertexArrays(n, names); });
+			case Call::BindVertexArray:
+				if (!reader.read(u0)) return false;
+				glBindVertexArray(vertex_array(u0));
+				return true;
+			case Call::VertexAttribPointer: {
+				GLboolean normalized = GL_FALSE;
+				if (!reader.read(u0) || !reader.read(i0) || !reader.read(a) || !reader.read(normalized) || !reader.read(w) || !reader.read(offset)) return false;
+				glVertexAttribPointer(u0, i0, a, normalized, w, reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)));
+				return true;
+			}
+			case Call::EnableVertexAttribArray:
+				if (!reader.read(u0)) return false;
+				glEnableVertexAttribArray(u0);
+				return true;
+
+			//|=== Direct state access ===
+			case Call::CreateBuffers:
+				return gen_names(reader, buffers_, false, [](GLsizei n, GLuint* names) { glCreateBuffers(n, names); });
+			case Call::NamedBufferData:
+				if (!reader.read(u0) || !reader.read(s0) || !reader.read_blob(data, length) || !reader.read(b)) return false;
+				glNamedBufferData(buffer(u0), static_cast<GLsizeiptr>(s0), data, b);
+				return true;
+			case Call::NamedBufferStorage:
+				if (!reader.read(u0) || !reader.read(s0) || !reader.read_blob(data, length) || !reader.read(b)) return false;
+				glNamedBufferStorage(buffer(u0), static_cast<GLsizeiptr>(s0), data, b | GL_DYNAMIC_STORAGE_BIT);	// BufferWrite may update it
+				return true;
+			case Call::NamedBufferSubData:
+				if (!reader.read(u0) || !reader.read(s0) || !reader.read_blob(data, length) || !data) return false;
+				glNamedBufferSubData(buffer(u0), static_cast<GLintptr>(s0), static_cast<GLsizeiptr>(length), data);
+				return true;
+			case Call::CreateVertexArrays:
+				return gen_names(reader, vertex_arrays_, true, [](GLsizei n, GLuint* names) { glCreateVertexArrays(n, names); });
+			case Call::VertexArrayVertexBuffer:
+				if (!reader.read(u0) || !reader.read(u1) || !reader.read(u2) || !reader.read(s0) || !reader.read(w)) return false;
+				glVertexArrayVertexBuffer(vertex_array(u0), u1, buffer(u2), static_cast<GLintptr>(s0), w);
+				return true;
+			case Call::VertexArrayElementBuffer:
+				if (!reader.read(u0) || !reader.read(u1)) return false;
+				glVertexArrayElementBuffer(vertex_array(u0), buffer(u1));
+				return true;
+			case Call::VertexArrayAttribFormat: {
+				GLboolean normalized = GL_FALSE;
+				if (!reader.read(u0) || !reader.read(u1) || !reader.read(i0) || !reader.read(a) || !reader.read(normalized) || !reader.read(u2)) return false;
+				glVertexArrayAttribFormat(vertex_array(u0), u1, i0, a, normalized, u2);
+				return true;
+			}
+			case Call::VertexArrayAttribBinding:
+				if (!reader.read(u0) || !reader.read(u1) || !reader.read(u2)) return false;
+				glVertexArrayAttribBinding(vertex_array(u0), u1, u2);
+				return true;
+			case Call::EnableVertexArrayAttrib:
+				if (!reader.read(u0) || !reader.read(u1)) return false;
+				glEnableVertexArrayAttrib(vertex_array(u0), u1);
+				return true;
+			case Call::CreateTextures:
+				if (!reader.read(a)) return false;
+				return gen_names(reader, textures_, false, [a](GLsizei n, GLuint* names) { glCreateTextures(a, n, names); });
+			case Call::TextureParameteri:
+				if (!reader.read(u0) || !reader.read(a) || !reader.read(i0)) return false;
+				glTextureParameteri(texture(u0), a, i0);
+				return true;
+			case Call::TextureStorage1D:
+				if (!reader.read(u0) || !reader.read(w) || !reader.read(a) || !reader.read(i0)) return false;
+				glTextureStorage1D(texture(u0), w, a, i0);
+				return true;
+			case Call::TextureStorage2D:
+				if (!reader.read(u0) || !reader.read(w) || !reader.read(a) || !reader.read(i0) || !reader.read(i1)) return false;
+				glTextureStorage2D(texture(u0), w, a, i0, i1);
+				return true;
+			case Call::TextureStorage3D:
+				if (!reader.read(u0) || !reader.read(w) || !reader.read(a) || !reader.read(i0) || !reader.read(i1) || !reader.read(i4)) return false;
+				glTextureStorage3D(texture(u0), w, a, i0, i1, i4);
+				return true;
+			case Call::TextureSubImage1D:
+				if (!reader.read(u0) || !reader.read(i0) || !reader.read(i1) || !reader.read(w)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTextureSubImage1D(texture(u0), i0, i1, w, b, c, data);
+				return true;
+			case Call::TextureSubImage2D:
+				if (!reader.read(u0) || !reader.read(i0) || !reader.read(i1) || !reader.read(i2) || !reader.read(w) || !reader.read(h)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTextureSubImage2D(texture(u0), i0, i1, i2, w, h, b, c, data);
+				return true;
+			case Call::TextureSubImage3D:
+				if (!reader.read(u0) || !reader.read(i0) || !reader.read(i1) || !reader.read(i2) || !reader.read(i3)
+					|| !reader.read(w) || !reader.read(h) || !reader.read(depth)
+					|| !reader.read(b) || !reader.read(c) || !reader.read_blob(data, length)) return false;
+				glTextureSubImage3D(texture(u0), i0, i1, i2, i3, w, h, depth, b, c, data);
+				return true;
+			case Call::GenerateTextureMipmap:
+				if (!reader.read(u0)) return false;
+				glGenerateTextureMipmap(texture(u0));
+				return true;
+			case Call::BindTextureUnit:
+				if (!reader.read(u0) || !reader.read(u1)) return false;
+				glBindTextureUnit(u0, texture(u1));
+				return true;
+
+			//|=== Shared geometry buffers ===
+			case Call::CopyBufferSubData:
+				if (!reader.read(a) || !reader.read(b) || !reader.read(s0) || !reader.read(s1) || !reader.read(s2)) return false;
+				glCopyBufferSubData(a, b, static_cast<GLintptr>(s0), static_cast<GLintptr>(s1), static_cast<GLsizeiptr>(s2));
+				return true;
+			case Call::CopyNamedBufferSubData:
+				if (!reader.read(u0) || !reader.read(u1) || !reader.read(s0) || !reader.read(s1) || !reader.read(s2)) return false;
+				glCopyNamedBufferSubData(buffer(u0), buffer(u1), static_cast<GLintptr>(s0), static_cast<GLintptr>(s1), static_cast<GLsizeiptr>(s2));
+				return true;
+			case Call::DrawElementsBaseVertex:
+				if (!reader.read(a) || !reader.read(w) || !reader.read(b) || !reader.read(offset) || !reader.read(i0)) return false;
+				glDrawElementsBaseVertex(a, w, b, reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)), i0);
+				return true;
+
+			//|=== Shaders and programs ===
+			case Call::CreateShader:
+				if (!reader.read(a) || !reader.read(u0)) return false;
+				shaders_[u0] = glCreateShader(a);
+				return true;
+			case Call::ShaderSource: {
+				if (!reader.read(u0) || !reader.read_blob(data, length) || !data) return false;
+				GLint source_length = static_cast<GLint>(length);
+				glShaderSource(shader(u0), 1, &data, &source_length);
+				return true;
+			}
+			case Call::CompileShader:
+				if (!reader.read(u0)) return false;
+				glCompileShader(shader(u0));
+				return true;
+			case Call::AttachShader:
+				if (!reader.read(u0) || !reader.read(u1)) return false;
+				glAttachShader(program(u0), shader(u1));
+				return true;
+			case Call::DeleteShader:
+				if (!reader.read(u0)) return false;
+				glDeleteShader(shader(u0));
+				shaders_.erase(u0);
+				return true;
+			case Call::CreateProgram:
+				if (!reader.read(u0)) return false;
+				programs_[u0] = glCreateProgram();
+				return true;
+			case Call::LinkProgram:
+				if (!reader.read(u0)) return false;
+				glLinkProgram(program(u0));
+				return true;
+			case Call::UseProgram:
+				if (!reader.read(u0)) return false;
+				programs_in_use_[current_] = program(u0);
+				glUseProgram(programs_in_use_[current_]);
+				return true;
+			case Call::DeleteProgram:
+				if (!reader.read(u0)) return false;
+				glDeleteProgram(program(u0));
+				programs_.erase(u0);
+				return true;
+
+			//|=== Frame buffers and fixed-function state ===
+			case Call::ClearColor: {
+				GLfloat color[4] = {};
+				if (!reader.read(color[0]) || !reader.read(color[1]) || !reader.read(color[2]) || !reader.read(color[3])) return false;
+				glClearColor(color[0], color[1], color[2], color[3]);
+				return true;
+			}
+			case Call::Clear:
+				if (!reader.read(a)) return false;
+				glClear(a);
+				return true;
+			case Call::Viewport:
+				if (!reader.read(i0) || !reader.read(i1) || !reader.read(w) || !reader.read(h)) return false;
+				glViewport(i0, i1, w, h);
+				return true;
+			case Call::Enable:
+				if (!reader.read(a)) return false;
+				glEnable(a);
+				return true;
+			case Call::Disable:
+				if (!reader.read(a)) return false;
+				glDisable(a);
+				return true;
+			case Call::CullFace:
+				if (!reader.read(a)) return false;
+				glCullFace(a);
+				return true;
+			case Call::FrontFace:
+				if (!reader.read(a)) return false;
+				glFrontFace(a);
+				return true;
+			case Call::BlendFunc:
+				if (!reader.read(a) || !reader.read(b)) return false;
+				glBlendFunc(a, b);
+				return true;
+			case Call::DrawElements:
+				if (!reader.read(a) || !reader.read(w) || !reader.read(b) || !reader.read(offset)) return false;
+				glDrawElements(a, w, b, reinterpret_cast<const void*>(static_cast<std::uintptr_t>(offset)));
+				return true;
+
+			//|=== Frame buffer objects ===
+			case Call::GenFramebuffers:
+				return gen_names(reader, framebuffers_, true, [](GLsizei n, GLuint* names) { glGenFramebuffers(n, names); });
+			case Call::DeleteFramebuffers:
+				return delete_names(reader, framebuffers_, true, [](GLsizei n, const GLuint* names) { glDeleteFramebuffers(n, names); });
+			case Call::BindFramebuffer:
+				if (!reader.read(a) || !reader.read(u0)) return false;
+				glBindFramebuffer(a, framebuffer(u0));
+				return true;
+			case Call::GenRenderbuffers:
+				return gen_names(reader, renderbuffers_, false, [](GLsizei n, GLuint* names) { glGenRenderbuffers(n, names); });
+			case Call::DeleteRenderbuffers:
+				return delete_names(reader, renderbuffers_, false, [](GLsizei n, const GLuint* names) { glDeleteRenderbuffers(n, names); });
+			case Call::BindRenderbuffer:
+				if (!reader.read(a) || !reader.read(u0)) return false;
+				glBindRenderbuffer(a, renderbuffer(u0));
+				return true;
+			case Call::RenderbufferStorage:
+				if (!reader.read(a) || !reader.read(b) || !reader.read(w) || !reader.read(h)) return false;
+				glRenderbufferStorage(a, b, w, h);
+				return true;
+			case Call::FramebufferRenderbuffer:
+				if (!reader.read(a) || !reader.read(b) || !reader.read(c) || !reader.read(u0)) return false;
+				glFramebufferRenderbuffer(a, b, c, renderbuffer(u0));
+				return true;
+
+			case Call::EndFrame:
+			case Call::Count:
+				break;
+			}
+			return false;
+		}
+
+	private:
+		std::vector<Gem::EGLManager::SharedContext> contexts_;  ///< Index = captured context; 0 is the engine's.
+		std::uint8_t current_ = 0;
+		GLuint programs_in_use_[256] = {};
+
+		std::unordered_map<std::uint64_t, GLuint> buffers_;
+		std::unordered_map<std::uint64_t, GLuint> textures_;
+		std::unordered_map<std::uint64_t, GLuint> shaders_;
+		std::unordered_map<std::uint64_t, GLuint> programs_;
+		std::unordered_map<std::uint64_t, GLuint> renderbuffers_;
+		std::unordered_map<std::uint64_t, GLuint> vertex_arrays_;  ///< Keyed by (context, name)
+		std::unordered_map<std::uint64_t, GLuint> framebuffers_;   ///< Keyed by (context, name)
+		std::unordered_map<std::uint64_t, GLint> uniform_locations_;   ///< (replayed program, captured location)
+		std::unordered_map<std::uint64_t, GLuint> block_indices_;      ///< (replayed program, captured index)
+
+		std::vector<GLuint> names_;
+		std::vector<std::uint64_t> scratch_;
+	};
+
+	bool parse_options(int argc, char** argv, Options& options) {
+		if (argc < 2) {
+			return false;
+		}
+		options.input = argv[1];
+
+		for (int i = 2; i < argc; ++i) {
+			std::string_view arg = argv[i];
+			bool has_value = i + 1 < argc;
+
+			if (arg == "--frame-by-frame") {
+				options.frame_by_frame = true;
+			}
+			else if (arg == "--checksum") {
+				options.checksum = true;
+			}
+			else if (arg == "--frames" && has_value) {
+				std::string value = argv[++i];
+				std::size_t colon = value.find(':');
+				options.first_frame = std::stoul(value.substr(0, colon));
+				options.last_frame = colon == std::string::npos ? options.first_frame : std::stoul(value.substr(colon + 1));
+			}
+			else if (arg == "--loop" && has_value) {
+				options.loops = static_cast<unsigned int>(std::max(1l, std::stol(argv[++i])));
+			}
+			else if (arg == "--size" && has_value) {
+				std::string value = argv[++i];
+				std::size_t x = value.find('x');
+				if (x == std::string::npos) {
+					return false;
+				}
+				options.width = std::stoi(value.substr(0, x));
+				options.height = std::stoi(value.substr(x + 1));
+			}
+			else if (arg == "--csv" && has_value) {
+				options.csv = argv[++i];
+			}
+			else {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * FNV-1a of the offscreen framebuffer, to check that two replays drew the same thing.
+	 */
+	std::uint64_t framebuffer_checksum(std::vector<std::uint8_t>& pixels) {
+		int width = 0;
+		int height = 0;
+		std::uint64_t hash = 14695981039346656037ull;
+		if (Gem::GemEngine::getInstance().readFramebuffer(pixels, width, height)) {
+			for (std::uint8_t byte : pixels) {
+				hash = (hash ^ byte) * 1099511628211ull;
+			}
+		}
+		return hash;
+	}
+
+	double percentile(std::vector<double> values, double fraction) {
+		if (values.empty()) {
+			return 0.0;
+		}
+		std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+		std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+		return values[index];
+	}
+
+}
+
+int main(int argc, char** argv) {
+
+	Options options;
+	try {
+		if (!parse_options(argc, argv, options)) {
+			std::cerr << "Usage: " << argv[0] << " <capture.gglcap> [--frames first:last] [--loop N] [--frame-by-frame] [--checksum] [--size WxH] [--csv out.csv]" << std::endl;
+			return 1;
+		}
+	}
+	catch (const std::exception&) {
+		std::cerr << "Invalid option value." << std::endl;
+		return 1;
+	}
+
+	std::ifstream input(options.input, std::ios::binary);
+	if (!input) {
+		std::cerr << "Failed to open '" << options.input << "'." << std::endl;
+		return 1;
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	FileHeader header{};
+	if (data.size() < sizeof(header)) {
+		std::cerr << "File is too small to be a GL capture." << std::endl;
+		return 1;
+	}
+	std::memcpy(&header, data.data(), sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+		std::cerr << "Not a GL capture (or unsupported version)." << std::endl;
+		return 1;
+	}
+	if (header.header_size < sizeof(FileHeader) || header.header_size > data.size()) {
+		std::cerr << "Corrupt header (header size " << header.header_size << " for a " << data.size() << "-byte file)." << std::endl;
+		return 1;
+	}
+
+	// Index the records; frame_ends[i] is the index of the EndFrame record closing frame i
+	std::vector<Record> records;
+	std::vector<std::size_t> frame_ends;
+	std::vector<double> captured_ms;
+	int max_width = 0;
+	int max_height = 0;
+
+	std::size_t offset = header.header_size;
+	while (data.size() - offset >= sizeof(RecordHeader)) {
+		RecordHeader record{};
+		std::memcpy(&record, data.data() + offset, sizeof(record));
+		offset += sizeof(record);
+		if (record.size > data.size() - offset || record.call >= static_cast<std::uint16_t>(Call::Count)) {
+			std::cerr << "Corrupt record at offset " << offset - sizeof(record) << ", ignoring the rest of the file." << std::endl;
+			break;
+		}
+
+		Record entry{ static_cast<Call>(record.call), record.context, data.data() + offset, record.size };
+		offset += record.size;
+
+		if (entry.call == Call::EndFrame) {
+			std::int64_t duration = 0;
+			Reader(entry.payload, entry.size).read(duration);
+			frame_ends.push_back(records.size());
+			captured_ms.push_back(static_cast<double>(duration) / 1e6);
+		}
+		else if (entry.call == Call::Viewport && entry.context == 0) {
+			Reader reader(entry.payload, entry.size);
+			GLint x = 0, y = 0;
+			GLsizei width = 0, height = 0;
+			if (reader.read(x) && reader.read(y) && reader.read(width) && reader.read(height)) {
+				max_width = std::max(max_width, x + width);
+				max_height = std::max(max_height, y + height);
+			}
+		}
+		records.push_back(entry);
+	}
+
+	if (frame_ends.empty()) {
+		std::cerr << "The capture has no complete frame." << std::endl;
+		return 1;
+	}
+	options.last_frame = std::min(options.last_frame, frame_ends.size() - 1);
+	if (options.first_frame > options.last_frame) {
+		std::cerr << "Frame range is empty (the capture has " << frame_ends.size() << " frames)." << std::endl;
+		return 1;
+	}
+
+	// Headless context, sized like the window that was captured
+	Gem::GemEngine::Config config;
+	config.headless = true;
+	config.framebuffer_width = options.width > 0 ? options.width : (max_width > 0 ? max_width : config.framebuffer_width);
+	config.framebuffer_height = options.height > 0 ? options.height : (max_height > 0 ? max_height : config.framebuffer_height);
+	config.job_workers = 1;
+	if (!Gem::GemEngine::getInstance().init(config)) {
+		std::cerr << "Failed to create a headless OpenGL context." << std::endl;
+		return 1;
+	}
+	Gem::GLCapture::end();  // Never capture the replay itself (GEM_GL_CAPTURE set in the environment)
+
+	// Captures start from a fresh context: undo the engine's default state
+	glDisable(GL_DEPTH_TEST);
+	glDisable(GL_CULL_FACE);
+	glDisable(GL_BLEND);
+	glCullFace(GL_BACK);
+	glFrontFace(GL_CCW);
+	glBlendFunc(GL_ONE, GL_ZERO);
+	glViewport(0, 0, config.framebuffer_width, config.framebuffer_height);
+
+	std::size_t errors = 0;
+	{
+		Replayer replayer;
+		auto play = [&](std::size_t begin, std::size_t end) {
+			for (std::size_t r = begin; r < end; ++r) {
+				if (!replayer.execute(records[r])) {
+					++errors;
+				}
+			}
+			replayer.restore_main_context();
+		};
+
+		// Everything before the timed range only builds the state
+		std::size_t first_record = options.first_frame == 0 ? 0 : frame_ends[options.first_frame - 1] + 1;
+		play(0, first_record);
+		glFinish();
+
+		std::vector<FrameTiming> timings;
+		std::vector<std::uint8_t> pixels;
+		std::size_t frame_count = (options.last_frame - options.first_frame + 1) * options.loops;
+		timings.reserve(options.frame_by_frame ? frame_count : 0);
+
+		auto start = std::chrono::steady_clock::now();
+		for (unsigned int loop = 0; loop < options.loops; ++loop) {
+			for (std::size_t frame = options.first_frame; frame <= options.last_frame; ++frame) {
+				std::size_t begin = frame == 0 ? 0 : frame_ends[frame - 1] + 1;
+
+				if (!options.frame_by_frame) {
+					play(begin, frame_ends[frame]);
+					continue;
+				}
+
+				auto frame_start = std::chrono::steady_clock::now();
+				play(begin, frame_ends[frame]);
+				double cpu = milliseconds_since(frame_start);
+				glFinish();
+				double gpu = milliseconds_since(frame_start);
+
+				std::uint64_t checksum = options.checksum ? framebuffer_checksum(pixels) : 0;
+				timings.push_back({ frame, captured_ms[frame], cpu, gpu, checksum });
+			}
+		}
+		glFinish();
+		double total = milliseconds_since(start);
+
+		std::cout << std::fixed << std::setprecision(3);
+		std::cout << "Replayed " << frame_count << " frames (" << options.first_frame << ".." << options.last_frame
+			<< " x" << options.loops << ") in " << total << " ms: " << total / static_cast<double>(frame_count) << " ms/frame, "
+			<< 1000.0 * static_cast<double>(frame_count) / total << " FPS." << std::endl;
+
+		if (options.frame_by_frame) {
+			std::vector<double> gpu_times;
+			std::vector<double> captured_times;
+			for (const FrameTiming& timing : timings) {
+				gpu_times.push_back(timing.gpu_ms);
+				captured_times.push_back(timing.captured_ms);
+				std::cout << "frame " << timing.frame << ": cpu " << timing.cpu_ms << " ms, gpu " << timing.gpu_ms
+					<< " ms (captured " << timing.captured_ms << " ms)";
+				if (options.checksum) {
+					std::cout << " checksum " << std::hex << timing.checksum << std::dec;
+				}
+				std::cout << '\n';
+			}
+			std::cout << "replay   frame ms: min " << percentile(gpu_times, 0.0) << ", median " << percentile(gpu_times, 0.5)
+				<< ", p95 " << percentile(gpu_times, 0.95) << ", max " << percentile(gpu_times, 1.0) << '\n';
+			std::cout << "captured frame ms: min " << percentile(captured_times, 0.0) << ", median " << percentile(captured_times, 0.5)
+				<< ", p95 " << percentile(captured_times, 0.95) << ", max " << percentile(captured_times, 1.0) << std::endl;
+
+			if (!options.csv.empty()) {
+				std::ofstream csv(options.csv);
+				if (!csv) {
+					std::cerr << "Failed to create '" << options.csv << "'." << std::endl;
+				}
+				else {
+					csv << std::fixed << std::setprecision(4) << "frame,captured_ms,cpu_ms,gpu_ms,checksum\n";
+					for (const FrameTiming& timing : timings) {
+						csv << timing.frame << ',' << timing.captured_ms << ',' << timing.cpu_ms << ',' << timing.gpu_ms << ','
+							<< std::hex << timing.checksum << std::dec << '\n';
+					}
+				}
+			}
+		}
+	}
+
+	if (errors > 0) {
+		std::cerr << errors << " records could not be replayed." << std::endl;
+	}
+
+	Gem::GemEngine::getInstance().shutdown();
+	return errors > 0 ? 2 : 0;
+}
@@ -0,0 +1,45 @@
+project "GemBench"
+   location( _SCRIPT_DIR )
+   kind "ConsoleApp"
+   language "C++"
+   cppdialect "C++20"
+   targetdir "Build/%{cfg.buildcfg}"
+   staticruntime "off"
+
+   files { "src/**.h", "src/**.cpp" }
+
+   includedirs
+   {
+      -- Include Core (the benchmarks drive the engine's logging, timing and job code directly)
+      "../../GemEngine/GemCore/include",
+      "../../GemEngine/GemCore/include-protected"
+   }
+
+   links
+   {
+      "GemEngine"
+   }
+
+   targetdir ("../../Build/" .. OutputDir .. "/%{prj.name}")
+   objdir ("../../Build/Intermediates/" .. OutputDir .. "/%{prj.name}")
+
+   filter "system:windows"
+       systemversion "latest"
+       defines { "WINDOWS" }
+
+   filter "configurations:Debug"
+       defines { "DEBUG" }
+       runtime "Debug"
+       symbols "On"
+
+   filter "configurations:Release"
+       defines { "RELEASE" }
+       runtime "Release"
+       optimize "On"
+       symbols "On"
+
+   filter "configurations:Dist"
+       defines { "DIST" }
+       runtime "Release"
+       optimize "On"
+       symbols "Off"
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Minimal timing harness shared by the GemBench suites.
+ *
+ * A benchmark body runs a batch of iterations. The batch grows until it takes
+ * TARGET_BATCH, then the best of RUNS batches is reported in nanoseconds per
+ * iteration: the best run is the one least disturbed by the OS.
+ */
+namespace GemBench {
+
+	using BenchClock = std::chrono::steady_clock;
+
+	inline constexpr std::chrono::milliseconds TARGET_BATCH{ 50 };
+	inline constexpr int RUNS = 5;
+
+	/**
+	 * @brief Keeps the compiler from optimizing away a value the benchmark computes.
+	 */
+	template <typename T>
+	inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+		const volatile char sink = *reinterpret_cast<const volatile char*>(&value);
+		(void)sink;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "g"(&value) : "memory");
+#endif
+	}
+
+	/**
+	 * @brief Prints a suite heading.
+	 */
+	inline void section(std::string_view title) {
+		std::printf("\n== %.*s\n", static_cast<int>(title.size()), title.data());
+	}
+
+	/**
+	 * @brief Times body(iterations) and prints the cost of one iteration.
+	 *
+	 * @param name Row label.
+	 * @param body Callable running the measured operation @p iterations times.
+	 * @param setup Callable run before every batch, outside the timing (resets state the body uses up).
+	 * @return Nanoseconds per iteration, best of RUNS batches.
+	 */
+	template <typename Body, typename Setup>
+	double run(std::string_view name, Body&& body, Setup&& setup) {
+		std::uint64_t iterations = 1;
+		for (;;) {
+			setup();
+			auto start = BenchClock::now();
+			body(iterations);
+			if (BenchClock::now() - start >= TARGET_BATCH || iterations >= (std::uint64_t{ 1 } << 40)) {
+				break;
+			}
+			iterations *= 2;
+		}
+
+		double best = 0.0;
+		for (int i = 0; i < RUNS; ++i) {
+			setup();
+			auto start = BenchClock::now();
+			body(iterations);
+			double ns = std::chrono::duration<double, std::nano>(BenchClock::now() - start).count() / static_cast<double>(iterations);
+			best = i == 0 ? ns : std::min(best, ns);
+		}
+
+		std::printf("  %-44.*s %12.2f ns/op\n", static_cast<int>(name.size()), name.data(), best);
+		return best;
+	}
+
+	template <typename Body>
+	double run(std::string_view name, Body&& body) {
+		return run(name, body, [] {});
+	}
+
+	// Suites, one per source file
+	void runFormatBenchmarks();
+	void runBinaryLogBenchmarks();
+	void runClockBenchmarks();
+	void runJobBenchmarks();
+
+} // namespace GemBench
@@ -0,0 +1,53 @@
+#include "Bench.h"
+
+#include <filesystem>
+#include <string>
+
+#include <Gem/Core/BinaryLog.h>
+
+namespace GemBench {
+
+	void runBinaryLogBenchmarks() {
+		section("BinaryLog: \"Frame {} took {} ms on {}\" (int, double, const char*)");
+
+		// Big enough that no batch fills the mapping: a full mapping turns records into cheaper drops
+		const std::string path = (std::filesystem::temp_directory_path() / "GemBench.gblog").string();
+		constexpr std::size_t CAPACITY = std::size_t{ 512 } * 1024 * 1024;
+		auto reopen = [&] {
+			if (!Gem::BinaryLog::open(path, CAPACITY)) {
+				std::fprintf(stderr, "  Failed to map '%s'.\n", path.c_str());
+			}
+		};
+
+		Gem::BinaryLog::setMinLogLevel(Gem::Logger::LogLevel::Debug);
+		run("GEM_BINARY_LOG, 3 arguments", [](std::uint64_t iterations) {
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				GEM_BINARY_LOG(Gem::Logger::LogLevel::Info, "Frame {} took {} ms on {}", static_cast<int>(i), 16.6, "main");
+			}
+		}, reopen);
+
+		run("GEM_BINARY_LOG, no argument", [](std::uint64_t iterations) {
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				GEM_BINARY_LOG(Gem::Logger::LogLevel::Info, "Frame begin");
+			}
+		}, reopen);
+
+		Gem::BinaryLog::setMinLogLevel(Gem::Logger::LogLevel::Error);
+		run("GEM_BINARY_LOG, below the level", [](std::uint64_t iterations) {
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				GEM_BINARY_LOG(Gem::Logger::LogLevel::Info, "Frame {} took {} ms on {}", static_cast<int>(i), 16.6, "main");
+			}
+		}, reopen);
+		Gem::BinaryLog::setMinLogLevel(Gem::Logger::LogLevel::Debug);
+
+		if (Gem::BinaryLog::getDroppedCount() != 0) {
+			std::printf("  (the last batch dropped %llu records: the numbers above are too low)\n",
+				static_cast<unsigned long long>(Gem::BinaryLog::getDroppedCount()));
+		}
+
+		Gem::BinaryLog::close();
+		std::error_code error;
+		std::filesystem::remove(path, error);
+	}
+
+} // namespace GemBench
@@ -0,0 +1,68 @@
+#include "Bench.h"
+
+#include <Gem/Core/Clock.h>
+#include <Gem/Core/Timer.h>
+#include <Gem/Core/TscClock.h>
+
+namespace GemBench {
+
+	namespace {
+
+		template <typename ClockSource>
+		void benchNow(std::string_view name) {
+			run(name, [](std::uint64_t iterations) {
+				for (std::uint64_t i = 0; i < iterations; ++i) {
+					auto now = ClockSource::now();
+					doNotOptimize(now);
+				}
+			});
+		}
+
+		template <typename Policy, typename ClockSource>
+		void benchTimer(std::string_view name) {
+			Gem::BasicTimer<Policy, ClockSource> timer;
+			timer.start();
+			run(name, [&](std::uint64_t iterations) {
+				for (std::uint64_t i = 0; i < iterations; ++i) {
+					double elapsed = timer.getElapsedTimeInSeconds();
+					doNotOptimize(elapsed);
+				}
+			});
+		}
+
+		template <typename Policy, typename ClockSource>
+		void benchClockUpdate(std::string_view name) {
+			Gem::BasicClock<Policy, ClockSource> clock;
+			clock.setFrameTelemetry(false);    // The frame itself, not the binary log / recorder / profiler
+			run(name, [&](std::uint64_t iterations) {
+				for (std::uint64_t i = 0; i < iterations; ++i) {
+					clock.update();
+				}
+			});
+		}
+
+	} // namespace
+
+	void runClockBenchmarks() {
+		// Calibrated up front, as GemEngine::init does, so the first batch does not pay for it
+		Gem::TscClock::calibrate();
+
+		section("Clock sources: now()");
+		std::printf("  (TscClock %s, %.0f Hz)\n", Gem::TscClock::isUsingTsc() ? "reads the TSC" : "falls back to steady_clock", Gem::TscClock::getFrequency());
+		benchNow<std::chrono::steady_clock>("steady_clock::now");
+		benchNow<Gem::TscClock>("TscClock::now");
+
+		section("Timer::getElapsedTimeInSeconds (running)");
+		benchTimer<Gem::ThreadPolicy::Locked, std::chrono::steady_clock>("Locked, steady_clock (Timer)");
+		benchTimer<Gem::ThreadPolicy::AtomicRead, std::chrono::steady_clock>("AtomicRead, steady_clock");
+		benchTimer<Gem::ThreadPolicy::SingleThread, std::chrono::steady_clock>("SingleThread, steady_clock");
+		benchTimer<Gem::ThreadPolicy::SingleThread, Gem::TscClock>("SingleThread, TscClock (FastTimer)");
+
+		section("Clock::update, no FPS cap, no telemetry");
+		benchClockUpdate<Gem::ThreadPolicy::Locked, std::chrono::steady_clock>("Locked, steady_clock");
+		benchClockUpdate<Gem::ThreadPolicy::AtomicRead, std::chrono::steady_clock>("AtomicRead, steady_clock (Clock)");
+		benchClockUpdate<Gem::ThreadPolicy::SingleThread, std::chrono::steady_clock>("SingleThread, steady_clock");
+		benchClockUpdate<Gem::ThreadPolicy::SingleThread, Gem::TscClock>("SingleThread, TscClock");
+	}
+
+} // namespace GemBench
@@ -0,0 +1,71 @@
+#include "Bench.h"
+
+#include <sstream>
+#include <string>
+
+#include <Gem/Core/FormatString.h>
+#include <Gem/Core/Logger.h>
+
+namespace GemBench {
+
+	namespace {
+
+		// The formatting Logger used before format strings were parsed at compile time:
+		// one find, two substr and one ostringstream per placeholder. Kept as the baseline.
+		std::string legacyFormat(const std::string& format) {
+			return format;
+		}
+
+		template <typename T, typename... Args>
+		std::string legacyFormat(const std::string& format, T value, Args... args) {
+			size_t pos = format.find("{}");
+			if (pos != std::string::npos) {
+				std::ostringstream stream;
+				stream << format.substr(0, pos);
+				stream << value;
+				stream << legacyFormat(format.substr(pos + 2), args...);
+				return stream.str();
+			}
+			return format;
+		}
+
+	} // namespace
+
+	void runFormatBenchmarks() {
+		section("Format: \"Frame {} took {} ms on {}\" (int, double, const char*)");
+
+		run("legacy find/substr/ostringstream", [](std::uint64_t iterations) {
+			const std::string format = "Frame {} took {} ms on {}";
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				std::string message = legacyFormat(format, static_cast<int>(i), 16.6, "main");
+				doNotOptimize(message);
+			}
+		});
+
+		run("FormatString::format_to, reused buffer", [](std::uint64_t iterations) {
+			constexpr Gem::FormatString<int, double, const char*> format("Frame {} took {} ms on {}");
+			std::string buffer;
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				buffer.clear();
+				format.format_to(buffer, static_cast<int>(i), 16.6, "main");
+				doNotOptimize(buffer);
+			}
+		});
+
+		// Error level so the call survives every configuration's compile-time filter.
+		// No sink: this is the cost on the calling thread (format + enqueue).
+		Gem::Logger::AsyncConfig config;
+		config.console = false;
+		config.overflow_policy = Gem::Logger::OverflowPolicy::Block;
+		Gem::Logger::enableAsync(config);
+
+		run("Logger::error, async backend, no sink", [](std::uint64_t iterations) {
+			for (std::uint64_t i = 0; i < iterations; ++i) {
+				Gem::Logger::error("Frame {} took {} ms on {}", static_cast<int>(i), 16.6, "main");
+			}
+		});
+
+		Gem::Logger::disableAsync();
+	}
+
+} // namespace GemBench
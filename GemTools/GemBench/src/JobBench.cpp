@@ -0,0 +1,91 @@
+#include "Bench.h"
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <Gem/Core/JobSystem.h>
+
+namespace GemBench {
+
+	namespace {
+
+		constexpr std::size_t ELEMENTS = 1 << 20;
+		constexpr int SMALL_JOBS = 1000;
+
+		/**
+		 * Thread counts to measure: 1, 2, 4... up to every hardware thread.
+		 * The init() thread takes part, so N threads is N - 1 workers (1 thread = jobs run inline).
+		 */
+		std::vector<unsigned int> threadCounts() {
+			unsigned int hardware = std::max(std::thread::hardware_concurrency(), 1u);
+			std::vector<unsigned int> counts;
+			for (unsigned int count = 1; count < hardware; count *= 2) {
+				counts.push_back(count);
+			}
+			counts.push_back(hardware);
+			return counts;
+		}
+
+		void startThreads(unsigned int threads) {
+			if (threads > 1) {
+				Gem::JobSystem::Config config;
+				config.worker_count = threads - 1;
+				Gem::JobSystem::init(config);
+			}
+		}
+
+		void stopThreads() {
+			if (Gem::JobSystem::isInitialized()) {
+				Gem::JobSystem::shutdown();
+			}
+		}
+
+	} // namespace
+
+	void runJobBenchmarks() {
+		const std::vector<unsigned int> counts = threadCounts();
+		std::vector<float> data(ELEMENTS, 1.0f);
+
+		section("JobSystem::parallelFor, 2^20 x sqrt/sin (per call, speedup over 1 thread)");
+		double single = 0.0;
+		for (unsigned int threads : counts) {
+			startThreads(threads);
+			char name[64];
+			std::snprintf(name, sizeof(name), threads > 1 ? "%u threads" : "%u thread (inline)", threads);
+			double ns = run(name, [&](std::uint64_t iterations) {
+				for (std::uint64_t i = 0; i < iterations; ++i) {
+					Gem::JobSystem::parallelFor(0, ELEMENTS, 0, [&](std::size_t first, std::size_t last) {
+						for (std::size_t n = first; n < last; ++n) {
+							data[n] = std::sqrt(data[n] + std::sin(static_cast<float>(n)));
+						}
+					});
+					doNotOptimize(data);
+				}
+			});
+			stopThreads();
+
+			single = threads == 1 ? ns : single;
+			std::printf("  %-44s %12.2fx\n", "  speedup", single / ns);
+		}
+
+		section("JobSystem::run + wait, 1000 empty jobs (per batch)");
+		for (unsigned int threads : counts) {
+			startThreads(threads);
+			char name[64];
+			std::snprintf(name, sizeof(name), threads > 1 ? "%u threads" : "%u thread (inline)", threads);
+			double ns = run(name, [](std::uint64_t iterations) {
+				for (std::uint64_t i = 0; i < iterations; ++i) {
+					Gem::JobSystem::Counter counter;
+					for (int job = 0; job < SMALL_JOBS; ++job) {
+						Gem::JobSystem::run([] {}, &counter);
+					}
+					Gem::JobSystem::wait(counter);
+				}
+			});
+			stopThreads();
+			std::printf("  %-44s %12.2f ns/job\n", "  per job", ns / SMALL_JOBS);
+		}
+	}
+
+} // namespace GemBench
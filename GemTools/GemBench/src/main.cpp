@@ -0,0 +1,61 @@
+#include <cstdio>
+#include <string_view>
+
+#include "Bench.h"
+
+/**
+ * GemBench - microbenchmarks of the engine's hot paths.
+ *
+ * Usage: GemBench [suite...]     (no suite: run them all)
+ *
+ * Build it in Release: Debug numbers say little about the shipped code.
+ */
+
+namespace {
+
+	struct Suite {
+		std::string_view name;
+		void (*run)();
+	};
+
+	constexpr Suite SUITES[] = {
+		{ "format", GemBench::runFormatBenchmarks },
+		{ "binlog", GemBench::runBinaryLogBenchmarks },
+		{ "clock", GemBench::runClockBenchmarks },
+		{ "jobs", GemBench::runJobBenchmarks },
+	};
+
+	void printUsage() {
+		std::printf("Usage: GemBench [suite...]\nSuites:");
+		for (const Suite& suite : SUITES) {
+			std::printf(" %.*s", static_cast<int>(suite.name.size()), suite.name.data());
+		}
+		std::printf("\n");
+	}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	if (argc == 1) {
+		for (const Suite& suite : SUITES) {
+			suite.run();
+		}
+		return 0;
+	}
+
+	for (int i = 1; i < argc; ++i) {
+		bool found = false;
+		for (const Suite& suite : SUITES) {
+			if (suite.name == argv[i]) {
+				suite.run();
+				found = true;
+			}
+		}
+		if (!found) {
+			std::fprintf(stderr, "Unknown suite '%s'.\n", argv[i]);
+			printUsage();
+			return 1;
+		}
+	}
+	return 0;
+}
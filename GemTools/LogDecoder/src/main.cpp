@@ -0,0 +1,283 @@
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Gem/Core/BinaryLog.h>
+#include <Gem/Core/FormatString.h>
+#include <LogSink.h>
+
+#pragma warning( disable : 4996 ) // Disable warning about std::localtime being unsafe
+
+/**
+ * GemLogDecoder - turns a BinaryLog file back into the text Logger writes to a file.
+ *
+ * Usage: GemLogDecoder <input.gblog> [output.txt]
+ */
+
+namespace {
+
+	using namespace Gem::BinaryLogFormat;
+
+	struct Definition {
+		Gem::Logger::LogLevel level = Gem::Logger::LogLevel::Debug;
+		std::vector<ArgType> arg_types;
+		std::string format;
+	};
+
+	/**
+	 * Bounds-checked reader over one record payload.
+	 */
+	class Reader {
+	public:
+		Reader(const char* data, std::size_t size) : data_(data), size_(size) {}
+
+		template <typename T>
+		bool read(T& value) {
+			if (size_ - offset_ < sizeof(T)) {
+				return false;
+			}
+			std::memcpy(&value, data_ + offset_, sizeof(T));
+			offset_ += sizeof(T);
+			return true;
+		}
+
+		bool read_bytes(std::string_view& value, std::size_t length) {
+			if (size_ - offset_ < length) {
+				return false;
+			}
+			value = std::string_view(data_ + offset_, length);
+			offset_ += length;
+			return true;
+		}
+
+	private:
+		const char* data_;
+		std::size_t size_;
+		std::size_t offset_ = 0;
+	};
+
+	template <typename Stored, typename Printed = Stored>
+	bool append_fixed(std::string& out, Reader& reader) {
+		Stored value{};
+		if (!reader.read(value)) {
+			return false;
+		}
+		Gem::Format::append_value(out, static_cast<Printed>(value));
+		return true;
+	}
+
+	/**
+	 * Appends one argument exactly as Logger would have printed the original value.
+	 */
+	bool append_argument(std::string& out, ArgType type, Reader& reader) {
+		switch (type) {
+		case ArgType::Bool:    return append_fixed<std::uint8_t, bool>(out, reader);
+		case ArgType::Char:    return append_fixed<char>(out, reader);
+		case ArgType::Int16:   return append_fixed<std::int16_t>(out, reader);
+		case ArgType::Int32:   return append_fixed<std::int32_t>(out, reader);
+		case ArgType::Int64:   return append_fixed<std::int64_t>(out, reader);
+		case ArgType::UInt16:  return append_fixed<std::uint16_t>(out, reader);
+		case ArgType::UInt32:  return append_fixed<std::uint32_t>(out, reader);
+		case ArgType::UInt64:  return append_fixed<std::uint64_t>(out, reader);
+		case ArgType::Float:   return append_fixed<float>(out, reader);
+		case ArgType::Double:  return append_fixed<double>(out, reader);
+		case ArgType::Pointer: {
+			std::uint64_t value = 0;
+			if (!reader.read(value)) {
+				return false;
+			}
+			Gem::Format::append_value(out, reinterpret_cast<const void*>(static_cast<std::uintptr_t>(value)));
+			return true;
+		}
+		case ArgType::String: {
+			std::uint32_t length = 0;
+			std::string_view text;
+			if (!reader.read(length) || !reader.read_bytes(text, length)) {
+				return false;
+			}
+			out.append(text);
+			return true;
+		}
+		}
+		return false;
+	}
+
+	bool read_definition(Reader& reader, std::unordered_map<std::uint32_t, Definition>& definitions) {
+		std::uint32_t id = 0;
+		std::uint8_t level = 0;
+		std::uint8_t arg_count = 0;
+		std::uint16_t format_length = 0;
+		std::string_view types;
+		std::string_view format;
+
+		if (!reader.read(id) || !reader.read(level) || !reader.read(arg_count) || !reader.read(format_length)
+			|| !reader.read_bytes(types, arg_count) || !reader.read_bytes(format, format_length)) {
+			return false;
+		}
+
+		Definition& definition = definitions[id];
+		definition.level = static_cast<Gem::Logger::LogLevel>(level);
+		definition.arg_types.assign(reinterpret_cast<const ArgType*>(types.data()), reinterpret_cast<const ArgType*>(types.data()) + types.size());
+		definition.format.assign(format);
+		return true;
+	}
+
+	bool format_message(std::string& out, const Definition& definition, Reader& reader) {
+		std::string_view format = definition.format;
+		std::size_t cursor = 0;
+
+		for (ArgType type : definition.arg_types) {
+			std::size_t pos = format.find("{}", cursor);
+			if (pos == std::string_view::npos) {
+				return false;
+			}
+			out.append(format.substr(cursor, pos - cursor));
+			if (!append_argument(out, type, reader)) {
+				return false;
+			}
+			cursor = pos + 2;
+		}
+
+		out.append(format.substr(cursor));
+		return true;
+	}
+
+	void format_timestamp(std::string& out, const FileHeader& header, std::int64_t ticks) {
+		std::int64_t wall_ns = header.system_time_ns + (to_steady_ns(header, ticks) - header.steady_time_ns);
+		std::time_t seconds = static_cast<std::time_t>(wall_ns / 1'000'000'000);
+
+		char buffer[20];
+		std::tm* timeinfo = std::localtime(&seconds);
+		std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", timeinfo);
+		out += buffer;
+	}
+
+}
+
+int main(int argc, char** argv) {
+
+	if (argc < 2) {
+		std::cerr << "Usage: " << argv[0] << " <input.gblog> [output.txt]" << std::endl;
+		return 1;
+	}
+
+	std::ifstream input(argv[1], std::ios::binary);
+	if (!input) {
+		std::cerr << "Failed to open '" << argv[1] << "'." << std::endl;
+		return 1;
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+	FileHeader header{};
+	if (data.size() < sizeof(header)) {
+		std::cerr << "File is too small to be a binary log." << std::endl;
+		return 1;
+	}
+	std::memcpy(&header, data.data(), sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+		std::cerr << "Not a binary log (or unsupported version)." << std::endl;
+		return 1;
+	}
+	if (header.header_size < sizeof(FileHeader) || header.header_size > data.size()) {
+		std::cerr << "Corrupt header (header size " << header.header_size << " for a " << data.size() << "-byte file)." << std::endl;
+		return 1;
+	}
+	if (!(header.ticks_per_second > 0.0)) {
+		std::cerr << "Corrupt header (" << header.ticks_per_second << " ticks per second)." << std::endl;
+		return 1;
+	}
+
+	std::ofstream output_file;
+	if (argc >= 3) {
+		output_file.open(argv[2], std::ios::binary);
+		if (!output_file) {
+			std::cerr << "Failed to create '" << argv[2] << "'." << std::endl;
+			return 1;
+		}
+	}
+	std::ostream& output = output_file.is_open() ? output_file : std::cout;
+
+	std::unordered_map<std::uint32_t, Definition> definitions;
+	std::string line;
+	std::size_t offset = header.header_size;
+	std::size_t records = 0;
+	std::size_t errors = 0;
+	std::size_t unfinished = 0;
+
+	while (data.size() - offset >= sizeof(RecordHeader)) {
+		RecordHeader record{};
+		std::memcpy(&record, data.data() + offset, sizeof(record));
+
+		// A zero size is the end of the data, or space a writer reserved and never sized:
+		// nothing was written in it, so the next record starts at the next non-zero byte
+		if (record.size == 0) {
+			std::size_t next = offset;
+			while (next < data.size() && data[next] == 0) {
+				++next;
+			}
+			if (next == data.size()) {
+				break;
+			}
+			offset = next & ~static_cast<std::size_t>(7);
+			++unfinished;
+			continue;
+		}
+		if (record.size < sizeof(RecordHeader) || record.size > data.size() - offset) {
+			std::cerr << "Corrupt record at offset " << offset << ", stopping." << std::endl;
+			++errors;
+			break;
+		}
+
+		Reader reader(data.data() + offset + sizeof(RecordHeader), record.size - sizeof(RecordHeader));
+		offset += record.size;
+
+		// Reserved but never committed (its writer crashed): the records after it are intact
+		if (record.format_id == UNCOMMITTED_ID) {
+			++unfinished;
+			continue;
+		}
+
+		if (record.format_id == DEFINITION_ID) {
+			if (!read_definition(reader, definitions)) {
+				++errors;
+			}
+			continue;
+		}
+
+		auto it = definitions.find(record.format_id);
+		if (it == definitions.end()) {
+			++errors;
+			continue;
+		}
+
+		// Same layout as RotatingFileSink
+		line.clear();
+		line += '[';
+		format_timestamp(line, header, record.ticks);
+		line += "] [";
+		line += Gem::LogFormat::level_string(it->second.level);
+		line += "] ";
+		if (!format_message(line, it->second, reader)) {
+			line += "<truncated record>";
+			++errors;
+		}
+		line += '\n';
+		output.write(line.data(), static_cast<std::streamsize>(line.size()));
+		++records;
+	}
+
+	errors += unfinished;
+	std::cerr << "Decoded " << records << " records";
+	if (errors > 0) {
+		std::cerr << " (" << errors << " errors, " << unfinished << " of them unfinished records)";
+	}
+	std::cerr << "." << std::endl;
+
+	return errors > 0 ? 2 : 0;
+}
@@ -11,8 +11,27 @@ workspace "GemEngine"
 
 OutputDir = "%{cfg.system}-%{cfg.architecture}/%{cfg.buildcfg}"
 
+-- Headless contexts (GemEngine::Config::headless) need libEGL on Linux. It is linked only when
+-- found, so boxes without it still build; the engine is then compiled without headless support.
+newoption {
+   trigger = "no-egl",
+   description = "Linux: build without EGL (no headless contexts) even if libEGL is installed"
+}
+
+-- Release builds make plain GL calls; this traces each one as a profiler zone instead (GLPolicy.h)
+newoption {
+   trigger = "gl-tracing",
+   description = "Release: trace every GL call in the profiler (GEMENGINE_GL_POLICY=Tracing)"
+}
+
+GemUseEGL = os.istarget("linux") and not _OPTIONS["no-egl"] and os.findlib("EGL") ~= nil
+
 group "Engine"
 	include "../../GemEngine/Build-Engine.lua"
+group "Tools"
+	include "../../GemTools/LogDecoder/Build-LogDecoder.lua"
+	include "../../GemTools/GLReplay/Build-GLReplay.lua"
+	include "../../GemTools/GemBench/Build-GemBench.lua"
 group ""
 
 include "../../GemProject/Build-Project.lua"
\ No newline at end of file